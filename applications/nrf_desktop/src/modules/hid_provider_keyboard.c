@@ -25,8 +25,11 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_HID_REPORT_PROVIDER_KEYBOARD_LOG_LEVEL);
 
+#define EVENT_QUEUE_SIZE	CONFIG_DESKTOP_HID_REPORT_PROVIDER_KEYBOARD_EVENT_QUEUE_SIZE
+
 struct report_data {
 	struct hid_eventq eventq;
+	struct hid_eventq_event eventq_buf[EVENT_QUEUE_SIZE];
 	struct keys_state keys_state;
 	bool update_needed;
 };
@@ -300,8 +303,8 @@ static bool handle_button_event(const struct button_event *event)
 
 static void init(void)
 {
-	hid_eventq_init(&report_data.eventq,
-			CONFIG_DESKTOP_HID_REPORT_PROVIDER_KEYBOARD_EVENT_QUEUE_SIZE);
+	hid_eventq_init(&report_data.eventq, report_data.eventq_buf,
+			ARRAY_SIZE(report_data.eventq_buf));
 	keys_state_init(&report_data.keys_state, KEYBOARD_REPORT_KEY_COUNT_MAX);
 
 	static const struct hid_report_provider_api provider_api_keyboard = {
@@ -26,6 +26,8 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_HID_REPORT_PROVIDER_MOUSE_LOG_LEVEL);
 
+#define BUTTON_QUEUE_SIZE	CONFIG_DESKTOP_HID_REPORT_PROVIDER_MOUSE_BUTTON_QUEUE_SIZE
+
 /* Make sure that mouse buttons would fit in button bitmask. */
 BUILD_ASSERT(MOUSE_REPORT_BUTTON_COUNT_MAX <= BITS_PER_BYTE);
 
@@ -34,7 +36,9 @@ enum SYNC_DATA {
 };
 
 struct report_data {
-	uint8_t button_bm; /* Bitmask of pressed mouse buttons. */
+	uint8_t button_bm; /* Bitmask of pressed mouse buttons (last provided HID report). */
+	uint8_t button_bm_queue[BUTTON_QUEUE_SIZE]; /* Bitmasks waiting for HID report. */
+	uint8_t button_bm_queue_cnt;
 	int16_t axes[MOUSE_REPORT_AXIS_COUNT]; /* Array of axes (motion X, motion Y, wheel). */
 	bool update_needed;
 	uint8_t pipeline_cnt;
@@ -55,6 +59,7 @@ static void clear_report_data(struct report_data *rd)
 	LOG_INF("Clear report data");
 
 	rd->button_bm = 0;
+	rd->button_bm_queue_cnt = 0;
 	memset(&rd->axes, 0x00, sizeof(rd->axes));
 	rd->update_needed = false;
 	rd->pipeline_cnt = 0;
@@ -63,6 +68,70 @@ static void clear_report_data(struct report_data *rd)
 	rd->sync_data_wait_bm = 0;
 }
 
+static uint8_t button_bm_latest(const struct report_data *rd)
+{
+	if (rd->button_bm_queue_cnt == 0) {
+		return rd->button_bm;
+	}
+
+	return rd->button_bm_queue[rd->button_bm_queue_cnt - 1];
+}
+
+static void button_bm_update(struct report_data *rd, uint8_t bit_pos, bool pressed)
+{
+	uint8_t new_bm = button_bm_latest(rd);
+
+	WRITE_BIT(new_bm, bit_pos, pressed);
+
+	if (rd->button_bm_queue_cnt == 0) {
+		rd->button_bm_queue[rd->button_bm_queue_cnt++] = new_bm;
+		return;
+	}
+
+	uint8_t *last = &rd->button_bm_queue[rd->button_bm_queue_cnt - 1];
+	uint8_t prev = (rd->button_bm_queue_cnt > 1) ?
+		       rd->button_bm_queue[rd->button_bm_queue_cnt - 2] : rd->button_bm;
+
+	if (((*last ^ prev) & BIT(bit_pos)) == 0) {
+		/* State of the button did not change in the last enqueued bitmask. The button
+		 * state changes can be merged into a single HID report.
+		 */
+		*last = new_bm;
+	} else if (rd->button_bm_queue_cnt < ARRAY_SIZE(rd->button_bm_queue)) {
+		/* Merging the bitmasks would hide a button press or release from the HID host. */
+		rd->button_bm_queue[rd->button_bm_queue_cnt++] = new_bm;
+	} else {
+		LOG_WRN("Button queue full, button state change merged");
+		*last = new_bm;
+	}
+}
+
+static uint8_t button_bm_get_next(struct report_data *rd)
+{
+	if (rd->button_bm_queue_cnt > 0) {
+		rd->button_bm = rd->button_bm_queue[0];
+		rd->button_bm_queue_cnt--;
+		memmove(&rd->button_bm_queue[0], &rd->button_bm_queue[1],
+			rd->button_bm_queue_cnt);
+	}
+
+	return rd->button_bm;
+}
+
+static bool report_data_pending(const struct report_data *rd, bool wheel)
+{
+	if ((rd->axes[MOUSE_REPORT_AXIS_X] != 0) || (rd->axes[MOUSE_REPORT_AXIS_Y] != 0)) {
+		return true;
+	}
+
+	if (wheel && ((rd->axes[MOUSE_REPORT_AXIS_WHEEL] < -1) ||
+		      (rd->axes[MOUSE_REPORT_AXIS_WHEEL] > 1))) {
+		return true;
+	}
+
+	return (rd->button_bm_queue_cnt > 0);
+}
+
 static void send_empty_report(uint8_t report_id, const void *subscriber)
 {
 	__ASSERT_NO_MSG((report_id == REPORT_ID_MOUSE) ||
@@ -114,8 +183,10 @@ static bool send_report_mouse(uint8_t report_id, bool force)
 	int16_t wheel = CLAMP(rd->axes[MOUSE_REPORT_AXIS_WHEEL] / 2,
 			      MOUSE_REPORT_WHEEL_MIN, MOUSE_REPORT_WHEEL_MAX);
 
-	/* Button bitmask. */
-	uint8_t button_bm = rd->button_bm;
+	/* Button bitmask. Button state changes that cannot be merged are sent in subsequent
+	 * HID reports.
+	 */
+	uint8_t button_bm = button_bm_get_next(rd);
 
 	/* Update stored report data. */
 	if (dx) {
@@ -155,9 +226,8 @@ static bool send_report_mouse(uint8_t report_id, bool force)
 
 	rd->pipeline_cnt++;
 
-	if ((rd->axes[MOUSE_REPORT_AXIS_X] != 0) || (rd->axes[MOUSE_REPORT_AXIS_Y] != 0) ||
-	    (rd->axes[MOUSE_REPORT_AXIS_WHEEL] < -1) || (rd->axes[MOUSE_REPORT_AXIS_WHEEL] > 1)) {
-		/* If there is some axis data to send, request report update. */
+	if (report_data_pending(rd, true)) {
+		/* If there is some axis or button data to send, request report update. */
 		rd->update_needed = true;
 	} else {
 		/* Keep the update needed flag until HID mouse report pipeline is created. */
@@ -192,7 +262,7 @@ static bool send_report_boot_mouse(uint8_t report_id, bool force)
 	int8_t dy = CLAMP(-rd->axes[MOUSE_REPORT_AXIS_Y], INT8_MIN, INT8_MAX);
 
 	/* Button bitmask. */
-	uint8_t button_bm = rd->button_bm;
+	uint8_t button_bm = button_bm_get_next(rd);
 
 	if (dx) {
 		rd->axes[MOUSE_REPORT_AXIS_X] -= dx;
@@ -217,8 +287,8 @@ static bool send_report_boot_mouse(uint8_t report_id, bool force)
 
 	rd->pipeline_cnt++;
 
-	if ((rd->axes[MOUSE_REPORT_AXIS_X] != 0) || (rd->axes[MOUSE_REPORT_AXIS_Y] != 0)) {
-		/* If there is some axis data to send, request report update. */
+	if (report_data_pending(rd, false)) {
+		/* If there is some axis or button data to send, request report update. */
 		rd->update_needed = true;
 	} else {
 		/* Keep the update needed flag until HID mouse report pipeline is created. */
@@ -260,6 +330,9 @@ static void mouse_report_connection_state_changed(uint8_t report_id,
 		rd->pipeline_size = cs->pipeline_size;
 		/* Clear axes. */
 		memset(&rd->axes, 0x00, sizeof(rd->axes));
+		/* The newly connected subscriber needs only the current button state. */
+		rd->button_bm = button_bm_latest(rd);
+		rd->button_bm_queue_cnt = 0;
 	} else {
 		/* Clear whole report data. */
 		clear_report_data(rd);
@@ -320,8 +393,8 @@ static void update_key(uint16_t usage_id, bool pressed)
 	uint8_t bit_pos = usage_id - 1;
 
 	/* Module does not support multiple HW buttons mapped to the same HID usage ID. */
-	__ASSERT_NO_MSG(!(pressed && IS_BIT_SET(report_data.button_bm, bit_pos)));
-	WRITE_BIT(report_data.button_bm, bit_pos, pressed);
+	__ASSERT_NO_MSG(!(pressed && IS_BIT_SET(button_bm_latest(&report_data), bit_pos)));
+	button_bm_update(&report_data, bit_pos, pressed);
 
 	trigger_report_transmission();
 }
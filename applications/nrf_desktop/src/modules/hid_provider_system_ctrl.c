@@ -26,8 +26,11 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_HID_REPORT_PROVIDER_SYSTEM_CTRL_LOG_LEVEL);
 
+#define EVENT_QUEUE_SIZE	CONFIG_DESKTOP_HID_REPORT_PROVIDER_SYSTEM_CTRL_EVENT_QUEUE_SIZE
+
 struct report_data {
 	struct hid_eventq eventq;
+	struct hid_eventq_event eventq_buf[EVENT_QUEUE_SIZE];
 	struct keys_state keys_state;
 	bool update_needed;
 };
@@ -251,8 +254,8 @@ static bool handle_button_event(const struct button_event *event)
 
 static void init(void)
 {
-	hid_eventq_init(&report_data.eventq,
-			CONFIG_DESKTOP_HID_REPORT_PROVIDER_SYSTEM_CTRL_EVENT_QUEUE_SIZE);
+	hid_eventq_init(&report_data.eventq, report_data.eventq_buf,
+			ARRAY_SIZE(report_data.eventq_buf));
 	keys_state_init(&report_data.keys_state, SYSTEM_CTRL_REPORT_KEY_COUNT_MAX);
 
 	static const struct hid_report_provider_api provider_api_system_ctrl = {
@@ -33,10 +33,10 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_HIDS_LOG_LEVEL);
 #define HIDS_SUBSCRIBER_PRIORITY      CONFIG_DESKTOP_HIDS_SUBSCRIBER_PRIORITY
 
 /* To ensure that new report data is sent in every connection event, stack need to be fed with
- * two reports because we get information that submitted report was sent in a subsequent
+ * at least two reports because we get information that submitted report was sent in a subsequent
  * Bluetooth LE connection event.
  */
-#define HIDS_SUBSCRIBER_PIPELINE_SIZE 0x02
+#define HIDS_SUBSCRIBER_PIPELINE_SIZE CONFIG_DESKTOP_HIDS_SUBSCRIBER_PIPELINE_SIZE
 #define HIDS_SUBSCRIBER_REPORT_MAX    CONFIG_DESKTOP_HIDS_SUBSCRIBER_REPORT_MAX
 
 BUILD_ASSERT(HIDS_SUBSCRIBER_REPORT_MAX >= HIDS_SUBSCRIBER_PIPELINE_SIZE,
@@ -7,22 +7,16 @@
 #include "hid_eventq.h"
 
 #include <zephyr/types.h>
-#include <zephyr/sys/slist.h>
 #include <zephyr/kernel.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(hid_eventq, CONFIG_DESKTOP_HID_EVENTQ_LOG_LEVEL);
 
-struct hid_eventq_data {
-	uint16_t key_id;
-	bool pressed;
-};
+/* Marks the end of the list of key presses without a matching key release. */
+#define IDX_NONE		UINT16_MAX
 
-struct hid_eventq_event {
-	sys_snode_t node;
-	struct hid_eventq_data data;
-	int64_t timestamp;
-};
+/* Distance to the matching key release of a key press that was not released yet. */
+#define RELEASE_DIST_NONE	0
 
 
 static bool hid_eventq_is_initialized(const struct hid_eventq *q)
@@ -32,17 +26,40 @@ static bool hid_eventq_is_initialized(const struct hid_eventq *q)
 	return (q->cnt_max != 0);
 }
 
-void hid_eventq_init(struct hid_eventq *q, uint16_t max_queued)
+static uint16_t pos_to_idx(const struct hid_eventq *q, uint16_t pos)
+{
+	__ASSERT_NO_MSG(pos < q->cnt_max);
+
+	return (q->head + pos) % q->cnt_max;
+}
+
+static struct hid_eventq_event *get_event(const struct hid_eventq *q, uint16_t pos)
+{
+	return &q->buf[pos_to_idx(q, pos)];
+}
+
+static void scan_reset(struct hid_eventq *q)
+{
+	q->scan_cnt = 0;
+	q->scan_reach = 0;
+}
+
+void hid_eventq_init(struct hid_eventq *q, struct hid_eventq_event *buf, uint16_t max_queued)
 {
 	LOG_DBG("q:%p, max_queued:%" PRIu16, (void *)q, max_queued);
 
 	ARG_UNUSED(hid_eventq_is_initialized);
 	__ASSERT_NO_MSG(!hid_eventq_is_initialized(q));
+	__ASSERT_NO_MSG(buf);
 	__ASSERT_NO_MSG(max_queued > 0);
+	__ASSERT_NO_MSG(max_queued < IDX_NONE);
 
-	sys_slist_init(&q->root);
+	q->buf = buf;
+	q->head = 0;
 	q->cnt = 0;
 	q->cnt_max = max_queued;
+	q->open_top = IDX_NONE;
+	scan_reset(q);
 }
 
 bool hid_eventq_is_full(const struct hid_eventq *q)
@@ -61,27 +78,114 @@ bool hid_eventq_is_empty(const struct hid_eventq *q)
 	return (q->cnt == 0);
 }
 
+static void open_press_remove(struct hid_eventq *q, uint16_t idx)
+{
+	uint16_t *link = &q->open_top;
+
+	while (*link != IDX_NONE) {
+		if (*link == idx) {
+			*link = q->buf[idx].open_prev;
+			return;
+		}
+
+		link = &q->buf[*link].open_prev;
+	}
+
+	/* Key press must be on the list. */
+	__ASSERT_NO_MSG(false);
+}
+
+static void open_press_match(struct hid_eventq *q, uint16_t release_idx)
+{
+	struct hid_eventq_event *release = &q->buf[release_idx];
+	uint16_t *link = &q->open_top;
+
+	/* The list contains only key presses without a matching key release. It is ordered from the
+	 * newest to the oldest key press. The newest unreleased key press of the same key matches
+	 * the key release.
+	 */
+	while (*link != IDX_NONE) {
+		struct hid_eventq_event *press = &q->buf[*link];
+
+		if (press->key_id == release->key_id) {
+			press->release_dist = (release_idx + q->cnt_max - *link) % q->cnt_max;
+			__ASSERT_NO_MSG(press->release_dist != RELEASE_DIST_NONE);
+
+			*link = press->open_prev;
+			return;
+		}
+
+		link = &press->open_prev;
+	}
+
+	/* No matching key press is enqueued. */
+}
+
+static void hid_eventq_region_purge(struct hid_eventq *q, uint16_t purge_cnt)
+{
+	__ASSERT_NO_MSG(q->cnt >= purge_cnt);
+
+	q->head = (q->head + purge_cnt) % q->cnt_max;
+	q->cnt -= purge_cnt;
+
+	if (purge_cnt > 0) {
+		LOG_WRN("%" PRIu16 " stale events removed from the queue %p", purge_cnt, (void *)q);
+	}
+}
+
+/* Process the next enqueued event.
+ *
+ * The function returns false if the event cannot be processed, because it is a key press without
+ * a matching key release. Otherwise, the function updates the furthest position of a key release
+ * that must be removed together with the already processed events.
+ */
+static bool scan_step(struct hid_eventq *q)
+{
+	__ASSERT_NO_MSG(q->scan_cnt < q->cnt);
+
+	const struct hid_eventq_event *evt = get_event(q, q->scan_cnt);
+	uint16_t reach = q->scan_cnt + 1;
+
+	if (evt->pressed) {
+		if (evt->release_dist == RELEASE_DIST_NONE) {
+			return false;
+		}
+
+		reach += evt->release_dist;
+	}
+
+	q->scan_reach = MAX(q->scan_reach, reach);
+	q->scan_cnt++;
+
+	return true;
+}
+
+static bool scan_at_boundary(const struct hid_eventq *q)
+{
+	/* All of the processed key presses have matching key releases among processed events. */
+	return (q->scan_cnt > 0) && (q->scan_reach == q->scan_cnt);
+}
+
 static void drop_oldest_hid_events(struct hid_eventq *q)
 {
 	LOG_DBG("q:%p", (void *)q);
 
 	__ASSERT_NO_MSG(hid_eventq_is_full(q));
 
-	sys_snode_t *i;
-
-	SYS_SLIST_FOR_EACH_NODE(&q->root, i) {
-		/* Try to remove events but only if key release was generated for each removed key
-		 * press.
-		 */
-		int64_t node_timestamp = CONTAINER_OF(i, struct hid_eventq_event, node)->timestamp;
+	scan_reset(q);
 
-		/* Use incremented event timestamp to drop the event. */
-		hid_eventq_cleanup(q, node_timestamp + 1);
-		if (!hid_eventq_is_full(q)) {
-			/* At least one element was removed from the queue.
-			 * Do not continue list traverse, content was modified!
+	while ((q->scan_cnt < q->cnt) && scan_step(q)) {
+		if (scan_at_boundary(q)) {
+			/* Drop the oldest events with key release generated for each removed key
+			 * press. Use incremented timestamp of the last removed event to also drop
+			 * subsequent events that share the timestamp.
 			 */
-			break;
+			int64_t min_timestamp = get_event(q, q->scan_cnt - 1)->timestamp + 1;
+
+			hid_eventq_region_purge(q, q->scan_cnt);
+			scan_reset(q);
+			hid_eventq_cleanup(q, min_timestamp);
+			return;
 		}
 	}
 }
@@ -100,24 +204,28 @@ int hid_eventq_keypress_enqueue(struct hid_eventq *q, uint16_t id, bool pressed,
 		}
 	}
 
-	struct hid_eventq_event *evt = k_malloc(sizeof(*evt));
-
-	if (!evt) {
-		LOG_ERR("hid_eventq_event allocation failed");
-		return -ENOMEM;
-	}
+	uint16_t idx = pos_to_idx(q, q->cnt);
+	struct hid_eventq_event *evt = &q->buf[idx];
 
 	evt->timestamp = k_uptime_get();
-	evt->data.key_id = id;
-	evt->data.pressed = pressed;
+	evt->key_id = id;
+	evt->pressed = pressed;
+	evt->release_dist = RELEASE_DIST_NONE;
+	evt->open_prev = IDX_NONE;
 
 	LOG_DBG("q:%p, ts:%" PRId64 ", id:%" PRIu16 ", %s",
 		(void *)q, evt->timestamp, id, pressed ? "press" : "release");
 
 	/* Add a new event to the queue. */
-	sys_slist_append(&q->root, &evt->node);
 	q->cnt++;
 
+	if (pressed) {
+		evt->open_prev = q->open_top;
+		q->open_top = idx;
+	} else {
+		open_press_match(q, idx);
+	}
+
 	return 0;
 }
 
@@ -127,50 +235,31 @@ int hid_eventq_keypress_dequeue(struct hid_eventq *q, uint16_t *id, bool *presse
 	__ASSERT_NO_MSG(id);
 	__ASSERT_NO_MSG(pressed);
 
-	sys_snode_t *n = sys_slist_get(&q->root);
-
-	if (!n) {
+	if (q->cnt == 0) {
 		return -ENOENT;
 	}
 
-	struct hid_eventq_event *evt = CONTAINER_OF(n, struct hid_eventq_event, node);
+	const struct hid_eventq_event *evt = &q->buf[q->head];
 
-	*id = evt->data.key_id;
-	*pressed = evt->data.pressed;
+	*id = evt->key_id;
+	*pressed = evt->pressed;
 
 	LOG_DBG("q:%p, ts:%" PRId64 ", id:%" PRIu16 ", %s",
 		(void *)q, evt->timestamp, *id, *pressed ? "press" : "release");
 
-	k_free(evt);
-	q->cnt--;
-
-	return 0;
-}
-
-static void hid_eventq_region_purge(struct hid_eventq *q, sys_snode_t *last_to_purge)
-{
-	sys_snode_t *tmp;
-	sys_snode_t *tmp_safe;
-	size_t removed_cnt = 0;
-
-	SYS_SLIST_FOR_EACH_NODE_SAFE(&q->root, tmp, tmp_safe) {
-		__ASSERT_NO_MSG(tmp);
-
-		sys_slist_remove(&q->root, NULL, tmp);
-		k_free(CONTAINER_OF(tmp, struct hid_eventq_event, node));
-		removed_cnt++;
-
-		if (tmp == last_to_purge) {
-			break;
-		}
+	if (evt->pressed && (evt->release_dist == RELEASE_DIST_NONE)) {
+		open_press_remove(q, q->head);
 	}
 
-	__ASSERT_NO_MSG(q->cnt >= removed_cnt);
-	q->cnt -= removed_cnt;
+	q->head = (q->head + 1) % q->cnt_max;
+	q->cnt--;
+
+	/* Key release of the dequeued key press can be removed without restrictions. Results of
+	 * previous cleanup are no longer valid.
+	 */
+	scan_reset(q);
 
-	if (removed_cnt > 0) {
-		LOG_WRN("%u stale events removed from the queue %p", removed_cnt, (void *)q);
-	}
+	return 0;
 }
 
 void hid_eventq_reset(struct hid_eventq *q)
@@ -179,59 +268,13 @@ void hid_eventq_reset(struct hid_eventq *q)
 
 	LOG_DBG("q:%p", (void *)q);
 
-	hid_eventq_region_purge(q, NULL);
+	hid_eventq_region_purge(q, q->cnt);
 
-	__ASSERT_NO_MSG(q->cnt == 0);
-	__ASSERT_NO_MSG(sys_slist_is_empty(&q->root));
-}
-
-static sys_snode_t *get_first_valid_node(struct hid_eventq *q, int64_t min_timestamp)
-{
-	sys_snode_t *i;
-
-	SYS_SLIST_FOR_EACH_NODE(&q->root, i) {
-		struct hid_eventq_event *evt = CONTAINER_OF(i, struct hid_eventq_event, node);
+	q->head = 0;
+	q->open_top = IDX_NONE;
+	scan_reset(q);
 
-		if (evt->timestamp >= min_timestamp) {
-			return i;
-		}
-	}
-
-	return NULL;
-}
-
-static sys_snode_t *get_keypress_release_node(struct hid_eventq *q, struct hid_eventq_event *evt,
-					      int *evt_pos, sys_snode_t *limit)
-{
-	__ASSERT_NO_MSG(evt->data.pressed);
-
-	size_t hit_count = 1;
-	size_t pos_shift = 0;
-	sys_snode_t *i = &evt->node;
-
-	SYS_SLIST_ITERATE_FROM_NODE(&q->root, i) {
-		pos_shift++;
-
-		if (i == limit) {
-			break;
-		}
-
-		const struct hid_eventq_event *cur = CONTAINER_OF(i, struct hid_eventq_event, node);
-
-		if (cur->data.key_id == evt->data.key_id) {
-			hit_count += cur->data.pressed ? (1) : (-1);
-
-			if (hit_count == 0) {
-				*evt_pos += pos_shift;
-
-				/* Found matching keypress releases. */
-				return i;
-			}
-		}
-	}
-
-	/* Not found. */
-	return NULL;
+	__ASSERT_NO_MSG(q->cnt == 0);
 }
 
 void hid_eventq_cleanup(struct hid_eventq *q, int64_t min_timestamp)
@@ -240,52 +283,26 @@ void hid_eventq_cleanup(struct hid_eventq *q, int64_t min_timestamp)
 
 	LOG_DBG("q:%p, min_timestamp:%" PRId64, (void *)q, min_timestamp);
 
-	sys_snode_t *first_valid = get_first_valid_node(q, min_timestamp);
-
-	sys_snode_t *max_node = NULL;
-	int max_pos = -1;
-
-	sys_snode_t *cur_node;
-	int cur_pos = 0;
-
-	sys_snode_t *tmp_safe;
+	/* Restart processing if events processed by the previous cleanup are no longer stale. */
+	if ((q->scan_cnt > 0) && (get_event(q, q->scan_cnt - 1)->timestamp >= min_timestamp)) {
+		scan_reset(q);
+	}
 
 	/* Remove events but only if key release was generated for each removed key press. */
-	SYS_SLIST_FOR_EACH_NODE_SAFE(&q->root, cur_node, tmp_safe) {
-		if (cur_node == first_valid) {
+	while (q->scan_cnt < q->cnt) {
+		if (get_event(q, q->scan_cnt)->timestamp >= min_timestamp) {
 			break;
 		}
 
-		struct hid_eventq_event *cur_evt =
-			CONTAINER_OF(cur_node, struct hid_eventq_event, node);
-
-		if (cur_evt->data.pressed) {
-			int release_pos = cur_pos;
-			sys_snode_t *release_node = get_keypress_release_node(q, cur_evt,
-									      &release_pos,
-									      first_valid);
-
-			if (release_node) {
-				if (release_pos > max_pos) {
-					max_node = release_node;
-					max_pos = release_pos;
-				}
-			} else {
-				/* Node not found. Abort cleanup. */
-				break;
-			}
-		} else {
-			if (cur_pos > max_pos) {
-				max_node = cur_node;
-				max_pos = cur_pos;
-			}
+		if (!scan_step(q)) {
+			/* Key release not found. Abort cleanup. */
+			break;
 		}
 
-		if (cur_node == max_node) {
+		if (scan_at_boundary(q)) {
 			/* All keypresses up to this point have pairs and can be deleted. */
-			hid_eventq_region_purge(q, max_node);
+			hid_eventq_region_purge(q, q->scan_cnt);
+			scan_reset(q);
 		}
-
-		cur_pos++;
 	}
 }
@@ -22,13 +22,31 @@
 extern "C" {
 #endif
 
-#include <zephyr/sys/slist.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**@brief Enqueued HID event.
+ *
+ * The structure is a storage element of the HID event queue. Its content is internal to the
+ * utility and must not be accessed directly.
+ */
+struct hid_eventq_event {
+	int64_t timestamp;
+	uint16_t key_id;
+	uint16_t release_dist;
+	uint16_t open_prev;
+	bool pressed;
+};
 
 /**@brief Event queue structure. */
 struct hid_eventq {
-	sys_slist_t root;
+	struct hid_eventq_event *buf;
+	uint16_t head;
 	uint16_t cnt;
 	uint16_t cnt_max;
+	uint16_t open_top;
+	uint16_t scan_cnt;
+	uint16_t scan_reach;
 };
 
 /**
@@ -36,10 +54,16 @@ struct hid_eventq {
  *
  * A HID event queue object instance must be initialized before used.
  *
+ * The HID event queue does not allocate memory dynamically. Enqueued HID events are stored in
+ * the storage buffer provided by the caller. The buffer must be able to hold the maximum number
+ * of enqueued HID events and must remain valid for the lifetime of the queue.
+ *
  * @param[in] q			HID event queue object.
- * @param[in] max_queued	Limit of enqueued HID events for the queue.
+ * @param[in] buf		Storage buffer for the enqueued HID events.
+ * @param[in] max_queued	Limit of enqueued HID events for the queue (number of elements
+ *				in the storage buffer).
  */
-void hid_eventq_init(struct hid_eventq *q, uint16_t max_queued);
+void hid_eventq_init(struct hid_eventq *q, struct hid_eventq_event *buf, uint16_t max_queued);
 
 /**
  * @brief Check if a HID event queue is full
@@ -80,7 +104,6 @@ bool hid_eventq_is_empty(const struct hid_eventq *q);
  *
  * @retval 0 when successful.
  * @retval -ENOBUFS if reached limit of enqueued HID events.
- * @retval -ENOMEM if internal memory allocation failed.
  */
 int hid_eventq_keypress_enqueue(struct hid_eventq *q, uint16_t id, bool pressed, bool drop_oldest);
 
@@ -116,6 +139,9 @@ void hid_eventq_reset(struct hid_eventq *q);
  * Enqueued event related to a key press is not removed if a matching key release event cannot be
  * removed. In that case, the function only removes items up to the first unpaired key press.
  *
+ * The function resumes processing from the position where the previous cleanup stopped. Every
+ * enqueued HID event is processed at most once between subsequent dequeue operations.
+ *
  * @param[in] q			HID event queue object.
  * @param[in] min_timestamp	Minimal valid timestamp.
  */
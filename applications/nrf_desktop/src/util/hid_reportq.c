@@ -5,7 +5,6 @@
  */
 
 #include <stdint.h>
-#include <zephyr/sys/slist.h>
 #include <zephyr/kernel.h>
 
 #include "hid_reportq.h"
@@ -18,18 +17,15 @@ LOG_MODULE_REGISTER(hid_reportq, CONFIG_DESKTOP_HID_REPORTQ_LOG_LEVEL);
 #define MAX_ENQUEUED_REPORTS	CONFIG_DESKTOP_HID_REPORTQ_MAX_ENQUEUED_REPORTS
 #define REPORT_IDX_UNSUPPORTED	UINT8_MAX
 
-struct enqueued_report {
-	sys_snode_t node;
-	struct hid_report_event *event;
-};
-
-struct counted_list {
-	sys_slist_t list;
-	size_t node_count;
+/* Ring buffer of enqueued HID report events. */
+struct report_ring {
+	struct hid_report_event *events[MAX_ENQUEUED_REPORTS];
+	uint8_t head;
+	uint8_t node_count;
 };
 
 struct hid_reportq {
-	struct counted_list report_lists[ARRAY_SIZE(input_reports)];
+	struct report_ring report_lists[ARRAY_SIZE(input_reports)];
 	uint16_t enabled_report_idx_bm;
 	uint8_t last_sent_report_idx;
 	uint8_t report_max;
@@ -41,78 +37,54 @@ static struct hid_reportq queues[CONFIG_DESKTOP_HID_REPORTQ_QUEUE_COUNT];
 
 /* Ensure that enabled_report_idx_bm can handle all of the report indexes. */
 BUILD_ASSERT(ARRAY_SIZE(input_reports) <= 16);
+/* Ensure that ring buffer indexes can handle all of the enqueued reports. */
+BUILD_ASSERT(MAX_ENQUEUED_REPORTS <= UINT8_MAX);
 
-static struct enqueued_report *get_enqueued_report(struct counted_list *cnt_list)
+static struct hid_report_event *get_enqueued_event(struct report_ring *ring)
 {
-	sys_snode_t *node = sys_slist_get(&cnt_list->list);
-
-	if (!node) {
+	if (ring->node_count == 0) {
 		return NULL;
 	}
 
-	__ASSERT_NO_MSG(cnt_list->node_count > 0);
-	cnt_list->node_count--;
-
-	return CONTAINER_OF(node, struct enqueued_report, node);
-}
-
-static void enqueue_report(struct counted_list *cnt_list, struct enqueued_report *report)
-{
-	__ASSERT_NO_MSG(cnt_list->node_count < MAX_ENQUEUED_REPORTS);
-	cnt_list->node_count++;
-
-	sys_slist_append(&cnt_list->list, &report->node);
-}
+	struct hid_report_event *event = ring->events[ring->head];
 
-static struct hid_report_event *get_enqueued_event(struct counted_list *cnt_list)
-{
-	struct enqueued_report *report = get_enqueued_report(cnt_list);
-
-	if (!report) {
-		return NULL;
-	}
-
-	struct hid_report_event *event = report->event;
-
-	k_free(report);
+	__ASSERT_NO_MSG(event);
+	ring->events[ring->head] = NULL;
+	ring->head = (ring->head + 1) % MAX_ENQUEUED_REPORTS;
+	ring->node_count--;
 
 	return event;
 }
 
-static void drop_enqueued_events(struct counted_list *cnt_list)
+static void drop_enqueued_events(struct report_ring *ring)
 {
-	struct hid_report_event *event = get_enqueued_event(cnt_list);
+	struct hid_report_event *event = get_enqueued_event(ring);
 
 	while (event) {
 		app_event_manager_free(event);
-		event = get_enqueued_event(cnt_list);
+		event = get_enqueued_event(ring);
 	}
 
-	__ASSERT_NO_MSG(cnt_list->node_count == 0);
+	__ASSERT_NO_MSG(ring->node_count == 0);
 }
 
-static void enqueue_event(struct counted_list *cnt_list, struct hid_report_event *event)
+static void enqueue_event(struct report_ring *ring, struct hid_report_event *event)
 {
-	struct enqueued_report *report;
-
-	if (cnt_list->node_count < MAX_ENQUEUED_REPORTS) {
-		report = k_malloc(sizeof(*report));
-	} else {
+	if (ring->node_count == MAX_ENQUEUED_REPORTS) {
 		LOG_WRN("Enqueue dropped the oldest report");
 
-		report = get_enqueued_report(cnt_list);
-		__ASSERT_NO_MSG(report);
-		app_event_manager_free(report->event);
-	}
+		struct hid_report_event *oldest = get_enqueued_event(ring);
 
-	if (!report) {
-		LOG_ERR("Cannot allocate enqueued_report");
-		/* Should never happen. */
-		__ASSERT_NO_MSG(false);
-	} else {
-		report->event = event;
-		enqueue_report(cnt_list, report);
+		__ASSERT_NO_MSG(oldest);
+		app_event_manager_free(oldest);
 	}
+
+	__ASSERT_NO_MSG(ring->node_count < MAX_ENQUEUED_REPORTS);
+
+	uint8_t tail = (ring->head + ring->node_count) % MAX_ENQUEUED_REPORTS;
+
+	ring->events[tail] = event;
+	ring->node_count++;
 }
 
 static struct hid_reportq *reportq_find_free(void)
@@ -141,7 +113,7 @@ struct hid_reportq *hid_reportq_alloc(const void *sub_id, uint8_t report_max)
 
 	for (size_t i = 0; i < ARRAY_SIZE(q->report_lists); i++) {
 		__ASSERT_NO_MSG(q->report_lists[i].node_count == 0);
-		sys_slist_init(&q->report_lists[i].list);
+		q->report_lists[i].head = 0;
 	}
 
 	__ASSERT_NO_MSG(q->enabled_report_idx_bm == 0);
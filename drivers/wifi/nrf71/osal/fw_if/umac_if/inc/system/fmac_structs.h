@@ -358,6 +358,8 @@ struct tx_config {
 	unsigned int outstanding_descs[NRF_WIFI_FMAC_AC_MAX];
 	/** Peer who will be get the next opportunity for TX. */
 	unsigned int curr_peer_opp[NRF_WIFI_FMAC_AC_MAX];
+	/** Per-AC bitmap of peers which have frames in the pending queue. */
+	unsigned int pend_peer_bmp[NRF_WIFI_FMAC_AC_MAX];
 	/** Access category which will get the next spare descriptor. */
 	unsigned int next_spare_desc_ac;
 	/** Frame context information. */
@@ -83,6 +83,10 @@ struct tx_cmd_prep_info {
 	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx;
 	/** Pointer to the TX configuration. */
 	struct nrf_wifi_tx_buff *config;
+#if defined(NRF_WIFI_QOS_NOACK_POLICY) || defined(__DOXYGEN__)
+	/** A frame with the no-ACK policy TID was found. */
+	bool noack_tid_found;
+#endif /* NRF_WIFI_QOS_NOACK_POLICY */
 };
 
 /**
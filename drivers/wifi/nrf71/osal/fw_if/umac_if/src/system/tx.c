@@ -196,73 +196,46 @@ static int nrf_wifi_get_tid(void *nwb)
 	return priority;
 }
 
-#ifdef NRF_WIFI_QOS_NOACK_POLICY
-struct check_tid_info {
-	int target_tid;
-	bool tid_match_found;
-};
-
-static enum nrf_wifi_status check_tid_callbk_fn(void *callbk_data,
-						void *nbuf)
-{
-	struct check_tid_info *info = NULL;
-	int tid = 0;
-
-	info = (struct check_tid_info *)callbk_data;
-
-	tid = nrf_wifi_get_tid(nbuf);
-
-	if (tid == info->target_tid) {
-		info->tid_match_found = true;
-	}
-
-	return NRF_WIFI_STATUS_SUCCESS;
-}
-
-static bool has_matching_tid(void *txq, int target_tid)
+static bool pending_frames_exist(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				 int peer_id)
 {
-	struct check_tid_info info;
-	enum nrf_wifi_status status;
-
-	info.target_tid = target_tid;
-	info.tid_match_found = false;
+	int ac = 0;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 
-	status = nrf_wifi_utils_list_traverse(txq,
-					      &info,
-					      check_tid_callbk_fn);
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
-	if (status == NRF_WIFI_STATUS_SUCCESS && info.tid_match_found) {
-		return true;
+	for (ac = NRF_WIFI_FMAC_AC_VO; ac >= 0; --ac) {
+		if (sys_dev_ctx->tx_config.pend_peer_bmp[ac] & (1 << peer_id)) {
+			return true;
+		}
 	}
 
 	return false;
 }
-#endif /* NRF_WIFI_QOS_NOACK_POLICY */
 
 
-int pending_frames_count(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
-			 int peer_id)
+/* Keep the bitmap of peers with pending frames in sync with the pending queue */
+static enum nrf_wifi_status update_pend_q_bmp(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				       unsigned int ac,
+				       int peer_id)
 {
-	int count = 0;
-	int ac = 0;
-	void *queue = NULL;
+	void *pend_q = NULL;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
-	for (ac = NRF_WIFI_FMAC_AC_VO; ac >= 0; --ac) {
-		queue = sys_dev_ctx->tx_config.data_pending_txq[peer_id][ac];
-		count += nrf_wifi_utils_q_len(queue);
+	if (peer_id < 0 || peer_id >= MAX_SW_PEERS) {
+		return NRF_WIFI_STATUS_FAIL;
 	}
 
-	return count;
-}
+	pend_q = sys_dev_ctx->tx_config.data_pending_txq[peer_id][ac];
 
+	if (nrf_wifi_utils_q_len(pend_q)) {
+		sys_dev_ctx->tx_config.pend_peer_bmp[ac] |= (1 << peer_id);
+	} else {
+		sys_dev_ctx->tx_config.pend_peer_bmp[ac] &= ~(1 << peer_id);
+	}
 
-static enum nrf_wifi_status update_pend_q_bmp(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
-				       unsigned int ac,
-				       int peer_id)
-{
 	return NRF_WIFI_STATUS_SUCCESS;
 }
 
@@ -376,50 +349,45 @@ unsigned int tx_desc_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 }
 
 
-static int tx_aggr_check(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
-		  void *first_nwb,
-		  int ac,
-		  int peer)
+/* Check the conditions which are common to all frames of an aggregate */
+static bool tx_aggr_allowed(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			    void *first_nwb,
+			    int peer)
 {
-	void *nwb = NULL;
-	void *pending_pkt_queue = NULL;
-	bool aggr = true;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
-	if (sys_dev_ctx->tx_config.peers[peer].is_legacy) {
-		return false;
-	}
-
 #ifdef NRF71_RAW_DATA_TX
+	/* Raw frames are not associated with a peer */
 	if (nrf_wifi_osal_nbuf_is_raw_tx(first_nwb)) {
 		return false;
 	}
 #endif /* NRF71_RAW_DATA_TX */
 
-	pending_pkt_queue = sys_dev_ctx->tx_config.data_pending_txq[peer][ac];
-
-	if (nrf_wifi_utils_q_len(pending_pkt_queue) == 0) {
+	if (sys_dev_ctx->tx_config.peers[peer].is_legacy) {
 		return false;
 	}
 
-	nwb = nrf_wifi_utils_q_peek(pending_pkt_queue);
+	return true;
+}
 
-	if (nwb) {
-		if (!nrf_wifi_util_ether_addr_equal(nrf_wifi_get_dest(nwb),
-						    nrf_wifi_get_dest(first_nwb))) {
-			aggr = false;
-		}
 
-		if (!nrf_wifi_util_ether_addr_equal(nrf_wifi_get_src(nwb),
-						    nrf_wifi_get_src(first_nwb))) {
-			aggr = false;
-		}
+/* Check whether a frame can be added to the aggregate started by first_nwb */
+static bool tx_aggr_check(void *first_nwb,
+			  void *nwb)
+{
+	if (!nrf_wifi_util_ether_addr_equal(nrf_wifi_get_dest(nwb),
+					    nrf_wifi_get_dest(first_nwb))) {
+		return false;
 	}
 
+	if (!nrf_wifi_util_ether_addr_equal(nrf_wifi_get_src(nwb),
+					    nrf_wifi_get_src(first_nwb))) {
+		return false;
+	}
 
-	return aggr;
+	return true;
 }
 
 
@@ -428,8 +396,6 @@ static int get_peer_from_wakeup_q(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 {
 	int peer_id = -1;
 	struct peers_info *peer = NULL;
-	void *pend_q = NULL;
-	unsigned int pend_q_len;
 	void *client_q = NULL;
 	void *list_node = NULL;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
@@ -443,15 +409,10 @@ static int get_peer_from_wakeup_q(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	while (list_node) {
 		peer = nrf_wifi_osal_llist_node_data_get(list_node);
 
-		if (peer != NULL && peer->ps_token_count) {
-
-			pend_q = sys_dev_ctx->tx_config.data_pending_txq[peer->peer_id][ac];
-			pend_q_len = nrf_wifi_utils_q_len(pend_q);
-
-			if (pend_q_len) {
-				peer->ps_token_count--;
-				return peer->peer_id;
-			}
+		if (peer != NULL && peer->ps_token_count &&
+		    (sys_dev_ctx->tx_config.pend_peer_bmp[ac] & (1 << peer->peer_id))) {
+			peer->ps_token_count--;
+			return peer->peer_id;
 		}
 
 		list_node = nrf_wifi_osal_llist_get_node_nxt(client_q,
@@ -468,8 +429,7 @@ static int tx_curr_peer_opp_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	unsigned int i = 0;
 	unsigned int curr_peer_opp = 0;
 	unsigned int init_peer_opp = 0;
-	unsigned int pend_q_len;
-	void *pend_q = NULL;
+	unsigned int pend_peer_bmp = 0;
 	int peer_id = -1;
 	unsigned char ps_state = 0;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
@@ -487,28 +447,28 @@ static int tx_curr_peer_opp_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	}
 
 	init_peer_opp = sys_dev_ctx->tx_config.curr_peer_opp[ac];
+	pend_peer_bmp = sys_dev_ctx->tx_config.pend_peer_bmp[ac] & ((1 << MAX_PEERS) - 1);
 
-	for (i = 0; i < MAX_PEERS; i++) {
+	/* Only peers with pending frames are visited, in round robin order */
+	for (i = 0; pend_peer_bmp && i < MAX_PEERS; i++) {
 		curr_peer_opp = (init_peer_opp + i) % MAX_PEERS;
 
-		ps_state = sys_dev_ctx->tx_config.peers[curr_peer_opp].ps_state;
-
-		if (ps_state == NRF_WIFI_CLIENT_PS_MODE) {
+		if (!(pend_peer_bmp & (1 << curr_peer_opp))) {
 			continue;
 		}
 
-		pend_q = sys_dev_ctx->tx_config.data_pending_txq[curr_peer_opp][ac];
-		pend_q_len = nrf_wifi_utils_q_len(pend_q);
+		pend_peer_bmp &= ~(1 << curr_peer_opp);
 
-		if (pend_q_len) {
-			sys_dev_ctx->tx_config.curr_peer_opp[ac] =
-				(curr_peer_opp + 1) % MAX_PEERS;
-			break;
+		ps_state = sys_dev_ctx->tx_config.peers[curr_peer_opp].ps_state;
+
+		if (ps_state == NRF_WIFI_CLIENT_PS_MODE) {
+			continue;
 		}
-	}
 
-	if (i != MAX_PEERS) {
+		sys_dev_ctx->tx_config.curr_peer_opp[ac] =
+			(curr_peer_opp + 1) % MAX_PEERS;
 		peer_id = curr_peer_opp;
+		break;
 	}
 
 	return peer_id;
@@ -525,6 +485,7 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	int peer_id = -1;
 	void *nwb = NULL;
 	void *first_nwb = NULL;
+	bool aggr = false;
 
 	int max_txq_len, avail_ampdu_len_per_token;
 	int ampdu_len = 0;
@@ -539,8 +500,9 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 
 #ifdef NRF71_RAW_DATA_TX
 	/* Check for Raw packets first, if not found, then check for
-	 * regular packets.
+	 * regular packets. Raw packets are queued for the MAX_PEERS peer.
 	 */
+	peer_id = MAX_PEERS;
 	pend_pkt_q = sys_dev_ctx->tx_config.data_pending_txq[MAX_PEERS][ac];
 	if (!(nrf_wifi_utils_q_len(pend_pkt_q) > 0 &&
 	      nrf_wifi_osal_nbuf_is_raw_tx(nrf_wifi_utils_q_peek(pend_pkt_q)))) {
@@ -567,11 +529,12 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	/* Aggregate Only MPDU's with same RA, same Rate,
 	 * same Rate flags, same Tx Info flags
 	 */
-	if (nrf_wifi_utils_q_len(pend_pkt_q)) {
-		first_nwb = nrf_wifi_utils_q_peek(pend_pkt_q);
-	}
+	first_nwb = nrf_wifi_utils_q_peek(pend_pkt_q);
+
+	/* Peer and frame type checks apply to the whole aggregate */
+	aggr = tx_aggr_allowed(fmac_dev_ctx, first_nwb, peer_id);
 
-	while (nrf_wifi_utils_q_len(pend_pkt_q)) {
+	while (aggr && nrf_wifi_utils_q_len(pend_pkt_q)) {
 		nwb = nrf_wifi_utils_q_peek(pend_pkt_q);
 
 		ampdu_len += TX_BUF_HEADROOM +
@@ -582,7 +545,7 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		}
 
 		if (!can_xmit(fmac_dev_ctx, nwb) ||
-			(!tx_aggr_check(fmac_dev_ctx, first_nwb, ac, peer_id)) ||
+			(!tx_aggr_check(first_nwb, nwb)) ||
 			(nrf_wifi_utils_q_len(txq) >= max_txq_len)) {
 			break;
 		}
@@ -683,6 +646,12 @@ static enum nrf_wifi_status tx_cmd_prep_callbk_fn(void *callbk_data,
 	if (!nrf_wifi_osal_nbuf_get_chksum_done(nbuf)) {
 		config->csum_bitmap |= (1u << frame_indx);
 	}
+#ifdef NRF_WIFI_QOS_NOACK_POLICY
+	/* Checked while the descriptors are filled to avoid another pass over the frames */
+	if (nrf_wifi_get_tid(nbuf) == NRF_WIFI_QOS_NOACK_POLICY_TID) {
+		info->noack_tid_found = true;
+	}
+#endif /* NRF_WIFI_QOS_NOACK_POLICY */
 	config->num_tx_pkts++;
 
 	status = NRF_WIFI_STATUS_SUCCESS;
@@ -840,16 +809,13 @@ static enum nrf_wifi_status tx_cmd_prepare(struct nrf_wifi_fmac_dev_ctx *fmac_de
 
 	config->csum_bitmap = 0;
 
-#ifdef NRF_WIFI_QOS_NOACK_POLICY
-	if (has_matching_tid(txq, NRF_WIFI_QOS_NOACK_POLICY_TID)) {
-		config->mac_hdr_info.tx_flags |= NRF_WIFI_TX_FLAG_QOS_CTL_ACK_POLICY_NOACK;
-	}
-#endif /* NRF_WIFI_QOS_NOACK_POLICY */
-
 	config->num_tx_pkts = 0;
 
 	info.fmac_dev_ctx = fmac_dev_ctx;
 	info.config = config;
+#ifdef NRF_WIFI_QOS_NOACK_POLICY
+	info.noack_tid_found = false;
+#endif /* NRF_WIFI_QOS_NOACK_POLICY */
 
 	status = nrf_wifi_utils_list_traverse(txq,
 					      &info,
@@ -861,13 +827,19 @@ static enum nrf_wifi_status tx_cmd_prepare(struct nrf_wifi_fmac_dev_ctx *fmac_de
 		goto err;
 	}
 
+#ifdef NRF_WIFI_QOS_NOACK_POLICY
+	if (info.noack_tid_found) {
+		config->mac_hdr_info.tx_flags |= NRF_WIFI_TX_FLAG_QOS_CTL_ACK_POLICY_NOACK;
+	}
+#endif /* NRF_WIFI_QOS_NOACK_POLICY */
+
 	sys_dev_ctx->host_stats.total_tx_pkts += config->num_tx_pkts;
 	config->wdev_id = sys_dev_ctx->tx_config.peers[peer_id].if_idx;
 
 	if ((vif_ctx->if_type == NRF_WIFI_IFTYPE_AP ||
 	    vif_ctx->if_type == NRF_WIFI_IFTYPE_AP_VLAN ||
 	    vif_ctx->if_type == NRF_WIFI_IFTYPE_MESH_POINT) &&
-		pending_frames_count(fmac_dev_ctx, peer_id) != 0) {
+		pending_frames_exist(fmac_dev_ctx, peer_id)) {
 		config->mac_hdr_info.more_data = 1;
 	}
 
@@ -1565,11 +1537,12 @@ enum nrf_wifi_status tx_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 
 	for (j = 0; j < NRF_WIFI_FMAC_AC_MAX; j++) {
 		sys_dev_ctx->tx_config.curr_peer_opp[j] = 0;
+		sys_dev_ctx->tx_config.pend_peer_bmp[j] = 0;
 	}
 
 	sys_dev_ctx->tx_config.buf_pool_bmp_p =
 		nrf_wifi_osal_mem_zalloc((sizeof(unsigned long) *
-					 (sys_fpriv->num_tx_tokens/TX_DESC_BUCKET_BOUND) + 1));
+					 ((sys_fpriv->num_tx_tokens/TX_DESC_BUCKET_BOUND) + 1)));
 
 	if (!sys_dev_ctx->tx_config.buf_pool_bmp_p) {
 		nrf_wifi_osal_log_err("%s: Unable to allocate buf_pool_bmp_p",
@@ -217,6 +217,7 @@ struct ras_rd_buffer {
 	uint16_t subevent_cursor;
 	/** Reference counter for buffer.
 	 *  The buffer will not be overwritten with active references.
+	 *  The value is negative while ranging data is written to the buffer.
 	 */
 	atomic_t refcount;
 	/** All ranging data has been written, buffer is ready to send. */
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file dfu_target_app_delta.h
+ *
+ * @defgroup dfu_target_app_delta Application delta DFU Target
+ * @{
+ * @brief DFU Target for application updates delivered as a patch against the active image.
+ *
+ * The patch is applied while it is received. The resulting image is written to the
+ * secondary slot through the MCUboot DFU target, and is then updated by MCUboot.
+ *
+ * Patch format, all fields little-endian:
+ *
+ * - A @ref dfu_target_app_delta_header.
+ * - Records until the target image is complete. Each record is a
+ *   @ref dfu_target_app_delta_record followed by:
+ *   - @c copy_len bytes of target data taken from the source image at the current source
+ *     offset. The data is encoded as copy operations, each a
+ *     @ref dfu_target_app_delta_copy_op followed by @c diff_len bytes replacing the source
+ *     bytes following the @c same_len unchanged bytes.
+ *   - @c insert_len bytes of target data stored in the patch.
+ *
+ *   After the record, @c seek is added to the source offset.
+ *
+ * Patches are created with scripts/bootloader/app_delta_tool.py.
+ */
+
+#ifndef DFU_TARGET_APP_DELTA_H__
+#define DFU_TARGET_APP_DELTA_H__
+
+#include <stddef.h>
+#include <zephyr/toolchain.h>
+#include <dfu/dfu_target.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Magic number of an application delta patch. */
+#define DFU_TARGET_APP_DELTA_MAGIC 0x544c4441
+
+/** Size of the hashes in the patch header. */
+#define DFU_TARGET_APP_DELTA_HASH_SIZE 32
+
+/** @brief Application delta patch header. */
+struct dfu_target_app_delta_header {
+	/** @ref DFU_TARGET_APP_DELTA_MAGIC */
+	uint32_t magic;
+	/** Size of the source image the patch applies to. */
+	uint32_t source_size;
+	/** Size of the target image produced by the patch. */
+	uint32_t target_size;
+	/** SHA-256 of the source image. */
+	uint8_t source_hash[DFU_TARGET_APP_DELTA_HASH_SIZE];
+	/** SHA-256 of the target image. */
+	uint8_t target_hash[DFU_TARGET_APP_DELTA_HASH_SIZE];
+} __packed;
+
+/** @brief Application delta patch record. */
+struct dfu_target_app_delta_record {
+	/** Number of target bytes copied from the source image. */
+	uint32_t copy_len;
+	/** Number of target bytes stored in the patch. */
+	uint32_t insert_len;
+	/** Source offset adjustment after the record. */
+	int32_t seek;
+} __packed;
+
+/** @brief Copy operation within the copied part of a record. */
+struct dfu_target_app_delta_copy_op {
+	/** Number of source bytes copied unchanged. */
+	uint16_t same_len;
+	/** Number of source bytes replaced by the bytes following the operation. */
+	uint16_t diff_len;
+} __packed;
+
+/**
+ * @brief See if data in buf indicates an application delta patch.
+ *
+ * @retval true if data matches, false otherwise.
+ */
+bool dfu_target_app_delta_identify(const void *const buf);
+
+/**
+ * @brief Initialize dfu target, perform steps necessary to receive a patch.
+ *
+ * The MCUboot DFU target must have a buffer set with @ref dfu_target_mcuboot_set_buf.
+ *
+ * @param[in] file_size Size of the patch being downloaded.
+ * @param[in] img_num Image pair index. Only image pair 0 is supported.
+ * @param[in] cb Callback for signaling events(unused).
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int dfu_target_app_delta_init(size_t file_size, int img_num, dfu_target_callback_t cb);
+
+/**
+ * @brief Get offset of the patch.
+ *
+ * Progress is not kept across resets, the offset is 0 after initialization.
+ *
+ * @param[out] offset Returns the number of patch bytes that have been applied.
+ *
+ * @return 0 if success, otherwise negative value if unable to get the offset
+ */
+int dfu_target_app_delta_offset_get(size_t *offset);
+
+/**
+ * @brief Apply patch data.
+ *
+ * @param[in] buf Pointer to patch data.
+ * @param[in] len Length of patch data.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the patch is malformed.
+ * @retval -ENOENT if the active image is not the source image of the patch.
+ * @retval -errno other negative errno on failure.
+ */
+int dfu_target_app_delta_write(const void *const buf, size_t len);
+
+/**
+ * @brief Deinitialize resources and finalize the image if successful.
+ *
+ * When successful, the image is only accepted if the whole patch has been applied and
+ * the hash of the resulting image matches the patch header.
+ *
+ * @param[in] successful Indicate whether the patch was successfully received.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the resulting image is incomplete or its hash does not match.
+ * @retval -errno other negative errno on failure.
+ */
+int dfu_target_app_delta_done(bool successful);
+
+/**
+ * @brief Schedule update of the image.
+ *
+ * @param[in] img_num Image pair index.
+ *
+ * @return 0 for a successful request or a negative error code.
+ */
+int dfu_target_app_delta_schedule_update(int img_num);
+
+/**
+ * @brief Release resources and erase the download area.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_app_delta_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DFU_TARGET_APP_DELTA_H__ */
+
+/**@} */
@@ -415,6 +415,20 @@ int esb_write_payload(const struct esb_payload *payload);
  */
 int esb_read_rx_payload(struct esb_payload *payload);
 
+/** @brief Read multiple payloads.
+ *
+ *  Reads up to @p count payloads from the RX FIFO in a single call.
+ *  The payloads are read in the order they were received.
+ *
+ *  @param[out] payloads	Array of payloads to be received.
+ *  @param[in]  count		Number of elements in the @p payloads array.
+ *
+ * @return Number of payloads read if successful.
+ *         Otherwise, a (negative) error code is returned.
+ * @retval -ENODATA If the RX FIFO is empty.
+ */
+int esb_read_rx_payloads(struct esb_payload *payloads, size_t count);
+
 /** @brief Start transmitting data.
  *
  * @retval 0 If successful.
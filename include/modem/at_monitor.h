@@ -117,6 +117,28 @@ static inline void at_monitor_resume(struct at_monitor_entry *mon)
 	mon->flags.paused = false;
 }
 
+/**
+ * @brief Keep a notification after the monitor callback returns.
+ *
+ * Notifications dispatched in the system workqueue are stored once in the AT monitor
+ * heap and shared by all monitors that receive them. A monitor can take a reference
+ * to the notification it received to process it later, instead of copying it.
+ * The notification is released with @ref at_monitor_notif_unref.
+ *
+ * @note Only notifications received by monitors defined with @ref AT_MONITOR can be
+ *	 referenced. Notifications dispatched in an ISR are not stored in the AT monitor heap.
+ *
+ * @param notif The notification received by the monitor callback.
+ */
+void at_monitor_notif_ref(const char *notif);
+
+/**
+ * @brief Release a notification referenced with @ref at_monitor_notif_ref.
+ *
+ * @param notif The referenced notification.
+ */
+void at_monitor_notif_unref(const char *notif);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -64,6 +64,16 @@ enum location_req_mode {
 	LOCATION_REQ_MODE_FALLBACK = 0,
 	/** All requested methods are used sequentially. */
 	LOCATION_REQ_MODE_ALL,
+	/**
+	 * Fallback to next preferred method like in @ref LOCATION_REQ_MODE_FALLBACK, but
+	 * Wi-Fi scanning for a Wi-Fi method later in the method list is done at the same time
+	 * as GNSS positioning.
+	 *
+	 * If GNSS fails, the Wi-Fi scan results are already available and the cloud location
+	 * request is sent without scanning again. Cellular neighbor measurements and the cloud
+	 * request are not done concurrently with GNSS, because they use the same radio as GNSS.
+	 */
+	LOCATION_REQ_MODE_CONCURRENT,
 };
 
 /** Event IDs. */
@@ -112,7 +122,8 @@ enum location_event_id {
 	 * and the positioning procedure continues.
 	 *
 	 * This event is only sent if @kconfig{CONFIG_LOCATION_DATA_DETAILS} is set and
-	 * @ref location_config.mode is @ref LOCATION_REQ_MODE_FALLBACK.
+	 * @ref location_config.mode is @ref LOCATION_REQ_MODE_FALLBACK or
+	 * @ref LOCATION_REQ_MODE_CONCURRENT.
 	 */
 	LOCATION_EVT_FALLBACK,
 	/**
@@ -531,7 +542,7 @@ struct location_config {
 	 * Wi-Fi and cellular scan results are combined into single cloud request, that is,
 	 * these methods are handled together, if the following conditions are met:
 	 *   - Methods are one after the other in location request method list
-	 *   - @ref mode is @ref LOCATION_REQ_MODE_FALLBACK
+	 *   - @ref mode is @ref LOCATION_REQ_MODE_FALLBACK or @ref LOCATION_REQ_MODE_CONCURRENT
 	 */
 	struct location_method_config methods[CONFIG_LOCATION_METHODS_LIST_SIZE];
 
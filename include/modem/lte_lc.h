@@ -393,6 +393,12 @@ enum lte_lc_evt_type {
 	 * the @c lte_lc_cells_info.current_cell member is set to
 	 * @ref LTE_LC_CELL_EUTRAN_ID_INVALID, and @c lte_lc_cells_info.ncells_count and
 	 * @c lte_lc_cells_info.gci_cells_count members are set to zero.
+	 *
+	 * The neighbor cells and GCI cells are not copied into the event. The
+	 * @c lte_lc_cells_info.neighbor_cells and @c lte_lc_cells_info.gci_cells members point to
+	 * the storage given in @ref lte_lc_ncellmeas_params, or to the storage of the library.
+	 * The storage of the library is valid until the next neighbor cell measurement is
+	 * initiated.
 	 */
 	LTE_LC_EVT_NEIGHBOR_CELL_MEAS		= 7,
 #endif /* CONFIG_LTE_LC_NEIGHBOR_CELL_MEAS_MODULE */
@@ -1185,6 +1191,37 @@ enum lte_lc_neighbor_search_type {
 	LTE_LC_NEIGHBOR_SEARCH_TYPE_GCI_EXTENDED_COMPLETE = 6,
 };
 
+/** @brief Maximum number of GCI cells to be searched. */
+#define LTE_LC_NCELLMEAS_GCI_COUNT_MAX 15
+
+/**
+ * @brief Storage for neighbor cell measurement results.
+ *
+ * The results are written directly into the arrays, which are owned by the application and can be
+ * reused for every measurement.
+ */
+struct lte_lc_ncellmeas_storage {
+	/** @brief Array for the neighbor cells of the current cell. */
+	struct lte_lc_ncell *neighbor_cells;
+
+	/**
+	 * @brief Number of elements in @c neighbor_cells.
+	 *
+	 * If more neighbor cells are found, the rest are ignored.
+	 */
+	uint8_t neighbor_cells_len;
+
+	/** @brief Array for the surrounding cells found by the GCI search types. */
+	struct lte_lc_cell *gci_cells;
+
+	/**
+	 * @brief Number of elements in @c gci_cells.
+	 *
+	 * Must be at least @c lte_lc_ncellmeas_params.gci_count with the GCI search types.
+	 */
+	uint8_t gci_cells_len;
+};
+
 /** @brief Neighbor cell measurement initiation parameters. */
 struct lte_lc_ncellmeas_params {
 	/** @brief Search type, @ref lte_lc_neighbor_search_type. */
@@ -1197,6 +1234,14 @@ struct lte_lc_ncellmeas_params {
 	 * other search types.
 	 */
 	uint8_t gci_count;
+
+	/**
+	 * @brief Storage for the measurement results, or @c NULL to use the storage of the library.
+	 *
+	 * The storage must remain valid until the @ref LTE_LC_EVT_NEIGHBOR_CELL_MEAS event has
+	 * been handled. Mandatory if `CONFIG_LTE_LC_NEIGHBOR_CELL_MEAS_STORAGE` is disabled.
+	 */
+	struct lte_lc_ncellmeas_storage *storage;
 };
 
 /** @brief Environment evaluation type. */
@@ -2223,7 +2268,8 @@ int lte_lc_lte_mode_get(enum lte_lc_lte_mode *mode);
  *
  * @retval 0 if neighbor cell measurement was successfully initiated.
  * @retval -EFAULT if AT command failed.
- * @retval -EINVAL if parameters are invalid.
+ * @retval -EINVAL if parameters are invalid, or the storage for the results is missing or too
+ *                 small.
  * @retval -EINPROGRESS if a neighbor cell measurement is already in progress.
  */
 int lte_lc_neighbor_cell_measurement(struct lte_lc_ncellmeas_params *params);
@@ -340,6 +340,15 @@ enum modem_info_data_type modem_info_data_type_get(enum modem_info info);
  */
 int modem_info_params_get(struct modem_param_info *modem_param);
 
+/** @brief Clear the cached AT command responses.
+ *
+ * The responses are read again from the modem on the next request.
+ * Use this function after changing the modem configuration with AT commands that
+ * affect the information read by this library, such as the system mode.
+ * The function has no effect if @kconfig{CONFIG_MODEM_INFO_CACHE} is disabled.
+ */
+void modem_info_cache_clear(void);
+
 /** @brief Obtain the UUID of the modem firmware build.
  *
  * The UUID is represented as a string, for example:
@@ -133,6 +133,21 @@ int nrf_modem_lib_trace_peek_at(size_t offset, uint8_t *buf, size_t len);
 uint32_t nrf_modem_lib_trace_backend_bitrate_get(void);
 #endif /* defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE) || defined(__DOXYGEN__) */
 
+#if (defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE) &&                                       \
+     defined(CONFIG_NRF_MODEM_LIB_TRACE_STAGING)) ||                                              \
+	defined(__DOXYGEN__)
+/** @brief Get the last measured bitrate at which trace data is copied into the staging buffer.
+ *
+ * This function returns the amount of trace data copied from the modem into the staging buffer
+ * over the last @kconfig{CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE_PERIOD_MS} period.
+ * Compare it with @ref nrf_modem_lib_trace_backend_bitrate_get to see whether the trace backend
+ * keeps up with the modem.
+ *
+ * @return Bitrate of the trace data copied into the staging buffer
+ */
+uint32_t nrf_modem_lib_trace_staging_bitrate_get(void);
+#endif
+
 /** @} */
 
 #ifdef __cplusplus
@@ -161,6 +161,24 @@ struct sms_data {
 	 * specified for that purpose.
 	 */
 	uint8_t payload[SMS_MAX_PAYLOAD_LEN_CHARS + 1];
+
+	/**
+	 * @brief Length of the reassembled concatenated message payload.
+	 *
+	 * @details Zero if @c concat_payload is NULL.
+	 */
+	int concat_payload_len;
+	/**
+	 * @brief Reassembled concatenated message payload.
+	 *
+	 * @details Set only when CONFIG_SMS_REASSEMBLY is enabled and all parts of a concatenated
+	 * message have been received. In that case, the listeners are notified once for the
+	 * whole message, @c header is the header of the first part and @c payload contains
+	 * the payload of the first part. Otherwise, NULL.
+	 *
+	 * The buffer is NUL-terminated and valid only during the listener callback.
+	 */
+	const uint8_t *concat_payload;
 };
 
 /** @brief SMS listener callback function. */
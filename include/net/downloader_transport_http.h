@@ -24,6 +24,25 @@
 struct downloader_transport_http_cfg {
 	/** Socket receive timeout in milliseconds. The default timeout is 30000 ms. */
 	uint32_t sock_recv_timeo_ms;
+	/**
+	 * Number of connections used to download ranges concurrently.
+	 * Use 0 or 1 to download over a single connection.
+	 *
+	 * Requires the CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL option and a
+	 * @c downloader_host_cfg.range_override. The first range is downloaded over a single
+	 * connection to learn the file size, the remaining ranges are requested concurrently.
+	 */
+	uint8_t range_conns;
+	/**
+	 * Reorder buffer for ranges that are received ahead of the download progress.
+	 * The buffer is split into one slot per connection. Each slot holds the HTTP response
+	 * header, up to CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL_HDR_SIZE bytes, and the range,
+	 * so the range size is limited to the rest of the slot. Data is delivered to the
+	 * application in order from this buffer.
+	 */
+	char *reorder_buf;
+	/** Size of the reorder buffer. */
+	size_t reorder_buf_size;
 };
 
 /**
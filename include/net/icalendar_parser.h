@@ -93,7 +93,7 @@ struct ical_parser_evt {
  * parsed component with errors code.
  *
  *
- * @param[in] event  The iCalendar event.
+ * @param[in] event  The iCalendar event. Only valid until the callback returns.
  *
  * @return Zero to continue the parsing, non-zero otherwise.
  */
@@ -102,14 +102,33 @@ typedef int (*icalendar_parser_callback_t)(
 
 /**
  * @brief iCalendar parser instance.
+ *
+ * The parser keeps only the content line that is being received and the component that is
+ * being parsed, so calendars of any size are parsed in constant memory.
  */
 struct icalendar_parser {
-	/** Internal Buffer for parsing incoming data stream */
-	char buf[CONFIG_ICAL_PARSER_BUFFER_SIZE + 1];
-	/** Offset of unparsed data in buf. */
-	size_t offset;
+	/** Unfolded content line being received. */
+	char line[CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE + 1];
+	/** Length of the content line in line. */
+	size_t line_len;
+	/** The content line is longer than the line buffer. */
+	bool line_overflow;
+	/** A line break was received, the next character tells if the content line continues. */
+	bool line_break;
 	/** begin of iCalendar object delimiter pair */
 	bool icalobject_begin;
+	/** A calendar component is being parsed. */
+	bool in_component;
+	/** Nesting depth of the components that are skipped. */
+	size_t skip_depth;
+	/** Parsing is stopped by the callback or by the event limit. */
+	bool stopped;
+	/** Number of events sent to the callback. */
+	size_t event_count;
+	/** Number of events after which parsing is stopped, or 0 for no limit. */
+	size_t max_events;
+	/** Component being parsed. */
+	struct ical_parser_evt evt;
 	/** Event handler. */
 	icalendar_parser_callback_t callback;
 };
@@ -125,14 +144,30 @@ struct icalendar_parser {
 int ical_parser_init(struct icalendar_parser *ical,
 		     icalendar_parser_callback_t callback);
 
+/**
+ * @brief Stop parsing after a number of events.
+ *
+ * Use this to process only the first events of a large calendar, for instance the upcoming
+ * events of a calendar that is sorted by date.
+ *
+ * @param[in,out] ical iCalendar parser instance.
+ * @param[in] max_events Number of events, or 0 for no limit.
+ */
+void ical_parser_max_events_set(struct icalendar_parser *ical, size_t max_events);
+
 /**
  * @brief Parse the iCalendar data stream. Return the parsed bytes.
  *
+ * The data can be split at any position, so the fragments received from the
+ * downloader can be passed as they are. A calendar component is sent to the callback
+ * when its END line and the first character of the following line have been parsed.
+ *
  * @param[in,out] ical iCalendar parser instance.
  * @param[in] data Input data to be parsed.
  * @param[in] len  Length of input data stream.
  *
- * @retval size_t  Parsed bytes.
+ * @retval size_t  Parsed bytes. Less than @p len if parsing was stopped by the callback or
+ *		   the event limit, in which case the rest of the data stream can be discarded.
  */
 size_t ical_parser_parse(struct icalendar_parser *ical,
 			const char *data, size_t len);
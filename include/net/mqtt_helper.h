@@ -35,6 +35,9 @@ enum mqtt_state {
 enum mqtt_helper_error {
 	/** The received payload is larger than the payload buffer. */
 	MQTT_HELPER_ERROR_MSG_SIZE,
+
+	/** Reading a streamed payload failed before the whole payload was received. */
+	MQTT_HELPER_ERROR_MSG_INCOMPLETE,
 };
 
 struct mqtt_helper_buf {
@@ -64,6 +67,30 @@ typedef void (*mqtt_helper_on_connack_t)(enum mqtt_conn_return_code return_code,
 typedef void (*mqtt_helper_on_disconnect_t)(int result);
 typedef void (*mqtt_helper_on_publish_t)(struct mqtt_helper_buf topic_buf,
 					 struct mqtt_helper_buf payload_buf);
+
+/** @brief Handler invoked for each fragment of the payload of an incoming MQTT message.
+ *	   Used instead of the on_publish handler when it is set and
+ *	   @kconfig{CONFIG_MQTT_HELPER_PAYLOAD_STREAMING} is enabled.
+ *
+ *  The fragments are passed in order. Each fragment except the last one is
+ *  @kconfig{CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN} bytes long. A message without payload is
+ *  passed as a single empty fragment.
+ *  The next fragment is not read from the socket before the handler returns, so a handler that
+ *  takes time to process a fragment slows down the broker instead of the data being buffered.
+ *  A QoS 1 message is acknowledged after the handler has accepted the last fragment.
+ *
+ *  @param topic_buf Topic of the message.
+ *  @param fragment_buf Payload fragment. The buffer is only valid until the handler returns.
+ *  @param offset Offset of the fragment in the payload.
+ *  @param total_len Length of the whole payload.
+ *
+ *  @retval 0 to continue receiving the payload.
+ *  @retval A negative error code to discard the rest of the payload. A QoS 1 message is then not
+ *	    acknowledged, and the broker sends it again when the session is resumed.
+ */
+typedef int (*mqtt_helper_on_publish_fragment_t)(struct mqtt_helper_buf topic_buf,
+						 struct mqtt_helper_buf fragment_buf,
+						 size_t offset, size_t total_len);
 typedef void (*mqtt_helper_on_puback_t)(uint16_t message_id, int result);
 typedef void (*mqtt_helper_on_suback_t)(uint16_t message_id, int result);
 typedef void (*mqtt_helper_on_pingresp_t)(void);
@@ -79,6 +106,9 @@ struct mqtt_helper_cfg {
 		mqtt_helper_on_suback_t on_suback;
 		mqtt_helper_on_pingresp_t on_pingresp;
 		mqtt_helper_on_error_t on_error;
+#if defined(CONFIG_MQTT_HELPER_PAYLOAD_STREAMING)
+		mqtt_helper_on_publish_fragment_t on_publish_fragment;
+#endif
 	} cb;
 
 #if defined(CONFIG_MQTT_LIB_TLS)
@@ -136,9 +166,15 @@ int mqtt_helper_disconnect(void);
 int mqtt_helper_subscribe(struct mqtt_subscription_list *sub_list);
 
 /** @brief Publish an MQTT message.
+ *
+ *  @note If @kconfig{CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE} is set, the number of QoS 1
+ *	  messages waiting for a PUBACK is limited. Messages that were not acknowledged before
+ *	  a disconnect are no longer counted.
  *
  *  @retval 0 if successful.
  *  @retval -EOPNOTSUPP if operation is not supported in the current state.
+ *  @retval -EAGAIN if too many QoS 1 messages are waiting for a PUBACK. Try again after
+ *	    the next PUBACK.
  *  @return Otherwise a negative error code.
  */
 int mqtt_helper_publish(const struct mqtt_publish_param *param);
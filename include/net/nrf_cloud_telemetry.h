@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_TELEMETRY_H_
+#define NRF_CLOUD_TELEMETRY_H_
+
+/** @file nrf_cloud_telemetry.h
+ * @brief Store-and-forward telemetry queue for nRF Cloud.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup nrf_cloud_telemetry nRF Cloud telemetry queue
+ * @{
+ */
+
+/** Telemetry queue statistics, counted since the queue was initialized. */
+struct nrf_cloud_telemetry_stats {
+	/** Number of samples waiting to be sent. */
+	uint32_t pending;
+	/** Number of samples sent to nRF Cloud. */
+	uint32_t sent;
+	/** Number of unsent samples erased to make room for new samples. */
+	uint32_t dropped;
+	/** Number of bulk messages sent to nRF Cloud. */
+	uint32_t messages;
+	/** Number of failed attempts to send a bulk message. */
+	uint32_t send_errors;
+	/** Number of bytes written to flash. */
+	uint32_t bytes_written;
+	/** Number of flash sectors erased. */
+	uint32_t sectors_erased;
+};
+
+/**
+ * @brief Initialize the telemetry queue.
+ *
+ * Samples stored in flash that were not sent before the device was reset are sent with
+ * the next flush.
+ * Calling this function again reloads the queue state from flash.
+ *
+ * @retval 0 If successful.
+ * @return A negative value indicates an error.
+ */
+int nrf_cloud_telemetry_init(void);
+
+/**
+ * @brief Add a sample to the telemetry queue.
+ *
+ * The sample is written to flash and sent to nRF Cloud with the next flush, together
+ * with the other queued samples.
+ * A flush is started when @kconfig{CONFIG_NRF_CLOUD_TELEMETRY_FLUSH_COUNT} samples or
+ * @kconfig{CONFIG_NRF_CLOUD_TELEMETRY_PAYLOAD_SIZE} bytes are queued, or
+ * @kconfig{CONFIG_NRF_CLOUD_TELEMETRY_FLUSH_INTERVAL} seconds after the first queued sample.
+ * When the queue is full, the oldest samples are erased.
+ *
+ * @param[in] app_id The app ID identifying the type of data. See the values
+ *                   that begin with NRF_CLOUD_JSON_APPID_ in nrf_cloud_defs.h.
+ * @param[in] value  Sensor reading.
+ * @param[in] ts_ms  Timestamp the data was measured, or NRF_CLOUD_NO_TIMESTAMP.
+ *
+ * @retval 0 If successful.
+ * @retval -EACCES The queue is not initialized.
+ * @retval -EINVAL Invalid app ID.
+ * @return A negative value indicates an error.
+ */
+int nrf_cloud_telemetry_add(const char *app_id, double value, int64_t ts_ms);
+
+/**
+ * @brief Send all queued samples to nRF Cloud.
+ *
+ * The samples are sent in as few bulk messages as possible.
+ * If the device is not connected to nRF Cloud, the samples are kept and sent
+ * with a later flush.
+ *
+ * @retval 0 If successful, or if there were no samples to send.
+ * @retval -EACCES The queue is not initialized, or the device is not connected to nRF Cloud.
+ * @return A negative value indicates an error.
+ */
+int nrf_cloud_telemetry_flush(void);
+
+/**
+ * @brief Get the telemetry queue statistics.
+ *
+ * @param[out] stats Statistics.
+ */
+void nrf_cloud_telemetry_stats_get(struct nrf_cloud_telemetry_stats *stats);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_CLOUD_TELEMETRY_H_ */
@@ -15,11 +15,33 @@
 
 LOG_MODULE_REGISTER(at_monitor, CONFIG_AT_MONITOR_LOG_LEVEL);
 
+/* Monitors beyond this limit are not indexed, and are matched with strstr() */
+#define MATCH_SET_SIZE 64
+#define FILTER_BUCKETS 32
+#define FILTER_BUCKET(c) ((c) % FILTER_BUCKETS)
+
+typedef uint64_t match_set_t;
+
 struct at_notif_fifo {
 	void *fifo_reserved;
+	atomic_t ref;
+	/* Deferred monitors whose filter matched the notification */
+	match_set_t matched;
 	char data[]; /* Null-terminated AT notification string */
 };
 
+/* Index of the monitor filters, by the first character of the filter.
+ * Monitors in bucket b are order[bucket_start[b]] to order[bucket_start[b + 1] - 1].
+ * The filters are fixed at build time, so the index is built once at initialization.
+ */
+static struct {
+	uint8_t order[MATCH_SET_SIZE];
+	uint8_t bucket_start[FILTER_BUCKETS + 1];
+	uint32_t first_chars[128 / 32];
+	match_set_t any;
+	size_t count;
+} filter_index;
+
 static void at_monitor_task(struct k_work *work);
 
 static K_FIFO_DEFINE(at_monitor_fifo);
@@ -41,6 +63,102 @@ static bool has_match(const struct at_monitor_entry *mon, const char *notif)
 	return (mon->filter == ANY || strstr(notif, mon->filter));
 }
 
+static bool is_any(const struct at_monitor_entry *mon)
+{
+	return (mon->filter == ANY || mon->filter[0] == '\0');
+}
+
+static bool is_indexed(size_t idx, const char *filter)
+{
+	return idx < MATCH_SET_SIZE && (uint8_t)filter[0] < 128;
+}
+
+static bool starts_with(const char *str, const char *prefix)
+{
+	while (*prefix != '\0' && *prefix == *str) {
+		prefix++;
+		str++;
+	}
+
+	return *prefix == '\0';
+}
+
+static void filter_index_build(void)
+{
+	struct at_monitor_entry *entries;
+	uint8_t bucket_count[FILTER_BUCKETS] = {0};
+	uint8_t c;
+	size_t b;
+
+	STRUCT_SECTION_GET(at_monitor_entry, 0, &entries);
+	STRUCT_SECTION_COUNT(at_monitor_entry, &filter_index.count);
+
+	for (size_t i = 0; i < MIN(filter_index.count, MATCH_SET_SIZE); i++) {
+		if (is_any(&entries[i])) {
+			filter_index.any |= BIT64(i);
+		} else if (is_indexed(i, entries[i].filter)) {
+			c = entries[i].filter[0];
+			filter_index.first_chars[c / 32] |= BIT(c % 32);
+			bucket_count[FILTER_BUCKET(c)]++;
+		}
+	}
+
+	for (b = 0; b < FILTER_BUCKETS; b++) {
+		filter_index.bucket_start[b + 1] = filter_index.bucket_start[b] + bucket_count[b];
+		bucket_count[b] = filter_index.bucket_start[b];
+	}
+
+	/* Monitors in the same bucket are kept in section order */
+	for (size_t i = 0; i < MIN(filter_index.count, MATCH_SET_SIZE); i++) {
+		if (!is_any(&entries[i]) && is_indexed(i, entries[i].filter)) {
+			b = FILTER_BUCKET((uint8_t)entries[i].filter[0]);
+			filter_index.order[bucket_count[b]++] = i;
+		}
+	}
+}
+
+/* Find the indexed monitors whose filter is found in the notification, in a single pass
+ * over the notification. The paused state is not considered.
+ */
+static match_set_t filter_index_match(const char *notif)
+{
+	struct at_monitor_entry *entries;
+	match_set_t matched = filter_index.any;
+	uint8_t c;
+	size_t b;
+	size_t i;
+
+	STRUCT_SECTION_GET(at_monitor_entry, 0, &entries);
+
+	for (const char *p = notif; *p != '\0'; p++) {
+		c = *p;
+		if (c >= 128 || !(filter_index.first_chars[c / 32] & BIT(c % 32))) {
+			continue;
+		}
+
+		b = FILTER_BUCKET(c);
+		for (size_t k = filter_index.bucket_start[b]; k < filter_index.bucket_start[b + 1];
+		     k++) {
+			i = filter_index.order[k];
+			if (!(matched & BIT64(i)) && starts_with(p, entries[i].filter)) {
+				matched |= BIT64(i);
+			}
+		}
+	}
+
+	return matched;
+}
+
+static bool is_matched(const struct at_monitor_entry *mon, size_t idx, match_set_t matched,
+		       const char *notif)
+{
+	if (idx < MATCH_SET_SIZE && (is_any(mon) || is_indexed(idx, mon->filter))) {
+		return matched & BIT64(idx);
+	}
+
+	return has_match(mon, notif);
+}
+
 /* Dispatch AT notifications immediately, or schedules a workqueue task to do that.
  * Keep this function public so that it can be called by tests.
  * This function is called from an ISR.
@@ -48,22 +166,33 @@ static bool has_match(const struct at_monitor_entry *mon, const char *notif)
 void at_monitor_dispatch(const char *notif)
 {
 	bool monitored;
+	match_set_t matched;
+	match_set_t deferred;
 	struct at_notif_fifo *at_notif;
 	size_t sz_needed;
+	size_t idx;
 
 	__ASSERT_NO_MSG(notif != NULL);
 
+	matched = filter_index_match(notif);
+	deferred = 0;
+
 	monitored = false;
+	idx = 0;
 	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-		if (!is_paused(e) && has_match(e, notif)) {
+		if (!is_paused(e) && is_matched(e, idx, matched, notif)) {
 			if (is_direct(e)) {
 				LOG_DBG("Dispatching to %p (ISR)", e->handler);
 				e->handler(notif);
 			} else {
 				/* Copy and schedule work-queue task */
+				if (idx < MATCH_SET_SIZE) {
+					deferred |= BIT64(idx);
+				}
 				monitored = true;
 			}
 		}
+		idx++;
 	}
 
 	if (!monitored) {
@@ -80,26 +209,48 @@ void at_monitor_dispatch(const char *notif)
 		return;
 	}
 
+	atomic_set(&at_notif->ref, 1);
+	at_notif->matched = deferred;
 	strcpy(at_notif->data, notif);
 
 	k_fifo_put(&at_monitor_fifo, at_notif);
 	k_work_submit(&at_monitor_work);
 }
 
+void at_monitor_notif_ref(const char *notif)
+{
+	struct at_notif_fifo *at_notif = CONTAINER_OF(notif, struct at_notif_fifo, data);
+
+	atomic_inc(&at_notif->ref);
+}
+
+void at_monitor_notif_unref(const char *notif)
+{
+	struct at_notif_fifo *at_notif = CONTAINER_OF(notif, struct at_notif_fifo, data);
+
+	if (atomic_dec(&at_notif->ref) == 1) {
+		k_heap_free(&at_monitor_heap, at_notif);
+	}
+}
+
 static void at_monitor_task(struct k_work *work)
 {
 	struct at_notif_fifo *at_notif;
+	size_t idx;
 
 	while ((at_notif = k_fifo_get(&at_monitor_fifo, K_NO_WAIT))) {
-		/* Match notification with all monitors */
+		/* Dispatch to the monitors matched when the notification was received */
 		LOG_DBG("AT notif: %.*s", strlen(at_notif->data) - strlen("\r\n"), at_notif->data);
+		idx = 0;
 		STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-			if (!is_paused(e) && !is_direct(e) && has_match(e, at_notif->data)) {
+			if (!is_paused(e) && !is_direct(e) &&
+			    is_matched(e, idx, at_notif->matched, at_notif->data)) {
 				LOG_DBG("Dispatching to %p", e->handler);
 				e->handler(at_notif->data);
 			}
+			idx++;
 		}
-		k_heap_free(&at_monitor_heap, at_notif);
+		at_monitor_notif_unref(at_notif->data);
 	}
 }
 
@@ -107,6 +258,8 @@ static int at_monitor_sys_init(void)
 {
 	int err;
 
+	filter_index_build();
+
 	err = nrf_modem_at_notif_handler_set(at_monitor_dispatch);
 	if (err) {
 		LOG_ERR("Failed to hook the dispatch function, err %d", err);
@@ -20,6 +20,9 @@
 #include "date_time_core.h"
 #include "date_time_modem.h"
 #include "date_time_ntp.h"
+#if defined(CONFIG_DATE_TIME_DRIFT)
+#include "date_time_drift.h"
+#endif
 
 LOG_MODULE_DECLARE(date_time, CONFIG_DATE_TIME_LOG_LEVEL);
 
@@ -86,17 +89,23 @@ static int date_time_core_schedule_work(int interval)
 
 static void date_time_core_schedule_update(void)
 {
+	int interval = CONFIG_DATE_TIME_UPDATE_INTERVAL_SECONDS;
+
 	if (CONFIG_DATE_TIME_UPDATE_INTERVAL_SECONDS <= 0) {
 		LOG_DBG("Skipping requested date time update, periodic requests are not enabled");
 		return;
 	}
 
+#if defined(CONFIG_DATE_TIME_DRIFT)
+	/* The interval is backed off while the drift compensated time stays accurate enough */
+	interval = date_time_drift_interval();
+#endif
+
 	/* Reset the retry counter since this will be a normal update. */
 	atomic_set(&retry_count, 0);
 
-	if (date_time_core_schedule_work(CONFIG_DATE_TIME_UPDATE_INTERVAL_SECONDS) == 0) {
-		LOG_DBG("New periodic date time update in: %d seconds",
-			CONFIG_DATE_TIME_UPDATE_INTERVAL_SECONDS);
+	if (date_time_core_schedule_work(interval) == 0) {
+		LOG_DBG("New periodic date time update in: %d seconds", interval);
 	}
 }
 
@@ -207,6 +216,10 @@ void date_time_core_init(void)
 		K_LOWEST_APPLICATION_THREAD_PRIO,
 		&cfg);
 
+#if defined(CONFIG_DATE_TIME_DRIFT)
+	date_time_drift_init();
+#endif
+
 	if (IS_ENABLED(CONFIG_DATE_TIME_AUTO_UPDATE) && IS_ENABLED(CONFIG_LTE_LINK_CONTROL)) {
 		lte_lc_register_handler(date_time_lte_ind_handler);
 	}
@@ -234,6 +247,10 @@ int date_time_core_now(int64_t *unix_time_ms)
 	}
 	*unix_time_ms = (int64_t)tp.tv_sec * 1000 + (int64_t)tp.tv_nsec / 1000000;
 
+#if defined(CONFIG_DATE_TIME_DRIFT)
+	*unix_time_ms += date_time_drift_correction(k_uptime_get());
+#endif
+
 	return 0;
 }
 
@@ -337,6 +354,11 @@ void date_time_core_store_tz(int64_t curr_time_ms, enum date_time_evt_type time_
 
 	date_time_tz = tz;
 
+#if defined(CONFIG_DATE_TIME_DRIFT)
+	/* Before scheduling the next update, which depends on the drift model */
+	date_time_drift_sample(date_time_last_update_uptime, curr_time_ms);
+#endif
+
 	date_time_core_schedule_update();
 
 	/* Reset the retry counter since we have successfully acquired a time. */
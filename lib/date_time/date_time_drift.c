@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#if defined(CONFIG_DATE_TIME_DRIFT_SETTINGS)
+#include <zephyr/settings/settings.h>
+#endif
+#include <zephyr/logging/log.h>
+
+#include "date_time_drift.h"
+
+LOG_MODULE_DECLARE(date_time, CONFIG_DATE_TIME_LOG_LEVEL);
+
+BUILD_ASSERT(CONFIG_DATE_TIME_DRIFT_MAX_INTERVAL_SECONDS >=
+	     CONFIG_DATE_TIME_UPDATE_INTERVAL_SECONDS);
+
+#define DRIFT_SAMPLES CONFIG_DATE_TIME_DRIFT_SAMPLES
+
+/* The skew is estimated only from sync points that span at least this long. */
+#define DRIFT_SPAN_MIN_MS (60 * MSEC_PER_SEC)
+
+/* A sync point further than this from the estimate, in addition to the largest skew over the time
+ * since the previous sync point, means that the time has been changed rather than drifted.
+ */
+#define DRIFT_STEP_MIN_MS (5 * MSEC_PER_SEC)
+
+#define DRIFT_SETTINGS_KEY "date_time"
+#define DRIFT_SETTINGS_MODEL_KEY "drift"
+
+struct drift_sample {
+	int64_t uptime_ms;
+	int64_t unix_time_ms;
+};
+
+/* Model of the local clock. It is stored in settings, so that the skew can be compensated
+ * right after a reboot.
+ */
+struct drift_model {
+	/* Skew of the local clock relative to the time sources, in parts per billion. */
+	int32_t skew_ppb;
+	/* Standard deviation of the sync points from the fitted line, in milliseconds. */
+	uint32_t jitter_ms;
+	/* Standard deviation of the skew, in parts per billion. */
+	uint32_t skew_error_ppb;
+};
+
+static struct k_spinlock lock;
+
+/* Ring buffer of the latest sync points */
+static struct drift_sample samples[DRIFT_SAMPLES];
+static size_t sample_count;
+static size_t sample_latest;
+
+static struct drift_model model;
+/* The model has been fitted to the current sync points. */
+static bool fitted;
+/* Offset of the fitted line from the latest sync point, in milliseconds. */
+static int32_t anchor_ms;
+
+static int interval_s = CONFIG_DATE_TIME_UPDATE_INTERVAL_SECONDS;
+
+static const struct drift_sample *sample_get(size_t age)
+{
+	return &samples[(sample_latest + DRIFT_SAMPLES - age) % DRIFT_SAMPLES];
+}
+
+/* Fit a line to the offsets of the sync points from uptime with least squares. The slope of the
+ * line is the skew of the local clock.
+ */
+static bool model_fit(void)
+{
+	const struct drift_sample *oldest = sample_get(sample_count - 1);
+	double x[DRIFT_SAMPLES];
+	double y[DRIFT_SAMPLES];
+	double x_mean = 0;
+	double y_mean = 0;
+	double sxx = 0;
+	double sxy = 0;
+	double ssr = 0;
+	double skew;
+	double jitter;
+
+	if (sample_count < 3 || sample_get(0)->uptime_ms - oldest->uptime_ms < DRIFT_SPAN_MIN_MS) {
+		return false;
+	}
+
+	/* Relative to the oldest sync point to keep the precision. Index 0 is the latest. */
+	for (size_t i = 0; i < sample_count; i++) {
+		const struct drift_sample *sample = sample_get(i);
+
+		x[i] = sample->uptime_ms - oldest->uptime_ms;
+		y[i] = (sample->unix_time_ms - sample->uptime_ms) -
+		       (oldest->unix_time_ms - oldest->uptime_ms);
+		x_mean += x[i];
+		y_mean += y[i];
+	}
+	x_mean /= sample_count;
+	y_mean /= sample_count;
+
+	for (size_t i = 0; i < sample_count; i++) {
+		sxx += (x[i] - x_mean) * (x[i] - x_mean);
+		sxy += (x[i] - x_mean) * (y[i] - y_mean);
+	}
+
+	skew = sxy / sxx;
+	if (fabs(skew) * 1e6 > CONFIG_DATE_TIME_DRIFT_MAX_PPM) {
+		LOG_DBG("Estimated skew %d ppm out of range", (int)(skew * 1e6));
+		return false;
+	}
+
+	for (size_t i = 0; i < sample_count; i++) {
+		double residual = y[i] - y_mean - skew * (x[i] - x_mean);
+
+		ssr += residual * residual;
+	}
+	jitter = sqrt(ssr / (sample_count - 2));
+
+	model.skew_ppb = (int32_t)lround(skew * 1e9);
+	model.jitter_ms = (uint32_t)lround(jitter);
+	model.skew_error_ppb = (uint32_t)lround(jitter / sqrt(sxx) * 1e9);
+	anchor_ms = (int32_t)lround(y_mean + skew * (x[0] - x_mean) - y[0]);
+
+	return true;
+}
+
+/* Back off the update interval while the estimated error at the next update stays within the
+ * bound. The error grows from the jitter of the sync points with the error of the skew.
+ */
+static void interval_update(void)
+{
+	int64_t max_s;
+
+	if (!fitted || model.jitter_ms >= CONFIG_DATE_TIME_DRIFT_MAX_ERROR_MS) {
+		interval_s = CONFIG_DATE_TIME_UPDATE_INTERVAL_SECONDS;
+		return;
+	}
+
+	if (model.skew_error_ppb == 0) {
+		max_s = CONFIG_DATE_TIME_DRIFT_MAX_INTERVAL_SECONDS;
+	} else {
+		max_s = (int64_t)(CONFIG_DATE_TIME_DRIFT_MAX_ERROR_MS - model.jitter_ms) *
+			1000000 / model.skew_error_ppb;
+	}
+
+	interval_s = CLAMP(MIN(max_s, 2 * (int64_t)interval_s),
+			   CONFIG_DATE_TIME_UPDATE_INTERVAL_SECONDS,
+			   CONFIG_DATE_TIME_DRIFT_MAX_INTERVAL_SECONDS);
+}
+
+#if defined(CONFIG_DATE_TIME_DRIFT_SETTINGS)
+static struct drift_model model_saved;
+
+static int drift_settings_set(const char *key, size_t len, settings_read_cb read_cb,
+			      void *cb_arg)
+{
+	struct drift_model stored;
+
+	if (strcmp(key, DRIFT_SETTINGS_MODEL_KEY) != 0) {
+		return -ENOENT;
+	}
+
+	if (len != sizeof(stored) || read_cb(cb_arg, &stored, sizeof(stored)) != sizeof(stored)) {
+		LOG_WRN("Stored clock drift model ignored");
+		return 0;
+	}
+
+	LOG_DBG("Stored clock skew: %d ppb", stored.skew_ppb);
+
+	K_SPINLOCK(&lock) {
+		model = stored;
+		model_saved = stored;
+	}
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(date_time_drift, DRIFT_SETTINGS_KEY, NULL, drift_settings_set,
+			       NULL, NULL);
+
+static void model_save(const struct drift_model *new_model)
+{
+	int err;
+
+	if (memcmp(new_model, &model_saved, sizeof(model_saved)) == 0) {
+		return;
+	}
+
+	err = settings_save_one(DRIFT_SETTINGS_KEY "/" DRIFT_SETTINGS_MODEL_KEY, new_model,
+				sizeof(*new_model));
+	if (err) {
+		LOG_WRN("Failed to store clock drift model, error: %d", err);
+		return;
+	}
+
+	model_saved = *new_model;
+}
+#endif /* CONFIG_DATE_TIME_DRIFT_SETTINGS */
+
+void date_time_drift_init(void)
+{
+#if defined(CONFIG_DATE_TIME_DRIFT_SETTINGS)
+	int err;
+
+	err = settings_subsys_init();
+	if (err) {
+		LOG_ERR("Failed to initialize settings subsystem, error: %d", err);
+		return;
+	}
+
+	err = settings_load_subtree(DRIFT_SETTINGS_KEY);
+	if (err) {
+		LOG_ERR("Cannot load settings, error: %d", err);
+	}
+#endif
+}
+
+void date_time_drift_reset(void)
+{
+	K_SPINLOCK(&lock) {
+		sample_count = 0;
+		memset(&model, 0, sizeof(model));
+		fitted = false;
+		anchor_ms = 0;
+		interval_s = CONFIG_DATE_TIME_UPDATE_INTERVAL_SECONDS;
+	}
+}
+
+static int64_t correction_get(int64_t uptime_ms)
+{
+	int64_t elapsed_ms;
+
+	if (sample_count == 0) {
+		return 0;
+	}
+
+	elapsed_ms = uptime_ms - sample_get(0)->uptime_ms;
+
+	return anchor_ms + elapsed_ms * model.skew_ppb / 1000000000;
+}
+
+void date_time_drift_sample(int64_t uptime_ms, int64_t unix_time_ms)
+{
+	struct drift_model new_model;
+	bool new_fit;
+
+	K_SPINLOCK(&lock) {
+		if (sample_count > 0) {
+			int64_t elapsed_ms = uptime_ms - sample_get(0)->uptime_ms;
+			int64_t error_ms = unix_time_ms - (sample_get(0)->unix_time_ms +
+							   elapsed_ms + correction_get(uptime_ms));
+
+			if (llabs(error_ms) > DRIFT_STEP_MIN_MS +
+			    elapsed_ms * CONFIG_DATE_TIME_DRIFT_MAX_PPM / 1000000) {
+				LOG_WRN("Time differs from the estimate by %lld ms, "
+					"restarting drift estimation", error_ms);
+				sample_count = 0;
+			} else {
+				LOG_DBG("Time differs from the estimate by %lld ms", error_ms);
+			}
+		}
+
+		sample_latest = (sample_latest + 1) % DRIFT_SAMPLES;
+		samples[sample_latest].uptime_ms = uptime_ms;
+		samples[sample_latest].unix_time_ms = unix_time_ms;
+		sample_count = MIN(sample_count + 1, DRIFT_SAMPLES);
+
+		fitted = model_fit();
+		if (!fitted) {
+			anchor_ms = 0;
+		}
+		interval_update();
+
+		new_fit = fitted;
+		new_model = model;
+	}
+
+	if (!new_fit) {
+		return;
+	}
+
+	LOG_DBG("Clock skew: %d ppb, error: %u ppb, jitter: %u ms, next update in %d seconds",
+		new_model.skew_ppb, new_model.skew_error_ppb, new_model.jitter_ms, interval_s);
+
+#if defined(CONFIG_DATE_TIME_DRIFT_SETTINGS)
+	model_save(&new_model);
+#endif
+}
+
+int64_t date_time_drift_correction(int64_t uptime_ms)
+{
+	int64_t correction_ms;
+
+	K_SPINLOCK(&lock) {
+		correction_ms = correction_get(uptime_ms);
+	}
+
+	return correction_ms;
+}
+
+int date_time_drift_interval(void)
+{
+	return interval_s;
+}
+
+int32_t date_time_drift_skew_ppb(void)
+{
+	return model.skew_ppb;
+}
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef DATE_TIME_DRIFT_H_
+#define DATE_TIME_DRIFT_H_
+
+#include <stdint.h>
+
+void date_time_drift_init(void);
+void date_time_drift_reset(void);
+
+/* Add a sync point, where the time obtained from a time source was unix_time_ms at uptime_ms. */
+void date_time_drift_sample(int64_t uptime_ms, int64_t unix_time_ms);
+
+/* Correction to the local clock at uptime_ms, in milliseconds, since the latest sync point. */
+int64_t date_time_drift_correction(int64_t uptime_ms);
+
+/* Interval until the next time update, in seconds. */
+int date_time_drift_interval(void);
+
+/* Estimated skew of the local clock, in parts per billion. */
+int32_t date_time_drift_skew_ppb(void);
+
+#endif /* DATE_TIME_DRIFT_H_ */
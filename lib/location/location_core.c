@@ -325,6 +325,27 @@ static void location_core_current_config_set(const struct location_config *confi
 	memcpy(&loc_req_info.config, config, sizeof(loc_req_info.config));
 }
 
+#if defined(CONFIG_LOCATION_METHOD_GNSS) && defined(CONFIG_LOCATION_METHOD_WIFI)
+static void location_core_wifi_prescan_start(enum location_method requested_method)
+{
+	if (loc_req_info.config.mode != LOCATION_REQ_MODE_CONCURRENT ||
+	    requested_method != LOCATION_METHOD_GNSS) {
+		return;
+	}
+
+	/* Wi-Fi uses a separate radio, so it can be scanned while GNSS is running
+	 * if Wi-Fi would be used as a fallback for GNSS.
+	 */
+	for (int i = loc_req_info.current_method_index + 1; i < loc_req_info.methods_count; i++) {
+		if (loc_req_info.methods[i] == LOCATION_METHOD_WIFI ||
+		    loc_req_info.methods[i] == LOCATION_METHOD_WIFI_CELLULAR) {
+			method_cloud_location_wifi_prescan(loc_req_info.wifi);
+			break;
+		}
+	}
+}
+#endif
+
 static int location_core_location_get_pos(void)
 {
 	int err;
@@ -341,6 +362,9 @@ static int location_core_location_get_pos(void)
 		(char *)location_method_api_get(requested_method)->method_string);
 	location_core_current_event_data_init(requested_method);
 
+#if defined(CONFIG_LOCATION_METHOD_GNSS) && defined(CONFIG_LOCATION_METHOD_WIFI)
+	location_core_wifi_prescan_start(requested_method);
+#endif
 	err = location_method_api_get(requested_method)->location_get(&loc_req_info);
 	if (err != 0) {
 		return err;
@@ -392,7 +416,7 @@ static void location_request_info_create(const struct location_config *config)
 	}
 
 	/* Wi-Fi and cellular are not combined if LOCATION_REQ_MODE_ALL is used */
-	if (loc_req_info.config.mode == LOCATION_REQ_MODE_FALLBACK) {
+	if (loc_req_info.config.mode != LOCATION_REQ_MODE_ALL) {
 		/* Wi-Fi and cellular are combined if they are one after the other in method list */
 		if (abs(method_wifi_index - method_cellular_index) == 1) {
 			__ASSERT_NO_MSG(loc_req_info.cellular != NULL);
@@ -715,6 +739,9 @@ static void location_core_event_cb_fn(struct k_work *work)
 			}
 
 			location_core_current_event_data_init(requested_method);
+#if defined(CONFIG_LOCATION_METHOD_GNSS) && defined(CONFIG_LOCATION_METHOD_WIFI)
+			location_core_wifi_prescan_start(requested_method);
+#endif
 			err = location_method_api_get(requested_method)->location_get(
 				&loc_req_info);
 			return;
@@ -726,6 +753,10 @@ static void location_core_event_cb_fn(struct k_work *work)
 		}
 	}
 
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	/* Wi-Fi scan started during GNSS is not needed when the request is done */
+	method_cloud_location_wifi_prescan_cancel();
+#endif
 	location_utils_event_dispatch(&loc_req_info.current_event_data);
 
 	k_work_cancel_delayable(&location_core_timeout_work);
@@ -827,6 +858,9 @@ int location_core_cancel(void)
 	k_work_cancel_delayable(&location_core_timeout_work);
 	k_work_cancel_delayable(&location_periodic_work);
 	k_work_cancel(&location_event_cb_work);
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	method_cloud_location_wifi_prescan_cancel();
+#endif
 
 	/* Check if location has been requested using one of the methods */
 	if (current_method != 0) {
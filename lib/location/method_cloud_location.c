@@ -45,6 +45,20 @@ static bool running;
 
 #if defined(CONFIG_LOCATION_METHOD_WIFI)
 static K_SEM_DEFINE(wifi_scan_ready, 0, 1);
+
+/* Wi-Fi scan started together with GNSS in LOCATION_REQ_MODE_CONCURRENT */
+static struct k_work wifi_prescan_work;
+static const struct location_wifi_config *wifi_prescan_config;
+static atomic_t wifi_prescan_started;
+
+static void method_cloud_location_wifi_prescan_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	LOG_DBG("Starting Wi-Fi scan concurrently with GNSS");
+
+	scan_wifi_execute(wifi_prescan_config->timeout, &wifi_scan_ready);
+}
 #endif
 
 static void method_cloud_location_positioning_work_fn(struct k_work *work)
@@ -62,10 +76,14 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 	int err = 0;
 
 #if defined(CONFIG_LOCATION_METHOD_WIFI)
-	k_sem_reset(&wifi_scan_ready);
-
 	if (wifi_config != NULL) {
-		scan_wifi_execute(wifi_config->timeout, &wifi_scan_ready);
+		if (atomic_get(&wifi_prescan_started)) {
+			/* Scan was started together with GNSS and may already be done */
+			LOG_DBG("Using Wi-Fi scan started during GNSS");
+		} else {
+			k_sem_reset(&wifi_scan_ready);
+			scan_wifi_execute(wifi_config->timeout, &wifi_scan_ready);
+		}
 	}
 #endif
 
@@ -79,6 +97,7 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 #if defined(CONFIG_LOCATION_METHOD_WIFI)
 	if (wifi_config != NULL) {
 		k_sem_take(&wifi_scan_ready, K_FOREVER);
+		atomic_set(&wifi_prescan_started, false);
 		scan_wifi_info = scan_wifi_results_get();
 	}
 #endif
@@ -165,6 +184,7 @@ int method_cloud_location_cancel(void)
 	if (running) {
 #if defined(CONFIG_LOCATION_METHOD_WIFI)
 		scan_wifi_cancel();
+		atomic_set(&wifi_prescan_started, false);
 #endif
 #if defined(CONFIG_LOCATION_METHOD_CELLULAR)
 		scan_cellular_cancel();
@@ -208,6 +228,35 @@ int method_cloud_location_get(const struct location_request_info *request)
 	return 0;
 }
 
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+void method_cloud_location_wifi_prescan(const struct location_wifi_config *wifi_config)
+{
+	__ASSERT_NO_MSG(wifi_config != NULL);
+
+	if (running || !atomic_cas(&wifi_prescan_started, false, true)) {
+		return;
+	}
+
+	k_sem_reset(&wifi_scan_ready);
+	wifi_prescan_config = wifi_config;
+
+	/* Submitted before the GNSS work items so that the scan is not delayed by them */
+	k_work_submit_to_queue(location_core_work_queue_get(), &wifi_prescan_work);
+}
+
+void method_cloud_location_wifi_prescan_cancel(void)
+{
+	if (!atomic_cas(&wifi_prescan_started, true, false)) {
+		return;
+	}
+
+	LOG_DBG("Cancelling Wi-Fi scan started during GNSS");
+
+	(void)k_work_cancel(&wifi_prescan_work);
+	scan_wifi_cancel();
+}
+#endif
+
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
 void method_cloud_location_details_get(struct location_data_details *details)
 {
@@ -224,5 +273,10 @@ int method_cloud_location_init(void)
 {
 	running = false;
 
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	k_work_init(&wifi_prescan_work, method_cloud_location_wifi_prescan_work_fn);
+	atomic_set(&wifi_prescan_started, false);
+#endif
+
 	return 0;
 }
@@ -10,6 +10,10 @@
 int method_cloud_location_get(const struct location_request_info *request);
 int method_cloud_location_init(void);
 int method_cloud_location_cancel(void);
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+void method_cloud_location_wifi_prescan(const struct location_wifi_config *wifi_config);
+void method_cloud_location_wifi_prescan_cancel(void);
+#endif
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
 void method_cloud_location_details_get(struct location_data_details *details);
 #endif
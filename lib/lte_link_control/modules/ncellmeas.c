@@ -47,82 +47,101 @@ LOG_MODULE_DECLARE(lte_lc, CONFIG_LTE_LINK_CONTROL_LOG_LEVEL);
 #define AT_NCELLMEAS_N_RSRQ_INDEX	     3
 #define AT_NCELLMEAS_N_TIME_DIFF_INDEX	     4
 #define AT_NCELLMEAS_N_PARAMS_COUNT	     5
-#define AT_NCELLMEAS_N_MAX_ARRAY_SIZE	     CONFIG_LTE_NEIGHBOR_CELLS_MAX
 
 #define AT_NCELLMEAS_PARAMS_COUNT_MAX                                                              \
 	(AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT +                                                    \
 	 AT_NCELLMEAS_N_PARAMS_COUNT * CONFIG_LTE_NEIGHBOR_CELLS_MAX)
 
-#define AT_NCELLMEAS_GCI_CELL_PARAMS_COUNT 12
-
 /* Requested NCELLMEAS params */
 static struct lte_lc_ncellmeas_params ncellmeas_params;
+
+#if defined(CONFIG_LTE_LC_NEIGHBOR_CELL_MEAS_STORAGE)
+/* Storage for the results when the application does not provide storage. The results are lent to
+ * the event handlers by reference, and the storage is reused for every measurement.
+ */
+static struct lte_lc_ncell ncellmeas_neighbor_cells[CONFIG_LTE_NEIGHBOR_CELLS_MAX];
+static struct lte_lc_cell ncellmeas_gci_cells[LTE_LC_NCELLMEAS_GCI_COUNT_MAX];
+static struct lte_lc_ncellmeas_storage ncellmeas_storage = {
+	.neighbor_cells = ncellmeas_neighbor_cells,
+	.neighbor_cells_len = ARRAY_SIZE(ncellmeas_neighbor_cells),
+	.gci_cells = ncellmeas_gci_cells,
+	.gci_cells_len = ARRAY_SIZE(ncellmeas_gci_cells),
+};
+#endif /* CONFIG_LTE_LC_NEIGHBOR_CELL_MEAS_STORAGE */
+
 /* Sempahore value 1 means ncellmeas is not ongoing, and 0 means it's ongoing. */
 K_SEM_DEFINE(ncellmeas_idle_sem, 1, 1);
 
 AT_MONITOR(ltelc_atmon_ncellmeas, "%NCELLMEAS", at_handler_ncellmeas);
 
-/* Counts the frequency of a character in a null-terminated string. */
-static uint32_t get_char_frequency(const char *str, char c)
+/* Returns true if the parser has reached the end of the notification parameters. */
+static bool is_end_of_params(int err)
 {
-	uint32_t count = 0;
-
-	__ASSERT_NO_MSG(str != NULL);
-
-	do {
-		if (*str == c) {
-			count++;
-		}
-	} while (*(str++) != '\0');
-
-	return count;
+	return err == -EIO || err == -EAGAIN;
 }
 
-static uint32_t neighborcell_count_get(const char *at_response)
+/* Parses the measurements of a neighbor cell, which follow its EARFCN and physical cell ID.
+ * The parameters are read with increasing indices, so the parser continues from its cursor and
+ * the response is tokenized only once.
+ */
+static int parse_ncell_meas(struct at_parser *parser, size_t start_idx, struct lte_lc_ncell *ncell)
 {
-	uint32_t comma_count, ncell_elements, ncell_count;
+	int err, tmp;
 
-	__ASSERT_NO_MSG(at_response != NULL);
+	/* RSRP */
+	err = at_parser_num_get(parser, start_idx + AT_NCELLMEAS_N_RSRP_INDEX, &tmp);
+	if (err) {
+		LOG_ERR("Could not parse n_rsrp, error: %d", err);
+		return err;
+	}
+
+	ncell->rsrp = tmp;
 
-	comma_count = get_char_frequency(at_response, ',');
-	if (comma_count < AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT) {
-		return 0;
+	/* RSRQ */
+	err = at_parser_num_get(parser, start_idx + AT_NCELLMEAS_N_RSRQ_INDEX, &tmp);
+	if (err) {
+		LOG_ERR("Could not parse n_rsrq, error: %d", err);
+		return err;
 	}
 
-	/* Add one, as there's no comma after the last element. */
-	ncell_elements = comma_count - (AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT - 1) + 1;
-	ncell_count = ncell_elements / AT_NCELLMEAS_N_PARAMS_COUNT;
+	ncell->rsrq = tmp;
+
+	/* Time difference */
+	err = at_parser_num_get(parser, start_idx + AT_NCELLMEAS_N_TIME_DIFF_INDEX,
+				&ncell->time_diff);
+	if (err) {
+		LOG_ERR("Could not parse time_diff, error: %d", err);
+		return err;
+	}
 
-	return ncell_count;
+	return 0;
 }
 
 static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const char *at_response,
 			       struct lte_lc_cells_info *cells)
 {
 	struct at_parser parser;
-	struct lte_lc_ncell *ncells = NULL;
-	int err, status, tmp_int, len;
+	struct lte_lc_ncellmeas_storage *storage;
+	int err, status, tmp_int;
+	size_t len;
 	int16_t tmp_short;
 	char tmp_str[7];
 	bool incomplete = false;
 	int curr_index;
 	size_t i = 0, j = 0, k = 0;
 
-	/* Count the actual number of parameters in the AT response before
-	 * allocating heap for it. This may save quite a bit of heap as the
-	 * worst case scenario is 96 elements.
-	 * 3 is added to account for the parameters that do not have a trailing
-	 * comma.
-	 */
-	size_t param_count = get_char_frequency(at_response, ',') + 3;
-
 	__ASSERT_NO_MSG(at_response != NULL);
 	__ASSERT_NO_MSG(params != NULL);
+	__ASSERT_NO_MSG(params->storage != NULL);
+	__ASSERT_NO_MSG(params->storage->gci_cells != NULL);
 	__ASSERT_NO_MSG(cells != NULL);
-	__ASSERT_NO_MSG(cells->gci_cells != NULL);
+
+	storage = params->storage;
 
 	/* Fill the defaults */
+	cells->gci_cells = storage->gci_cells;
 	cells->gci_cells_count = 0;
+	cells->neighbor_cells = storage->neighbor_cells;
 	cells->ncells_count = 0;
 	cells->current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID;
 
@@ -148,6 +167,9 @@ static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const cha
 	 *		<meas_time>,<serving>,<neighbor_count>
 	 *	[,<n_earfcn1>,<n_phys_cell_id1>,<n_rsrp1>,<n_rsrq1>,<time_diff1>]
 	 *	[,<n_earfcn2>,<n_phys_cell_id2>,<n_rsrp2>,<n_rsrq2>,<time_diff2>]...]...
+	 *
+	 * The number of cells is not known in advance. The parameters are read in a single pass
+	 * with increasing indices until the end of the response is reached.
 	 */
 
 	err = at_parser_init(&parser, at_response);
@@ -167,16 +189,10 @@ static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const cha
 		goto clean_exit;
 	} else if (status == AT_NCELLMEAS_STATUS_VALUE_INCOMPLETE) {
 		LOG_WRN("NCELLMEAS interrupted; results incomplete");
-		if (param_count == 3) {
-			/* No results, skip parsing. */
-			goto clean_exit;
-		}
 	}
 
 	/* Go through the cells */
-	for (i = 0; curr_index < (param_count - (AT_NCELLMEAS_GCI_CELL_PARAMS_COUNT + 1)) &&
-		    i < params->gci_count;
-	     i++) {
+	for (i = 0; i < params->gci_count; i++) {
 		struct lte_lc_cell parsed_cell;
 		bool is_serving_cell;
 		uint8_t parsed_ncells_count;
@@ -184,7 +200,11 @@ static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const cha
 		/* <cell_id>  */
 		curr_index++;
 		err = string_param_to_int(&parser, curr_index, &tmp_int, 16);
-		if (err) {
+		if (is_end_of_params(err)) {
+			/* No more cells. */
+			err = 0;
+			break;
+		} else if (err) {
 			LOG_ERR("Could not parse cell_id, index %d, i %d error: %d", curr_index, i,
 				err);
 			goto clean_exit;
@@ -320,25 +340,16 @@ static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const cha
 			 */
 			cells->current_cell = parsed_cell;
 			if (parsed_ncells_count != 0) {
-				/* Allocate room for the parsed neighbor info. */
-				if (parsed_ncells_count > CONFIG_LTE_NEIGHBOR_CELLS_MAX) {
-					to_be_parsed_ncell_count = CONFIG_LTE_NEIGHBOR_CELLS_MAX;
+				if (parsed_ncells_count > storage->neighbor_cells_len) {
+					to_be_parsed_ncell_count = storage->neighbor_cells_len;
 					incomplete = true;
 					LOG_WRN("Cutting response, because received neigbor cell"
-						" count is bigger than configured max: %d",
-						CONFIG_LTE_NEIGHBOR_CELLS_MAX);
+						" count is bigger than the storage: %d",
+						storage->neighbor_cells_len);
 
 				} else {
 					to_be_parsed_ncell_count = parsed_ncells_count;
 				}
-				ncells = k_calloc(to_be_parsed_ncell_count,
-						  sizeof(struct lte_lc_ncell));
-				if (ncells == NULL) {
-					LOG_WRN("Failed to allocate memory for the ncells"
-						" (continue)");
-					continue;
-				}
-				cells->neighbor_cells = ncells;
 				cells->ncells_count = to_be_parsed_ncell_count;
 			}
 
@@ -349,7 +360,7 @@ static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const cha
 				 */
 				if (j >= to_be_parsed_ncell_count) {
 					LOG_WRN("Ignoring ncell");
-					curr_index += 5;
+					curr_index += AT_NCELLMEAS_N_PARAMS_COUNT;
 					continue;
 				}
 				/* <n_earfcn[j]> */
@@ -362,40 +373,21 @@ static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const cha
 				}
 
 				/* <n_phys_cell_id[j]> */
-				curr_index++;
-				err = at_parser_num_get(&parser, curr_index,
+				err = at_parser_num_get(&parser,
+							curr_index + AT_NCELLMEAS_N_PHYS_CELL_ID_INDEX,
 							&cells->neighbor_cells[j].phys_cell_id);
 				if (err) {
 					LOG_ERR("Could not parse n_phys_cell_id, error: %d", err);
 					goto clean_exit;
 				}
 
-				/* <n_rsrp[j]> */
-				curr_index++;
-				err = at_parser_num_get(&parser, curr_index, &tmp_int);
+				/* <n_rsrp[j]>,<n_rsrq[j]>,<time_diff[j]> */
+				err = parse_ncell_meas(&parser, curr_index, &cells->neighbor_cells[j]);
 				if (err) {
-					LOG_ERR("Could not parse n_rsrp, error: %d", err);
 					goto clean_exit;
 				}
-				cells->neighbor_cells[j].rsrp = tmp_int;
 
-				/* <n_rsrq[j]> */
-				curr_index++;
-				err = at_parser_num_get(&parser, curr_index, &tmp_int);
-				if (err) {
-					LOG_ERR("Could not parse n_rsrq, error: %d", err);
-					goto clean_exit;
-				}
-				cells->neighbor_cells[j].rsrq = tmp_int;
-
-				/* <time_diff[j]> */
-				curr_index++;
-				err = at_parser_num_get(&parser, curr_index,
-							&cells->neighbor_cells[j].time_diff);
-				if (err) {
-					LOG_ERR("Could not parse time_diff, error: %d", err);
-					goto clean_exit;
-				}
+				curr_index += AT_NCELLMEAS_N_PARAMS_COUNT - 1;
 			}
 		} else {
 			cells->gci_cells[k] = parsed_cell;
@@ -413,30 +405,25 @@ clean_exit:
 	return err;
 }
 
-static int parse_ncellmeas(const char *at_response, struct lte_lc_cells_info *cells)
+static int parse_ncellmeas(struct lte_lc_ncellmeas_storage *storage, const char *at_response,
+			   struct lte_lc_cells_info *cells)
 {
 	int err, status, tmp;
 	struct at_parser parser;
-	size_t count = 0;
+	size_t start_idx;
 	bool incomplete = false;
 
+	__ASSERT_NO_MSG(storage != NULL);
 	__ASSERT_NO_MSG(at_response != NULL);
 	__ASSERT_NO_MSG(cells != NULL);
 
+	cells->neighbor_cells = storage->neighbor_cells;
 	cells->ncells_count = 0;
 	cells->current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID;
 
 	err = at_parser_init(&parser, at_response);
 	__ASSERT_NO_MSG(err == 0);
 
-	err = at_parser_cmd_count_get(&parser, &count);
-	if (err) {
-		LOG_ERR("Could not get NCELLMEAS param count, "
-			"potentially malformed notification, error: %d",
-			err);
-		goto clean_exit;
-	}
-
 	/* Status code */
 	err = at_parser_num_get(&parser, AT_NCELLMEAS_STATUS_INDEX, &status);
 	if (err) {
@@ -449,15 +436,15 @@ static int parse_ncellmeas(const char *at_response, struct lte_lc_cells_info *ce
 		goto clean_exit;
 	} else if (status == AT_NCELLMEAS_STATUS_VALUE_INCOMPLETE) {
 		LOG_WRN("NCELLMEAS interrupted; results incomplete");
-		if (count == 2) {
-			/* No results, skip parsing. */
-			goto clean_exit;
-		}
 	}
 
 	/* Current cell ID */
 	err = string_param_to_int(&parser, AT_NCELLMEAS_CELL_ID_INDEX, &tmp, 16);
-	if (err) {
+	if (status == AT_NCELLMEAS_STATUS_VALUE_INCOMPLETE && is_end_of_params(err)) {
+		/* No results, skip parsing. */
+		err = 0;
+		goto clean_exit;
+	} else if (err) {
 		goto clean_exit;
 	}
 
@@ -525,83 +512,70 @@ static int parse_ncellmeas(const char *at_response, struct lte_lc_cells_info *ce
 		goto clean_exit;
 	}
 
-	/* Neighbor cell count */
-	cells->ncells_count = neighborcell_count_get(at_response);
-
-	/* Starting from modem firmware v1.3.1, timing advance measurement time
-	 * information is added as the last parameter in the response.
+	/* Neighboring cells. The neighbor cell count is not given in the response, so the end of
+	 * the list is found while parsing. Starting from modem firmware v1.3.1, timing advance
+	 * measurement time information is added as the last parameter in the response, so a
+	 * parameter that is not followed by the parameters of a neighbor cell is the timing
+	 * advance measurement time.
 	 */
-	size_t ta_meas_time_index = AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT +
-				    cells->ncells_count * AT_NCELLMEAS_N_PARAMS_COUNT;
-
-	if (count > ta_meas_time_index) {
-		err = at_parser_num_get(&parser, ta_meas_time_index,
-					&cells->current_cell.timing_advance_meas_time);
-		if (err) {
+	cells->current_cell.timing_advance_meas_time = 0;
+	start_idx = AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT;
+
+	while (true) {
+		struct lte_lc_ncell ignored_ncell;
+		struct lte_lc_ncell *ncell = &ignored_ncell;
+		uint64_t value;
+
+		/* EARFCN, or timing advance measurement time */
+		err = at_parser_num_get(&parser, start_idx + AT_NCELLMEAS_N_EARFCN_INDEX, &value);
+		if (is_end_of_params(err)) {
+			err = 0;
+			break;
+		} else if (err) {
 			goto clean_exit;
 		}
-	} else {
-		cells->current_cell.timing_advance_meas_time = 0;
-	}
-
-	if (cells->ncells_count == 0) {
-		goto clean_exit;
-	}
-
-	__ASSERT_NO_MSG(cells->neighbor_cells != NULL);
 
-	if (cells->ncells_count > CONFIG_LTE_NEIGHBOR_CELLS_MAX) {
-		cells->ncells_count = CONFIG_LTE_NEIGHBOR_CELLS_MAX;
-		incomplete = true;
-		LOG_WRN("Cutting response, because received neigbor cell"
-			" count is bigger than configured max: %d",
-			CONFIG_LTE_NEIGHBOR_CELLS_MAX);
-	}
-
-	/* Neighboring cells */
-	for (size_t i = 0; i < cells->ncells_count; i++) {
-		size_t start_idx =
-			AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT + i * AT_NCELLMEAS_N_PARAMS_COUNT;
-
-		/* EARFCN */
-		err = at_parser_num_get(&parser, start_idx + AT_NCELLMEAS_N_EARFCN_INDEX,
-					&cells->neighbor_cells[i].earfcn);
-		if (err) {
-			goto clean_exit;
+		if (cells->ncells_count < storage->neighbor_cells_len) {
+			ncell = &cells->neighbor_cells[cells->ncells_count];
 		}
 
 		/* Physical cell ID */
 		err = at_parser_num_get(&parser, start_idx + AT_NCELLMEAS_N_PHYS_CELL_ID_INDEX,
-					&cells->neighbor_cells[i].phys_cell_id);
-		if (err) {
+					&ncell->phys_cell_id);
+		if (is_end_of_params(err)) {
+			cells->current_cell.timing_advance_meas_time = value;
+			err = 0;
+			break;
+		} else if (err) {
 			goto clean_exit;
 		}
 
-		/* RSRP */
-		err = at_parser_num_get(&parser, start_idx + AT_NCELLMEAS_N_RSRP_INDEX, &tmp);
+		/* RSRP, RSRQ and time difference */
+		err = parse_ncell_meas(&parser, start_idx, ncell);
 		if (err) {
 			goto clean_exit;
 		}
 
-		cells->neighbor_cells[i].rsrp = tmp;
-
-		/* RSRQ */
-		err = at_parser_num_get(&parser, start_idx + AT_NCELLMEAS_N_RSRQ_INDEX, &tmp);
-		if (err) {
+		if (value > UINT32_MAX) {
+			err = -ERANGE;
 			goto clean_exit;
 		}
 
-		cells->neighbor_cells[i].rsrq = tmp;
+		ncell->earfcn = value;
 
-		/* Time difference */
-		err = at_parser_num_get(&parser, start_idx + AT_NCELLMEAS_N_TIME_DIFF_INDEX,
-					&cells->neighbor_cells[i].time_diff);
-		if (err) {
-			goto clean_exit;
+		if (ncell == &ignored_ncell) {
+			incomplete = true;
+		} else {
+			cells->ncells_count++;
 		}
+
+		start_idx += AT_NCELLMEAS_N_PARAMS_COUNT;
 	}
 
 	if (incomplete) {
+		LOG_WRN("Cutting response, because received neigbor cell"
+			" count is bigger than the storage: %d",
+			storage->neighbor_cells_len);
 		err = -E2BIG;
 		LOG_WRN("Buffer is too small; results incomplete: %d", err);
 	}
@@ -625,29 +599,19 @@ static void at_handler_ncellmeas_gci(const char *response)
 {
 	int err;
 	struct lte_lc_evt evt = {0};
-	const char *resp = response;
-	struct lte_lc_cell *cells = NULL;
 
 	__ASSERT_NO_MSG(response != NULL);
 	__ASSERT_NO_MSG(ncellmeas_params.gci_count != 0);
 
 	LOG_DBG("%%NCELLMEAS GCI notification parsing starts");
 
-	cells = k_calloc(ncellmeas_params.gci_count, sizeof(struct lte_lc_cell));
-	if (cells == NULL) {
-		LOG_ERR("Failed to allocate memory for the GCI cells");
-		ncellmeas_empty_event_dispatch();
-		return;
-	}
-
-	evt.cells_info.gci_cells = cells;
-	err = parse_ncellmeas_gci(&ncellmeas_params, resp, &evt.cells_info);
+	err = parse_ncellmeas_gci(&ncellmeas_params, response, &evt.cells_info);
 	LOG_DBG("parse_ncellmeas_gci returned %d", err);
 	switch (err) {
 	case -E2BIG:
 		LOG_WRN("Not all neighbor cells could be parsed. "
-			"More cells than the configured max count of %d were found",
-			CONFIG_LTE_NEIGHBOR_CELLS_MAX);
+			"More cells than the storage for %d cells were found",
+			ncellmeas_params.storage->neighbor_cells_len);
 		/* Fall through */
 	case 0: /* Fall through */
 	case 1:
@@ -661,9 +625,6 @@ static void at_handler_ncellmeas_gci(const char *response)
 		ncellmeas_empty_event_dispatch();
 		break;
 	}
-
-	k_free(cells);
-	k_free(evt.cells_info.neighbor_cells);
 }
 
 static void ncellmeas_cancel_timeout_work_fn(struct k_work *work)
@@ -708,29 +669,15 @@ static void at_handler_ncellmeas(const char *response)
 		goto exit;
 	}
 
-	int ncell_count = neighborcell_count_get(response);
-	struct lte_lc_ncell *neighbor_cells = NULL;
+	err = parse_ncellmeas(ncellmeas_params.storage, response, &evt.cells_info);
 
-	LOG_DBG("%%NCELLMEAS notification: neighbor cell count: %d", ncell_count);
-
-	if (ncell_count != 0) {
-		neighbor_cells = k_calloc(ncell_count, sizeof(struct lte_lc_ncell));
-		if (neighbor_cells == NULL) {
-			LOG_ERR("Failed to allocate memory for neighbor cells");
-			ncellmeas_empty_event_dispatch();
-			goto exit;
-		}
-	}
-
-	evt.cells_info.neighbor_cells = neighbor_cells;
-
-	err = parse_ncellmeas(response, &evt.cells_info);
+	LOG_DBG("%%NCELLMEAS notification: neighbor cell count: %d", evt.cells_info.ncells_count);
 
 	switch (err) {
 	case -E2BIG:
 		LOG_WRN("Not all neighbor cells could be parsed");
-		LOG_WRN("More cells than the configured max count of %d were found",
-			CONFIG_LTE_NEIGHBOR_CELLS_MAX);
+		LOG_WRN("More cells than the storage for %d cells were found",
+			ncellmeas_params.storage->neighbor_cells_len);
 		/* Fall through */
 	case 0: /* Fall through */
 	case 1:
@@ -743,9 +690,6 @@ static void at_handler_ncellmeas(const char *response)
 		break;
 	}
 
-	if (neighbor_cells) {
-		k_free(neighbor_cells);
-	}
 exit:
 	k_sem_give(&ncellmeas_idle_sem);
 }
@@ -758,6 +702,7 @@ int ncellmeas_start(struct lte_lc_ncellmeas_params *params)
 		.search_type = LTE_LC_NEIGHBOR_SEARCH_TYPE_DEFAULT,
 		.gci_count = 0,
 	};
+	bool gci_search = false;
 
 	if (params == NULL) {
 		LOG_DBG("Using default parameters");
@@ -774,10 +719,33 @@ int ncellmeas_start(struct lte_lc_ncellmeas_params *params)
 	    (params->search_type == LTE_LC_NEIGHBOR_SEARCH_TYPE_GCI_DEFAULT ||
 	     params->search_type == LTE_LC_NEIGHBOR_SEARCH_TYPE_GCI_EXTENDED_LIGHT ||
 	     params->search_type == LTE_LC_NEIGHBOR_SEARCH_TYPE_GCI_EXTENDED_COMPLETE)) {
-		if (params->gci_count < 2 || params->gci_count > 15) {
-			LOG_ERR("Invalid GCI count, must be in range 2-15");
+		if (params->gci_count < 2 || params->gci_count > LTE_LC_NCELLMEAS_GCI_COUNT_MAX) {
+			LOG_ERR("Invalid GCI count, must be in range 2-%d",
+				LTE_LC_NCELLMEAS_GCI_COUNT_MAX);
 			return -EINVAL;
 		}
+		gci_search = true;
+	}
+
+	if (params != NULL) {
+		used_params = *params;
+	}
+
+	if (used_params.storage == NULL) {
+#if defined(CONFIG_LTE_LC_NEIGHBOR_CELL_MEAS_STORAGE)
+		used_params.storage = &ncellmeas_storage;
+#else
+		LOG_ERR("No storage for the measurement results");
+		return -EINVAL;
+#endif /* CONFIG_LTE_LC_NEIGHBOR_CELL_MEAS_STORAGE */
+	}
+
+	if ((used_params.storage->neighbor_cells == NULL &&
+	     used_params.storage->neighbor_cells_len != 0) ||
+	    (gci_search && (used_params.storage->gci_cells == NULL ||
+			    used_params.storage->gci_cells_len < used_params.gci_count))) {
+		LOG_ERR("Invalid storage for the measurement results");
+		return -EINVAL;
 	}
 
 	if (k_sem_take(&ncellmeas_idle_sem, K_SECONDS(1)) != 0) {
@@ -785,9 +753,6 @@ int ncellmeas_start(struct lte_lc_ncellmeas_params *params)
 		return -EINPROGRESS;
 	}
 
-	if (params != NULL) {
-		used_params = *params;
-	}
 	ncellmeas_params = used_params;
 
 	/* Starting from modem firmware v1.3.1, there is an optional parameter to specify
@@ -11,6 +11,7 @@
 #include <zephyr/device.h>
 #include <errno.h>
 #include <modem/modem_info.h>
+#include <modem/nrf_modem_lib.h>
 #include <nrf_errno.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/toolchain.h>
@@ -21,6 +22,8 @@
 #include <zephyr/types.h>
 #include <zephyr/logging/log.h>
 
+#include "modem_info_internal.h"
+
 LOG_MODULE_REGISTER(modem_info, CONFIG_MODEM_INFO_LOG_LEVEL);
 
 #define INVALID_DESCRIPTOR	-1
@@ -150,8 +153,62 @@ LOG_MODULE_REGISTER(modem_info, CONFIG_MODEM_INFO_LOG_LEVEL);
 BUILD_ASSERT(SHORT_OP_NAME_SIZE_WITHOUT_NULL_TERM == (MODEM_INFO_SHORT_OP_NAME_SIZE - 1),
 	     "Short operator size macros must match");
 
+/* AT commands that modem information is read from */
+enum info_cmd {
+	CMD_CESQ,
+	CMD_CURRENT_BAND,
+	CMD_SUPPORTED_BAND,
+	CMD_CURRENT_MODE,
+	CMD_CURRENT_OP,
+	CMD_NETWORK_STATUS,
+	CMD_PDP_CONTEXT,
+	CMD_UICC_STATE,
+	CMD_VBAT,
+	CMD_TEMP,
+	CMD_FW_VERSION,
+	CMD_ICCID,
+	CMD_SYSTEMMODE,
+	CMD_IMSI,
+	CMD_IMEI,
+	CMD_DATE_TIME,
+	CMD_COUNT,
+};
+
+struct modem_info_cmd {
+	const char *at;
+	/* Time the response is cached in milliseconds, SYS_FOREVER_MS until invalidated */
+	int32_t ttl;
+};
+
+#if defined(CONFIG_MODEM_INFO_CACHE)
+#define NETWORK_TTL	(CONFIG_MODEM_INFO_CACHE_NETWORK_TTL * MSEC_PER_SEC)
+#define SIGNAL_TTL	(CONFIG_MODEM_INFO_CACHE_SIGNAL_TTL * MSEC_PER_SEC)
+#else
+#define NETWORK_TTL	0
+#define SIGNAL_TTL	0
+#endif
+
+static const struct modem_info_cmd info_cmds[] = {
+	[CMD_CESQ]		= { AT_CMD_CESQ, SIGNAL_TTL },
+	[CMD_CURRENT_BAND]	= { AT_CMD_CURRENT_BAND, NETWORK_TTL },
+	[CMD_SUPPORTED_BAND]	= { AT_CMD_SUPPORTED_BAND, SYS_FOREVER_MS },
+	[CMD_CURRENT_MODE]	= { AT_CMD_CURRENT_MODE, NETWORK_TTL },
+	[CMD_CURRENT_OP]	= { AT_CMD_CURRENT_OP, NETWORK_TTL },
+	[CMD_NETWORK_STATUS]	= { AT_CMD_NETWORK_STATUS, NETWORK_TTL },
+	[CMD_PDP_CONTEXT]	= { AT_CMD_PDP_CONTEXT, NETWORK_TTL },
+	[CMD_UICC_STATE]	= { AT_CMD_UICC_STATE, NETWORK_TTL },
+	[CMD_VBAT]		= { AT_CMD_VBAT, SIGNAL_TTL },
+	[CMD_TEMP]		= { AT_CMD_TEMP, SIGNAL_TTL },
+	[CMD_FW_VERSION]	= { AT_CMD_FW_VERSION, SYS_FOREVER_MS },
+	[CMD_ICCID]		= { AT_CMD_ICCID, SYS_FOREVER_MS },
+	[CMD_SYSTEMMODE]	= { AT_CMD_SYSTEMMODE, NETWORK_TTL },
+	[CMD_IMSI]		= { AT_CMD_IMSI, SYS_FOREVER_MS },
+	[CMD_IMEI]		= { AT_CMD_IMEI, SYS_FOREVER_MS },
+	[CMD_DATE_TIME]		= { AT_CMD_DATE_TIME, 0 },
+};
+
 struct modem_info_data {
-	const char *cmd;
+	enum info_cmd cmd;
 	const char *data_name;
 	uint8_t param_index;
 	uint8_t param_count;
@@ -159,7 +216,7 @@ struct modem_info_data {
 };
 
 static const struct modem_info_data rsrp_data = {
-	.cmd		= AT_CMD_CESQ,
+	.cmd		= CMD_CESQ,
 	.data_name	= RSRP_DATA_NAME,
 	.param_index	= RSRP_PARAM_INDEX,
 	.param_count	= RSRP_PARAM_COUNT,
@@ -167,7 +224,7 @@ static const struct modem_info_data rsrp_data = {
 };
 
 static const struct modem_info_data band_data = {
-	.cmd		= AT_CMD_CURRENT_BAND,
+	.cmd		= CMD_CURRENT_BAND,
 	.data_name	= CUR_BAND_DATA_NAME,
 	.param_index	= BAND_PARAM_INDEX,
 	.param_count	= BAND_PARAM_COUNT,
@@ -175,7 +232,7 @@ static const struct modem_info_data band_data = {
 };
 
 static const struct modem_info_data band_sup_data = {
-	.cmd		= AT_CMD_SUPPORTED_BAND,
+	.cmd		= CMD_SUPPORTED_BAND,
 	.data_name	= SUP_BAND_DATA_NAME,
 	.param_index	= BAND_PARAM_INDEX,
 	.param_count	= BAND_PARAM_COUNT,
@@ -183,7 +240,7 @@ static const struct modem_info_data band_sup_data = {
 };
 
 static const struct modem_info_data mode_data = {
-	.cmd		= AT_CMD_CURRENT_MODE,
+	.cmd		= CMD_CURRENT_MODE,
 	.data_name	= UE_MODE_DATA_NAME,
 	.param_index	= MODE_PARAM_INDEX,
 	.param_count	= MODE_PARAM_COUNT,
@@ -191,7 +248,7 @@ static const struct modem_info_data mode_data = {
 };
 
 static const struct modem_info_data operator_data = {
-	.cmd		= AT_CMD_CURRENT_OP,
+	.cmd		= CMD_CURRENT_OP,
 	.data_name	= OPERATOR_DATA_NAME,
 	.param_index	= OPERATOR_PARAM_INDEX,
 	.param_count	= OPERATOR_PARAM_COUNT,
@@ -199,7 +256,7 @@ static const struct modem_info_data operator_data = {
 };
 
 static const struct modem_info_data mcc_data = {
-	.cmd		= AT_CMD_CURRENT_OP,
+	.cmd		= CMD_CURRENT_OP,
 	.data_name	= MCC_DATA_NAME,
 	.param_index	= OPERATOR_PARAM_INDEX,
 	.param_count	= OPERATOR_PARAM_COUNT,
@@ -207,7 +264,7 @@ static const struct modem_info_data mcc_data = {
 };
 
 static const struct modem_info_data mnc_data = {
-	.cmd		= AT_CMD_CURRENT_OP,
+	.cmd		= CMD_CURRENT_OP,
 	.data_name	= MNC_DATA_NAME,
 	.param_index	= OPERATOR_PARAM_INDEX,
 	.param_count	= OPERATOR_PARAM_COUNT,
@@ -215,7 +272,7 @@ static const struct modem_info_data mnc_data = {
 };
 
 static const struct modem_info_data cellid_data = {
-	.cmd		= AT_CMD_NETWORK_STATUS,
+	.cmd		= CMD_NETWORK_STATUS,
 	.data_name	= CELLID_DATA_NAME,
 	.param_index	= CELLID_PARAM_INDEX,
 	.param_count	= CELLID_PARAM_COUNT,
@@ -223,7 +280,7 @@ static const struct modem_info_data cellid_data = {
 };
 
 static const struct modem_info_data area_data = {
-	.cmd		= AT_CMD_NETWORK_STATUS,
+	.cmd		= CMD_NETWORK_STATUS,
 	.data_name	= AREA_CODE_DATA_NAME,
 	.param_index	= AREA_CODE_PARAM_INDEX,
 	.param_count	= AREA_CODE_PARAM_COUNT,
@@ -231,7 +288,7 @@ static const struct modem_info_data area_data = {
 };
 
 static const struct modem_info_data ip_data = {
-	.cmd		= AT_CMD_PDP_CONTEXT,
+	.cmd		= CMD_PDP_CONTEXT,
 	.data_name	= IP_ADDRESS_DATA_NAME,
 	.param_index	= IP_ADDRESS_PARAM_INDEX,
 	.param_count	= IP_ADDRESS_PARAM_COUNT,
@@ -239,7 +296,7 @@ static const struct modem_info_data ip_data = {
 };
 
 static const struct modem_info_data uicc_data = {
-	.cmd		= AT_CMD_UICC_STATE,
+	.cmd		= CMD_UICC_STATE,
 	.data_name	= UICC_DATA_NAME,
 	.param_index	= UICC_PARAM_INDEX,
 	.param_count	= UICC_PARAM_COUNT,
@@ -247,7 +304,7 @@ static const struct modem_info_data uicc_data = {
 };
 
 static const struct modem_info_data battery_data = {
-	.cmd		= AT_CMD_VBAT,
+	.cmd		= CMD_VBAT,
 	.data_name	= BATTERY_DATA_NAME,
 	.param_index	= VBAT_PARAM_INDEX,
 	.param_count	= VBAT_PARAM_COUNT,
@@ -255,7 +312,7 @@ static const struct modem_info_data battery_data = {
 };
 
 static const struct modem_info_data temp_data = {
-	.cmd		= AT_CMD_TEMP,
+	.cmd		= CMD_TEMP,
 	.data_name	= TEMPERATURE_DATA_NAME,
 	.param_index	= TEMP_PARAM_INDEX,
 	.param_count	= TEMP_PARAM_COUNT,
@@ -263,7 +320,7 @@ static const struct modem_info_data temp_data = {
 };
 
 static const struct modem_info_data fw_data = {
-	.cmd		= AT_CMD_FW_VERSION,
+	.cmd		= CMD_FW_VERSION,
 	.data_name	= MODEM_FW_DATA_NAME,
 	.param_index	= MODEM_FW_PARAM_INDEX,
 	.param_count	= MODEM_FW_PARAM_COUNT,
@@ -271,7 +328,7 @@ static const struct modem_info_data fw_data = {
 };
 
 static const struct modem_info_data iccid_data = {
-	.cmd		= AT_CMD_ICCID,
+	.cmd		= CMD_ICCID,
 	.data_name	= ICCID_DATA_NAME,
 	.param_index	= ICCID_PARAM_INDEX,
 	.param_count	= ICCID_PARAM_COUNT,
@@ -279,7 +336,7 @@ static const struct modem_info_data iccid_data = {
 };
 
 static const struct modem_info_data lte_mode_data = {
-	.cmd		= AT_CMD_SYSTEMMODE,
+	.cmd		= CMD_SYSTEMMODE,
 	.data_name	= LTE_MODE_DATA_NAME,
 	.param_index	= LTE_MODE_PARAM_INDEX,
 	.param_count	= SYSTEMMODE_PARAM_COUNT,
@@ -287,7 +344,7 @@ static const struct modem_info_data lte_mode_data = {
 };
 
 static const struct modem_info_data nbiot_mode_data = {
-	.cmd		= AT_CMD_SYSTEMMODE,
+	.cmd		= CMD_SYSTEMMODE,
 	.data_name	= NBIOT_MODE_DATA_NAME,
 	.param_index	= NBIOT_MODE_PARAM_INDEX,
 	.param_count	= SYSTEMMODE_PARAM_COUNT,
@@ -295,7 +352,7 @@ static const struct modem_info_data nbiot_mode_data = {
 };
 
 static const struct modem_info_data gps_mode_data = {
-	.cmd		= AT_CMD_SYSTEMMODE,
+	.cmd		= CMD_SYSTEMMODE,
 	.data_name	= GPS_MODE_DATA_NAME,
 	.param_index	= GPS_MODE_PARAM_INDEX,
 	.param_count	= SYSTEMMODE_PARAM_COUNT,
@@ -303,7 +360,7 @@ static const struct modem_info_data gps_mode_data = {
 };
 
 static const struct modem_info_data imsi_data = {
-	.cmd		= AT_CMD_IMSI,
+	.cmd		= CMD_IMSI,
 	.data_name	= IMSI_DATA_NAME,
 	.param_index	= IMSI_PARAM_INDEX,
 	.param_count	= IMSI_PARAM_COUNT,
@@ -311,7 +368,7 @@ static const struct modem_info_data imsi_data = {
 };
 
 static const struct modem_info_data imei_data = {
-	.cmd		= AT_CMD_IMEI,
+	.cmd		= CMD_IMEI,
 	.data_name	= MODEM_IMEI_DATA_NAME,
 	.param_index	= MODEM_IMEI_PARAM_INDEX,
 	.param_count	= MODEM_IMEI_PARAM_COUNT,
@@ -319,7 +376,7 @@ static const struct modem_info_data imei_data = {
 };
 
 static const struct modem_info_data date_time_data = {
-	.cmd		= AT_CMD_DATE_TIME,
+	.cmd		= CMD_DATE_TIME,
 	.data_name	= DATE_TIME_DATA_NAME,
 	.param_index	= DATE_TIME_PARAM_INDEX,
 	.param_count	= DATE_TIME_PARAM_COUNT,
@@ -327,7 +384,7 @@ static const struct modem_info_data date_time_data = {
 };
 
 static const struct modem_info_data apn_data = {
-	.cmd		= AT_CMD_PDP_CONTEXT,
+	.cmd		= CMD_PDP_CONTEXT,
 	.data_name	= APN_DATA_NAME,
 	.param_index	= APN_PARAM_INDEX,
 	.param_count	= APN_PARAM_COUNT,
@@ -361,6 +418,35 @@ static const struct modem_info_data *const modem_data[] = {
 
 AT_MONITOR(modem_info_cesq_mon, "%CESQ", modem_info_rsrp_subscribe_handler, PAUSED);
 
+#if defined(CONFIG_MODEM_INFO_CACHE)
+/* Commands whose responses change with the notifications or the functional mode */
+#define CACHE_NETWORK_CMDS							\
+	(BIT(CMD_NETWORK_STATUS) | BIT(CMD_CURRENT_BAND) | BIT(CMD_CURRENT_OP) |	\
+	 BIT(CMD_CESQ))
+#define CACHE_PDN_CMDS	BIT(CMD_PDP_CONTEXT)
+#define CACHE_SIM_CMDS	(BIT(CMD_UICC_STATE) | BIT(CMD_ICCID) | BIT(CMD_IMSI))
+#define CACHE_CFUN_CMDS								\
+	(CACHE_NETWORK_CMDS | CACHE_PDN_CMDS | CACHE_SIM_CMDS |			\
+	 BIT(CMD_CURRENT_MODE) | BIT(CMD_SYSTEMMODE))
+
+BUILD_ASSERT(CMD_COUNT <= 32);
+
+static K_MUTEX_DEFINE(cache_lock);
+static char cache_rsp[CMD_COUNT][CONFIG_MODEM_INFO_BUFFER_SIZE];
+static int64_t cache_updated[CMD_COUNT];
+static uint32_t cache_valid;
+/* Set from the notification ISR, applied to cache_valid on lookup */
+static atomic_t cache_stale;
+
+AT_MONITOR_ISR(modem_info_cereg_mon, "+CEREG", cache_network_invalidate);
+AT_MONITOR_ISR(modem_info_cgev_mon, "+CGEV", cache_pdn_invalidate);
+AT_MONITOR_ISR(modem_info_xsim_mon, "%XSIM", cache_sim_invalidate);
+NRF_MODEM_LIB_ON_CFUN(modem_info_cfun_hook, cache_on_modem_cfun, NULL);
+#if !defined(CONFIG_UNITY)
+NRF_MODEM_LIB_ON_INIT(modem_info_init_hook, cache_on_modem_init, NULL);
+#endif
+#endif /* CONFIG_MODEM_INFO_CACHE */
+
 static rsrp_cb_t modem_info_rsrp_cb;
 
 static void flip_iccid_string(char *buf)
@@ -424,26 +510,133 @@ int modem_info_name_get(enum modem_info info, char *name)
 	return len;
 }
 
-int modem_info_short_get(enum modem_info info, uint16_t *buf)
+#if defined(CONFIG_MODEM_INFO_CACHE)
+static bool cache_get(enum info_cmd cmd, char *buf)
 {
-	int err;
-	char recv_buf[CONFIG_MODEM_INFO_BUFFER_SIZE] = {0};
-	struct at_parser parser;
+	int32_t ttl = info_cmds[cmd].ttl;
+	bool hit;
 
-	if (buf == NULL) {
-		return -EINVAL;
+	if (ttl == 0) {
+		return false;
 	}
 
-	if (modem_data[info]->data_type == MODEM_INFO_DATA_TYPE_STRING) {
-		return -EINVAL;
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	cache_valid &= ~atomic_clear(&cache_stale);
+
+	hit = (cache_valid & BIT(cmd)) &&
+	      (ttl == SYS_FOREVER_MS || k_uptime_get() - cache_updated[cmd] < ttl);
+	if (hit) {
+		strcpy(buf, cache_rsp[cmd]);
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return hit;
+}
+
+static void cache_put(enum info_cmd cmd, const char *buf)
+{
+	if (info_cmds[cmd].ttl == 0) {
+		return;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	strcpy(cache_rsp[cmd], buf);
+	cache_updated[cmd] = k_uptime_get();
+	/* If a notification invalidates the response while the command is in progress,
+	 * the stale bit is applied on the next lookup.
+	 */
+	cache_valid |= BIT(cmd);
+
+	k_mutex_unlock(&cache_lock);
+}
+
+static void cache_invalidate(atomic_val_t cmds)
+{
+	atomic_or(&cache_stale, cmds);
+}
+
+static void cache_network_invalidate(const char *notif)
+{
+	ARG_UNUSED(notif);
+
+	cache_invalidate(CACHE_NETWORK_CMDS);
+}
+
+static void cache_pdn_invalidate(const char *notif)
+{
+	ARG_UNUSED(notif);
+
+	cache_invalidate(CACHE_PDN_CMDS);
+}
+
+static void cache_sim_invalidate(const char *notif)
+{
+	ARG_UNUSED(notif);
+
+	cache_invalidate(CACHE_SIM_CMDS);
+}
+
+static void cache_on_modem_cfun(int mode, void *ctx)
+{
+	ARG_UNUSED(mode);
+	ARG_UNUSED(ctx);
+
+	cache_invalidate(CACHE_CFUN_CMDS);
+}
+
+#if defined(CONFIG_UNITY)
+void cache_on_modem_init(int ret, void *ctx)
+#else
+static void cache_on_modem_init(int ret, void *ctx)
+#endif
+{
+	ARG_UNUSED(ret);
+	ARG_UNUSED(ctx);
+
+	/* The modem firmware may have been updated, so nothing cached is valid */
+	cache_invalidate(BIT_MASK(CMD_COUNT));
+}
+#endif /* CONFIG_MODEM_INFO_CACHE */
+
+void modem_info_cache_clear(void)
+{
+#if defined(CONFIG_MODEM_INFO_CACHE)
+	cache_invalidate(BIT_MASK(CMD_COUNT));
+#endif
+}
+
+/* Read the response of an AT command, from the cache if possible */
+static int cmd_response_get(enum info_cmd cmd, char *buf)
+{
+	int err;
+
+#if defined(CONFIG_MODEM_INFO_CACHE)
+	if (cache_get(cmd, buf)) {
+		LOG_DBG("%s: cached", info_cmds[cmd].at);
+		return 0;
 	}
+#endif
 
-	err = nrf_modem_at_cmd(recv_buf, CONFIG_MODEM_INFO_BUFFER_SIZE,
-			       "%s", modem_data[info]->cmd);
+	err = nrf_modem_at_cmd(buf, CONFIG_MODEM_INFO_BUFFER_SIZE, "%s", info_cmds[cmd].at);
 	if (err != 0) {
 		return -EIO;
 	}
 
+#if defined(CONFIG_MODEM_INFO_CACHE)
+	cache_put(cmd, buf);
+#endif
+
+	return 0;
+}
+
+static int short_parse(enum modem_info info, const char *recv_buf, uint16_t *buf)
+{
+	int err;
+	struct at_parser parser;
+
 	err = at_parser_init(&parser, recv_buf);
 	__ASSERT_NO_MSG(err == 0);
 
@@ -455,6 +648,27 @@ int modem_info_short_get(enum modem_info info, uint16_t *buf)
 	return sizeof(uint16_t);
 }
 
+int modem_info_short_get(enum modem_info info, uint16_t *buf)
+{
+	int err;
+	char recv_buf[CONFIG_MODEM_INFO_BUFFER_SIZE] = {0};
+
+	if (buf == NULL) {
+		return -EINVAL;
+	}
+
+	if (modem_data[info]->data_type == MODEM_INFO_DATA_TYPE_STRING) {
+		return -EINVAL;
+	}
+
+	err = cmd_response_get(modem_data[info]->cmd, recv_buf);
+	if (err) {
+		return err;
+	}
+
+	return short_parse(info, recv_buf, buf);
+}
+
 static int parse_ip_addresses(char *out_buf, size_t out_buf_size, char *in_buf)
 {
 	int err;
@@ -573,10 +787,10 @@ parse_line:
 	return strlen(out_buf);
 }
 
-int modem_info_string_get(enum modem_info info, char *buf, const size_t buf_size)
+/* Parse a value from the command response. The response buffer is modified. */
+static int string_parse(enum modem_info info, char *recv_buf, char *buf, const size_t buf_size)
 {
 	int err;
-	char recv_buf[CONFIG_MODEM_INFO_BUFFER_SIZE] = {0};
 	uint16_t param_value;
 	char *str_end = recv_buf;
 	/* tracks length of buf when parsing multiple IP addresses */
@@ -589,18 +803,8 @@ int modem_info_string_get(enum modem_info info, char *buf, const size_t buf_size
 	size_t accumulated_len = 0;
 	struct at_parser parser;
 
-	if ((buf == NULL) || (buf_size == 0)) {
-		return -EINVAL;
-	}
-
 	buf[0] = '\0';
 
-	err = nrf_modem_at_cmd(recv_buf, CONFIG_MODEM_INFO_BUFFER_SIZE,
-			       "%s", modem_data[info]->cmd);
-	if (err != 0) {
-		return -EIO;
-	}
-
 	/* modem_info does not yet support array objects, so here we handle
 	 * the supported bands independently as a string
 	 */
@@ -675,6 +879,93 @@ int modem_info_string_get(enum modem_info info, char *buf, const size_t buf_size
 	return len <= 0 ? -ENOTSUP : len;
 }
 
+int modem_info_string_get(enum modem_info info, char *buf, const size_t buf_size)
+{
+	int err;
+	char recv_buf[CONFIG_MODEM_INFO_BUFFER_SIZE] = {0};
+
+	if ((buf == NULL) || (buf_size == 0)) {
+		return -EINVAL;
+	}
+
+	buf[0] = '\0';
+
+	err = cmd_response_get(modem_data[info]->cmd, recv_buf);
+	if (err) {
+		return err;
+	}
+
+	return string_parse(info, recv_buf, buf, buf_size);
+}
+
+static int lte_param_parse(struct lte_param *param, char *recv_buf)
+{
+	int ret = 0;
+
+	if (modem_data[param->type]->data_type == MODEM_INFO_DATA_TYPE_STRING) {
+		ret = string_parse(param->type, recv_buf, param->value_string,
+				   sizeof(param->value_string));
+	} else if (modem_data[param->type]->data_type == MODEM_INFO_DATA_TYPE_NUM_INT) {
+		ret = short_parse(param->type, recv_buf, &param->value);
+	}
+
+	if (ret < 0) {
+		LOG_ERR("Link data not obtained: %d %d", param->type, ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+int modem_info_lte_params_get(struct lte_param *const params[], size_t count)
+{
+	int err;
+	enum info_cmd cmd;
+	char rsp[CONFIG_MODEM_INFO_BUFFER_SIZE];
+	char recv_buf[CONFIG_MODEM_INFO_BUFFER_SIZE];
+	uint32_t done = 0;
+
+	__ASSERT_NO_MSG(count <= 32);
+
+	for (size_t i = 0; i < count; i++) {
+		if (params[i]->type >= MODEM_INFO_COUNT) {
+			return -EINVAL;
+		}
+	}
+
+	/* Issue each command once, and parse all the requested values from its response */
+	for (size_t i = 0; i < count; i++) {
+		if (done & BIT(i)) {
+			continue;
+		}
+
+		cmd = modem_data[params[i]->type]->cmd;
+
+		rsp[0] = '\0';
+		err = cmd_response_get(cmd, rsp);
+		if (err) {
+			LOG_ERR("Link data not obtained: %d %d", params[i]->type, err);
+			return err;
+		}
+
+		for (size_t j = i; j < count; j++) {
+			if ((done & BIT(j)) || modem_data[params[j]->type]->cmd != cmd) {
+				continue;
+			}
+
+			strcpy(recv_buf, rsp);
+			err = lte_param_parse(params[j], recv_buf);
+			if (err) {
+				return err;
+			}
+
+			done |= BIT(j);
+		}
+	}
+
+	return 0;
+}
+
 static void modem_info_rsrp_subscribe_handler(const char *notif)
 {
 	int err;
@@ -682,7 +973,7 @@ static void modem_info_rsrp_subscribe_handler(const char *notif)
 	struct at_parser parser;
 
 	const struct modem_info_data rsrp_notify_data = {
-		.cmd		= AT_CMD_CESQ,
+		.cmd		= CMD_CESQ,
 		.data_name	= RSRP_DATA_NAME,
 		.param_index	= RSRP_NOTIFY_PARAM_INDEX,
 		.param_count	= RSRP_NOTIFY_PARAM_COUNT,
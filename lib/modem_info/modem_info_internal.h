@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _MODEM_INFO_INTERNAL_INCLUDE_H_
+#define _MODEM_INFO_INTERNAL_INCLUDE_H_
+
+#include <stddef.h>
+#include <modem/modem_info.h>
+
+/**
+ * @brief Read the values of several LTE parameters.
+ *
+ * @details The parameters are grouped by the AT command that they are read from. Each command
+ * is sent once, and all the requested values are parsed from the same response.
+ *
+ * @param params Parameters to read, with the type set. At most 32 parameters.
+ * @param count Number of parameters.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int modem_info_lte_params_get(struct lte_param *const params[], size_t count);
+
+#endif
@@ -12,6 +12,8 @@
 #include <ncs_commit.h>
 #include <zephyr/logging/log.h>
 
+#include "modem_info_internal.h"
+
 LOG_MODULE_DECLARE(modem_info, CONFIG_MODEM_INFO_LOG_LEVEL);
 
 int modem_info_params_init(struct modem_param_info *modem)
@@ -105,36 +107,6 @@ static int cellid_to_dec(struct lte_param *cellID, double *cellID_dec)
 	return 0;
 }
 
-static int modem_data_get(struct lte_param *param)
-{
-	enum modem_info_data_type data_type;
-	int ret;
-
-	data_type = modem_info_data_type_get(param->type);
-
-	if (data_type == MODEM_INFO_DATA_TYPE_INVALID) {
-		return -EINVAL;
-	}
-
-	if (data_type == MODEM_INFO_DATA_TYPE_STRING) {
-		ret = modem_info_string_get(param->type,
-				param->value_string,
-				sizeof(param->value_string));
-		if (ret < 0) {
-			LOG_ERR("Link data not obtained: %d %d", param->type, ret);
-			return ret;
-		}
-	} else if (data_type == MODEM_INFO_DATA_TYPE_NUM_INT) {
-		ret = modem_info_short_get(param->type, &param->value);
-		if (ret < 0) {
-			LOG_ERR("Link data not obtained: %d", ret);
-			return ret;
-		}
-	}
-
-	return 0;
-}
-
 int modem_info_params_get(struct modem_param_info *modem)
 {
 	int ret;
@@ -176,17 +148,17 @@ int modem_info_params_get(struct modem_param_info *modem)
 #endif
 		};
 
-		for (size_t i = 0; i < ARRAY_SIZE(params); ++i) {
-			ret = modem_data_get(params[i]);
-			if (ret) {
-				return ret;
-			}
+		ret = modem_info_lte_params_get(params, ARRAY_SIZE(params));
+		if (ret) {
+			return ret;
 		}
 	}
 
 	if (IS_ENABLED(CONFIG_MODEM_INFO_ADD_NETWORK)) {
 		if (IS_ENABLED(CONFIG_MODEM_INFO_ADD_DATE_TIME)) {
-			ret = modem_data_get(&modem->network.date_time);
+			struct lte_param *date_time = &modem->network.date_time;
+
+			ret = modem_info_lte_params_get(&date_time, 1);
 			if (ret) {
 				LOG_ERR("Could not get time, error: %d", ret);
 				/* non-critical error: continue */
@@ -50,6 +50,7 @@
 static struct nrf_sock_ctx {
 	int nrf_fd; /* nRF socket descriptor. */
 	int zvfs_fd; /* ZVFS socket descriptor. */
+	int type; /* Socket type. */
 	struct k_mutex *lock; /* Mutex associated with the socket. */
 	struct k_poll_signal poll; /* poll() signal. */
 	struct socket_ncs_pollcb pollcb; /* Poll callback (owned by the app). */
@@ -65,7 +66,7 @@ static bool offload_disabled;
 /* TLS offloading disabled only. */
 static bool tls_offload_disabled;
 
-static struct nrf_sock_ctx *allocate_ctx(int nrf_fd, int zvfs_fd)
+static struct nrf_sock_ctx *allocate_ctx(int nrf_fd, int zvfs_fd, int type)
 {
 	struct nrf_sock_ctx *ctx = NULL;
 
@@ -76,6 +77,7 @@ static struct nrf_sock_ctx *allocate_ctx(int nrf_fd, int zvfs_fd)
 			ctx = &offload_ctx[i];
 			ctx->nrf_fd = nrf_fd;
 			ctx->zvfs_fd = zvfs_fd;
+			ctx->type = type;
 			break;
 		}
 	}
@@ -92,6 +94,7 @@ static void release_ctx(struct nrf_sock_ctx *ctx)
 	ctx->nrf_fd = -1;
 	ctx->lock = NULL;
 	ctx->zvfs_fd = -1;
+	ctx->type = 0;
 	memset(&ctx->pollcb, 0, sizeof(ctx->pollcb));
 	memset(&ctx->sendcb, 0, sizeof(ctx->sendcb));
 
@@ -408,7 +411,7 @@ static int nrf9x_socket_offload_accept(void *obj, struct net_sockaddr *addr,
 		goto error;
 	}
 
-	ctx = allocate_ctx(new_sd, fd);
+	ctx = allocate_ctx(new_sd, fd, NET_SOCK_STREAM);
 	if (ctx == NULL) {
 		errno = ENOMEM;
 		goto error;
@@ -772,81 +775,123 @@ static ssize_t nrf9x_socket_offload_sendto(void *obj, const void *buf,
 	return retval;
 }
 
+/* Copy data from the message parts, starting at the given position, to the buffer.
+ * The position is advanced past the copied data.
+ */
+static size_t sendmsg_gather(const struct net_msghdr *msg, size_t *iov_idx, size_t *iov_offset,
+			     uint8_t *buf, size_t buf_size)
+{
+	size_t len = 0;
+
+	while ((*iov_idx < msg->msg_iovlen) && (len < buf_size)) {
+		const struct net_iovec *iov = &msg->msg_iov[*iov_idx];
+		size_t copy_len = MIN(iov->iov_len - *iov_offset, buf_size - len);
+
+		memcpy(buf + len, (const uint8_t *)iov->iov_base + *iov_offset, copy_len);
+		len += copy_len;
+		*iov_offset += copy_len;
+
+		if (*iov_offset == iov->iov_len) {
+			(*iov_idx)++;
+			*iov_offset = 0;
+		}
+	}
+
+	return len;
+}
+
+static ssize_t sendmsg_stream(void *obj, const struct net_msghdr *msg, int flags, uint8_t *buf)
+{
+	size_t iov_idx = 0;
+	size_t iov_offset = 0;
+	ssize_t sent = 0;
+	ssize_t ret;
+
+	/* Repack the message parts into buffer-sized chunks to reduce the number of
+	 * `sendto` calls.
+	 */
+	while (iov_idx < msg->msg_iovlen) {
+		size_t len = sendmsg_gather(msg, &iov_idx, &iov_offset, buf,
+					    CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE);
+		size_t offset = 0;
+
+		while (offset < len) {
+			ret = nrf9x_socket_offload_sendto(obj, (buf + offset), (len - offset),
+							  flags, msg->msg_name, msg->msg_namelen);
+			if (ret < 0) {
+				/* Report the data that was already sent, if any. */
+				return (sent > 0) ? sent : ret;
+			}
+
+			offset += ret;
+			sent += ret;
+		}
+	}
+
+	return sent;
+}
+
+static ssize_t sendmsg_dgram(void *obj, const struct net_msghdr *msg, int flags, uint8_t *buf,
+			     size_t len)
+{
+	size_t iov_idx = 0;
+	size_t iov_offset = 0;
+
+	/* The whole message is sent with a single `sendto` call to keep the datagram boundary. */
+	(void)sendmsg_gather(msg, &iov_idx, &iov_offset, buf, len);
+
+	return nrf9x_socket_offload_sendto(obj, buf, len, flags, msg->msg_name, msg->msg_namelen);
+}
+
+/* Intermediate buffers used to repack `sendmsg` data. Each `sendmsg` call takes one buffer,
+ * so sockets do not wait for each other unless all of the buffers are in use.
+ */
+#define SENDMSG_BLOCK_SIZE ROUND_UP(CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE, sizeof(void *))
+
+K_MEM_SLAB_DEFINE_STATIC(sendmsg_slab, SENDMSG_BLOCK_SIZE, CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_COUNT,
+			 sizeof(void *));
+
 static ssize_t nrf9x_socket_offload_sendmsg(void *obj, const struct net_msghdr *msg,
 					    int flags)
 {
-	ssize_t len = 0;
+	struct nrf_sock_ctx *ctx = OBJ_TO_CTX(obj);
+	size_t len = 0;
 	ssize_t ret;
-	ssize_t offset;
-	int i;
-	static K_MUTEX_DEFINE(sendmsg_lock);
-	static uint8_t buf[CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE];
+	void *buf;
 
 	if (msg == NULL) {
 		errno = EINVAL;
 		return -1;
 	}
 
-	/* Try to reduce number of `sendto` calls - copy data if they fit into
-	 * a single buffer
-	 */
+	/* A single message part is sent without repacking. */
+	if (msg->msg_iovlen == 1) {
+		return nrf9x_socket_offload_sendto(obj, msg->msg_iov[0].iov_base,
+						   msg->msg_iov[0].iov_len, flags,
+						   msg->msg_name, msg->msg_namelen);
+	}
 
-	for (i = 0; i < msg->msg_iovlen; i++) {
+	for (size_t i = 0; i < msg->msg_iovlen; i++) {
 		len += msg->msg_iov[i].iov_len;
 	}
 
-	if (len <= sizeof(buf)) {
-		/* Protect `buf` access with a mutex. */
-		k_mutex_lock(&sendmsg_lock, K_FOREVER);
-		len = 0;
-
-		for (i = 0; i < msg->msg_iovlen; i++) {
-			memcpy(buf + len, msg->msg_iov[i].iov_base,
-			       msg->msg_iov[i].iov_len);
-			len += msg->msg_iov[i].iov_len;
-		}
-
-		offset = 0;
-		ret = 0;
-		while ((offset < len) && (ret >= 0)) {
-			ret = nrf9x_socket_offload_sendto(obj,
-				(buf + offset), (len - offset), flags,
-				msg->msg_name, msg->msg_namelen);
-			if (ret > 0) {
-				offset += ret;
-			}
-		}
-
-		k_mutex_unlock(&sendmsg_lock);
-		return ret;
+	if ((ctx->type != NET_SOCK_STREAM) && (len > CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE)) {
+		/* Datagram does not fit into the intermediate buffer, and cannot be split. */
+		errno = EMSGSIZE;
+		return -1;
 	}
 
-	/* If the data won't fit into intermediate buffer, send the buffers
-	 * separately
-	 */
-
-	len = 0;
+	(void)k_mem_slab_alloc(&sendmsg_slab, &buf, K_FOREVER);
 
-	for (i = 0; i < msg->msg_iovlen; i++) {
-		if (msg->msg_iov[i].iov_len == 0) {
-			continue;
-		}
-
-		offset = 0;
-		while (offset < msg->msg_iov[i].iov_len) {
-			ret = nrf9x_socket_offload_sendto(obj,
-				(((uint8_t *) msg->msg_iov[i].iov_base) + offset),
-				(msg->msg_iov[i].iov_len - offset), flags,
-				msg->msg_name, msg->msg_namelen);
-			if (ret < 0) {
-				return ret;
-			}
-			offset += ret;
-			len += ret;
-		}
+	if (ctx->type == NET_SOCK_STREAM) {
+		ret = sendmsg_stream(obj, msg, flags, buf);
+	} else {
+		ret = sendmsg_dgram(obj, msg, flags, buf, len);
 	}
 
-	return len;
+	k_mem_slab_free(&sendmsg_slab, buf);
+
+	return ret;
 }
 
 static void nrf9x_socket_offload_freeaddrinfo(struct zsock_addrinfo *root)
@@ -1193,7 +1238,7 @@ static int nrf9x_socket_create(int family, int type, int proto)
 		return -1;
 	}
 
-	ctx = allocate_ctx(sd, fd);
+	ctx = allocate_ctx(sd, fd, type);
 	if (ctx == NULL) {
 		errno = ENOMEM;
 		nrf_close(sd);
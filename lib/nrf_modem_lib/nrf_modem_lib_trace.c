@@ -15,6 +15,10 @@
 #include <nrf_modem_os.h>
 #include <nrf_modem_trace.h>
 #include <nrf_errno.h>
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/ring_buffer.h>
+#endif
 
 LOG_MODULE_REGISTER(nrf_modem_lib_trace, CONFIG_NRF_MODEM_LIB_LOG_LEVEL);
 
@@ -76,6 +80,29 @@ static void backend_suspend_handle(struct k_work *item)
 	backend_suspend();
 }
 
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+/* Trace data is copied from the modem to the staging buffer by the trace thread and written to
+ * the trace backend by the staging thread. Data is copied in and out of the buffer outside of
+ * the lock, which only protects the buffer indexes.
+ */
+RING_BUF_DECLARE(staging_buf, CONFIG_NRF_MODEM_LIB_TRACE_STAGING_BUF_SIZE);
+static struct k_spinlock staging_lock;
+
+static K_SEM_DEFINE(staging_data_sem, 0, 1);
+static K_SEM_DEFINE(staging_space_sem, 0, 1);
+static K_SEM_DEFINE(staging_drained_sem, 0, 1);
+
+enum staging_flag {
+	/* Trace thread waits for the staged data to be written. */
+	STAGING_FLUSH,
+	/* Trace backend failed, staged data is dropped. */
+	STAGING_ERROR,
+};
+
+static atomic_t staging_flags;
+static uint32_t staging_peak;
+#endif
+
 
 #if CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE
 static uint32_t backend_bps_avg;
@@ -83,6 +110,14 @@ static uint32_t backend_bps_tot;
 static uint32_t backend_bps_samples;
 static int64_t backend_measurement_start;
 
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+/* Trace data copied into the staging buffer in the current period, and the resulting rate over
+ * the last period.
+ */
+static atomic_t staging_bytes;
+static uint32_t staging_bps_avg;
+#endif
+
 #define BACKEND_BPS_AVG_UPDATE_PERIOD K_MSEC(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE_PERIOD_MS)
 
 static void backend_bps_reset(void)
@@ -112,6 +147,11 @@ static void backend_bps_avg_update(struct k_work *item)
 
 	backend_bps_reset();
 
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+	staging_bps_avg = (uint64_t)atomic_clear(&staging_bytes) * 8 * MSEC_PER_SEC /
+			  CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE_PERIOD_MS;
+#endif
+
 	k_work_schedule(&backend_bps_avg_update_work, BACKEND_BPS_AVG_UPDATE_PERIOD);
 }
 
@@ -120,6 +160,13 @@ uint32_t nrf_modem_lib_trace_backend_bitrate_get(void)
 	return backend_bps_avg;
 }
 
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+uint32_t nrf_modem_lib_trace_staging_bitrate_get(void)
+{
+	return staging_bps_avg;
+}
+#endif
+
 static void trace_backend_bitrate_perf_start(void)
 {
 	backend_measurement_start = k_uptime_ticks();
@@ -140,9 +187,11 @@ static void trace_backend_bitrate_perf_end(int size)
 
 #define PERF_START trace_backend_bitrate_perf_start
 #define PERF_END(size) trace_backend_bitrate_perf_end(size)
+#define PERF_STAGED(size) atomic_add(&staging_bytes, size)
 #else
 #define PERF_START(...)
 #define PERF_END(...)
+#define PERF_STAGED(...)
 #endif
 
 __weak void nrf_modem_lib_trace_callback(enum nrf_modem_lib_trace_event evt)
@@ -160,6 +209,9 @@ K_WORK_DELAYABLE_DEFINE(backend_bps_log_work, backend_bps_log);
 static void backend_bps_log(struct k_work *item)
 {
 	LOG_INF("Trace backend bitrate (bps): %u", backend_bps_avg);
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+	LOG_INF("Trace staging bitrate (bps): %u", staging_bps_avg);
+#endif
 
 	k_work_schedule(&backend_bps_log_work, BACKEND_BPS_LOG_PERIOD);
 }
@@ -200,6 +252,12 @@ static void bps_log(struct k_work *item)
 	LOG_INF("Written: %d, read: %d", trace_bytes_received_total, trace_bytes_read_total);
 	LOG_INF("Trace bitrate (bps): %u", trace_data_bps_avg);
 
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+	LOG_INF("Staging buffer peak usage: %u/%u bytes", staging_peak,
+		CONFIG_NRF_MODEM_LIB_TRACE_STAGING_BUF_SIZE);
+	staging_peak = 0;
+#endif
+
 	k_work_schedule(&bps_log_work, BPS_LOG_PERIOD);
 }
 
@@ -279,11 +337,184 @@ static int trace_fragment_write(struct nrf_modem_trace_data *frag)
 	return 0;
 }
 
+/* Write a trace fragment and handle the backend running out of space. */
+static int trace_write(struct nrf_modem_trace_data *frag)
+{
+	int err;
+
+	while (true) {
+		err = trace_fragment_write(frag);
+		switch (err) {
+		case 0:
+			return 0;
+
+		case -ENOSPC:
+			nrf_modem_lib_trace_callback(NRF_MODEM_LIB_TRACE_EVT_FULL);
+			if (!trace_backend.clear) {
+				return err;
+			}
+
+			has_space = false;
+			k_sem_give(&trace_done_sem);
+			k_sem_take(&trace_clear_sem, K_FOREVER);
+			/* Try the same fragment again */
+			break;
+
+		case -ENOSR:
+			if (k_sem_take(&modem_trace_level_sem, K_NO_WAIT) != 0) {
+				/** If modem trace level is off, we wait for modem
+				 *  trace level semaphore, indicating modem traces
+				 *  are enabled. This is always available unless
+				 *  nrf_modem_lib_trace_level_set() is called with
+				 *  level 0 (off).
+				 */
+				k_sem_give(&trace_done_sem);
+				k_sem_take(&modem_trace_level_sem, K_FOREVER);
+				k_sem_take(&trace_done_sem, K_FOREVER);
+			}
+
+			k_sem_give(&modem_trace_level_sem);
+
+			/* Try the same fragment again */
+			break;
+
+		default:
+			/* Irrecoverable error */
+			return err;
+		}
+	}
+}
+
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+static int trace_staging_processed(size_t len)
+{
+	/* Modem trace memory is released when the data is copied to the staging buffer. */
+	ARG_UNUSED(len);
+
+	return 0;
+}
+
+/* Copy a trace fragment to the staging buffer and release it to the modem. */
+static int staging_put(const struct nrf_modem_trace_data *frag)
+{
+	const uint8_t *data = frag->data;
+	size_t len = frag->len;
+	k_spinlock_key_t key;
+	uint32_t claimed;
+	uint8_t *dst;
+
+	while (len) {
+		if (atomic_test_bit(&staging_flags, STAGING_ERROR)) {
+			return -EIO;
+		}
+
+		key = k_spin_lock(&staging_lock);
+		claimed = ring_buf_put_claim(&staging_buf, &dst, len);
+		k_spin_unlock(&staging_lock, key);
+
+		if (claimed == 0) {
+			/* Wait for the staging thread to write data to the backend. */
+			k_sem_take(&staging_space_sem, K_FOREVER);
+			continue;
+		}
+
+		memcpy(dst, data, claimed);
+
+		key = k_spin_lock(&staging_lock);
+		ring_buf_put_finish(&staging_buf, claimed);
+		staging_peak = MAX(staging_peak, ring_buf_size_get(&staging_buf));
+		k_spin_unlock(&staging_lock, key);
+
+		k_sem_give(&staging_data_sem);
+
+		nrf_modem_trace_processed(claimed);
+		PERF_STAGED(claimed);
+
+		data += claimed;
+		len -= claimed;
+	}
+
+	return 0;
+}
+
+/* Wait until all of the staged data is written to the backend or dropped. */
+static void staging_flush(void)
+{
+	atomic_set_bit(&staging_flags, STAGING_FLUSH);
+	k_sem_give(&staging_data_sem);
+	k_sem_take(&staging_drained_sem, K_FOREVER);
+
+	atomic_clear_bit(&staging_flags, STAGING_ERROR);
+}
+
+static void trace_staging_thread_handler(void)
+{
+	struct nrf_modem_trace_data chunk;
+	k_spinlock_key_t key;
+	uint8_t *data;
+	uint32_t len;
+	int err;
+
+	while (true) {
+		k_sem_take(&staging_data_sem, K_FOREVER);
+
+		while (true) {
+			/* Write all of the contiguous staged data at once. It usually spans
+			 * multiple trace fragments.
+			 */
+			key = k_spin_lock(&staging_lock);
+			len = ring_buf_get_claim(&staging_buf, &data, UINT32_MAX);
+			k_spin_unlock(&staging_lock, key);
+
+			if (len == 0) {
+				break;
+			}
+
+			if (!atomic_test_bit(&staging_flags, STAGING_ERROR)) {
+				if (trace_backend.suspend) {
+					k_work_cancel_delayable(&backend_suspend_work);
+				}
+
+				if (backend_suspended) {
+					backend_resume();
+				}
+
+				chunk.data = data;
+				chunk.len = len;
+
+				err = trace_write(&chunk);
+				if (err) {
+					atomic_set_bit(&staging_flags, STAGING_ERROR);
+				}
+			}
+
+			key = k_spin_lock(&staging_lock);
+			ring_buf_get_finish(&staging_buf, len);
+			k_spin_unlock(&staging_lock, key);
+
+			k_sem_give(&staging_space_sem);
+		}
+
+		if (atomic_test_and_clear_bit(&staging_flags, STAGING_FLUSH)) {
+			k_sem_give(&staging_drained_sem);
+		} else if (trace_backend.suspend) {
+			k_work_schedule(&backend_suspend_work, BACKEND_SUSPEND_DELAY);
+		}
+	}
+}
+
+K_THREAD_DEFINE(trace_staging_thread, CONFIG_NRF_MODEM_LIB_TRACE_STAGING_STACK_SIZE,
+		trace_staging_thread_handler, NULL, NULL, NULL, TRACE_THREAD_PRIORITY, 0, 0);
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_STAGING */
+
 void trace_thread_handler(void)
 {
 	int err;
 	struct nrf_modem_trace_data *frags;
 	size_t n_frags;
+	/* With staging, the backend is suspended and resumed by the staging thread. */
+	const bool suspend = (trace_backend.suspend != NULL) &&
+			     !IS_ENABLED(CONFIG_NRF_MODEM_LIB_TRACE_STAGING);
 
 trace_reset:
 	/* Trace backend is suspended here to keep it suspended until first trace data is received
@@ -296,12 +527,12 @@ trace_reset:
 	k_sem_take(&trace_sem, K_FOREVER);
 
 	while (true) {
-		if (trace_backend.suspend) {
+		if (suspend) {
 			k_work_schedule(&backend_suspend_work, BACKEND_SUSPEND_DELAY);
 		}
 
 		err = nrf_modem_trace_get(&frags, &n_frags, NRF_MODEM_OS_FOREVER);
-		if (trace_backend.suspend) {
+		if (suspend) {
 			k_work_cancel_delayable(&backend_suspend_work);
 		}
 		switch (err) {
@@ -326,54 +557,33 @@ trace_reset:
 			goto deinit;
 		}
 
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+		for (int i = 0; i < n_frags; i++) {
+			err = staging_put(&frags[i]);
+			if (err) {
+				/* Trace backend failed */
+				goto deinit;
+			}
+		}
+#else
 		if (backend_suspended) {
 			backend_resume();
 		}
 
 		for (int i = 0; i < n_frags; i++) {
-retry:
-			err = trace_fragment_write(&frags[i]);
-			switch (err) {
-			case 0:
-				break;
-			case -ENOSPC:
-				nrf_modem_lib_trace_callback(NRF_MODEM_LIB_TRACE_EVT_FULL);
-				if (!trace_backend.clear) {
-					goto deinit;
-				}
-
-				has_space = false;
-				k_sem_give(&trace_done_sem);
-				k_sem_take(&trace_clear_sem, K_FOREVER);
-				/* Try the same fragment again */
-				goto retry;
-
-			case -ENOSR:
-				if (k_sem_take(&modem_trace_level_sem, K_NO_WAIT) != 0) {
-					/** If modem trace level is off, we wait for modem
-					 *  trace level semaphore, indicating modem traces
-					 *  are enabled. This is always available unless
-					 *  nrf_modem_lib_trace_level_set() is called with
-					 *  level 0 (off).
-					 */
-					k_sem_give(&trace_done_sem);
-					k_sem_take(&modem_trace_level_sem, K_FOREVER);
-					k_sem_take(&trace_done_sem, K_FOREVER);
-				}
-
-				k_sem_give(&modem_trace_level_sem);
-
-				/* Try the same fragment again */
-				goto retry;
-
-			default:
-				/* Irrecoverable error */
+			err = trace_write(&frags[i]);
+			if (err) {
 				goto deinit;
 			}
 		}
+#endif
 	}
 
 deinit:
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+	staging_flush();
+#endif
+
 	err = trace_deinit();
 	if (err) {
 		LOG_ERR("trace_deinit failed with err: %d", err);
@@ -393,7 +603,11 @@ static int trace_init(void)
 
 	k_sem_take(&trace_done_sem, K_FOREVER);
 
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+	err = trace_backend.init(trace_staging_processed);
+#else
 	err = trace_backend.init(nrf_modem_trace_processed);
+#endif
 	if (err) {
 		LOG_ERR("trace_backend: init failed with err: %d", err);
 		return err;
@@ -21,6 +21,9 @@
 #include "sms_submit.h"
 #include "sms_deliver.h"
 #include "sms_internal.h"
+#if defined(CONFIG_SMS_REASSEMBLY)
+#include "sms_reassembly.h"
+#endif
 
 LOG_MODULE_REGISTER(sms, CONFIG_SMS_LOG_LEVEL);
 
@@ -126,11 +129,25 @@ static void sms_ack(struct k_work *work)
  */
 static void sms_notify(struct k_work *work)
 {
+	struct sms_data *data = &sms_data_info;
+
+#if defined(CONFIG_SMS_REASSEMBLY)
+	data = sms_reassembly_add(&sms_data_info);
+	if (data == NULL) {
+		/* Concatenated message is not complete yet */
+		return;
+	}
+#endif
+
 	for (size_t i = 0; i < ARRAY_SIZE(subscribers); i++) {
 		if (subscribers[i].listener != NULL) {
-			subscribers[i].listener(&sms_data_info, subscribers[i].ctx);
+			subscribers[i].listener(data, subscribers[i].ctx);
 		}
 	}
+
+#if defined(CONFIG_SMS_REASSEMBLY)
+	sms_reassembly_release(data);
+#endif
 }
 
 /**
@@ -390,6 +407,9 @@ static void sms_uninit(void)
 	at_monitor_pause(&sms_at_handler_cms);
 #if defined(CONFIG_SMS_STATUS_REPORT)
 	at_monitor_pause(&sms_at_handler_cds);
+#endif
+#if defined(CONFIG_SMS_REASSEMBLY)
+	sms_reassembly_reset();
 #endif
 	sms_client_registered = false;
 }
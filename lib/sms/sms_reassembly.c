@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <modem/sms.h>
+#include <zephyr/logging/log.h>
+
+#include "sms_reassembly.h"
+
+LOG_MODULE_DECLARE(sms, CONFIG_SMS_LOG_LEVEL);
+
+#define SLOT_COUNT CONFIG_SMS_REASSEMBLY_MESSAGES_MAX
+#define BUCKET_COUNT (2 * SLOT_COUNT)
+#define TIMEOUT_MS (CONFIG_SMS_REASSEMBLY_TIMEOUT * MSEC_PER_SEC)
+
+/** @brief Part length indicating that the part has not been received. */
+#define PART_MISSING UINT8_MAX
+
+/** @brief Partially received concatenated message. */
+struct reassembly_slot {
+	bool in_use;
+	/** Next slot in the same hash bucket, as slot index + 1. Zero ends the chain. */
+	uint8_t next;
+	uint32_t hash;
+	/** Uptime when the latest part was received. */
+	int64_t updated;
+	/**
+	 * Header of the first part, or of the first received part until the first part
+	 * has been received. The originating address and the reference number are the key.
+	 */
+	struct sms_deliver_header header;
+	uint8_t received;
+	/**
+	 * Buffer from the reassembly heap. Lengths of the parts are followed by the payloads,
+	 * which are stored at SMS_MAX_PAYLOAD_LEN_CHARS byte intervals by sequence number.
+	 */
+	uint8_t *buf;
+};
+
+K_HEAP_DEFINE(reassembly_heap, CONFIG_SMS_REASSEMBLY_HEAP_SIZE);
+
+static struct reassembly_slot slots[SLOT_COUNT];
+/** @brief Hash index of the slots. First slot of each bucket, as slot index + 1. */
+static uint8_t buckets[BUCKET_COUNT];
+
+/** @brief Reassembled message and its buffer, valid until released. */
+static struct sms_data reassembled;
+static uint8_t *reassembled_buf;
+
+/* FNV-1a hash of the originating address and the reference number. */
+static uint32_t key_hash(const struct sms_deliver_header *header)
+{
+	const char *c = header->originating_address.address_str;
+	uint16_t ref_number = header->concatenated.ref_number;
+	uint32_t hash = 2166136261u;
+
+	for (; *c != '\0'; c++) {
+		hash = (hash ^ (uint8_t)*c) * 16777619u;
+	}
+	hash = (hash ^ (ref_number & 0xFF)) * 16777619u;
+	hash = (hash ^ (ref_number >> 8)) * 16777619u;
+
+	return hash;
+}
+
+static bool key_equals(const struct reassembly_slot *slot, uint32_t hash,
+		       const struct sms_deliver_header *header)
+{
+	return slot->hash == hash &&
+	       slot->header.concatenated.ref_number == header->concatenated.ref_number &&
+	       strcmp(slot->header.originating_address.address_str,
+		      header->originating_address.address_str) == 0;
+}
+
+static struct reassembly_slot *slot_find(uint32_t hash, const struct sms_deliver_header *header)
+{
+	uint8_t index = buckets[hash % BUCKET_COUNT];
+
+	while (index != 0) {
+		struct reassembly_slot *slot = &slots[index - 1];
+
+		if (key_equals(slot, hash, header)) {
+			return slot;
+		}
+		index = slot->next;
+	}
+
+	return NULL;
+}
+
+static void slot_free(struct reassembly_slot *slot)
+{
+	uint8_t *index = &buckets[slot->hash % BUCKET_COUNT];
+	uint8_t slot_index = slot - slots + 1;
+
+	/* Unlink from the hash bucket */
+	while (*index != slot_index) {
+		index = &slots[*index - 1].next;
+	}
+	*index = slot->next;
+
+	if (slot->buf != NULL) {
+		k_heap_free(&reassembly_heap, slot->buf);
+	}
+	memset(slot, 0, sizeof(*slot));
+}
+
+static void slot_drop(struct reassembly_slot *slot, const char *reason)
+{
+	LOG_WRN("Dropped concatenated message (ref %d) with %d of %d parts received: %s",
+		slot->header.concatenated.ref_number, slot->received,
+		slot->header.concatenated.total_msgs, reason);
+
+	slot_free(slot);
+}
+
+static struct reassembly_slot *slot_oldest(void)
+{
+	struct reassembly_slot *oldest = NULL;
+
+	for (size_t i = 0; i < SLOT_COUNT; i++) {
+		if (slots[i].in_use && (oldest == NULL || slots[i].updated < oldest->updated)) {
+			oldest = &slots[i];
+		}
+	}
+
+	return oldest;
+}
+
+static void slots_expire(int64_t now)
+{
+	for (size_t i = 0; i < SLOT_COUNT; i++) {
+		if (slots[i].in_use && now - slots[i].updated >= TIMEOUT_MS) {
+			slot_drop(&slots[i], "timeout");
+		}
+	}
+}
+
+static struct reassembly_slot *slot_alloc(uint32_t hash, const struct sms_deliver_header *header)
+{
+	uint8_t total_msgs = header->concatenated.total_msgs;
+	size_t size = total_msgs + total_msgs * SMS_MAX_PAYLOAD_LEN_CHARS + 1;
+	struct reassembly_slot *slot = NULL;
+	uint8_t *buf;
+
+	/* Evict the oldest messages until there is room for the new one */
+	while ((buf = k_heap_alloc(&reassembly_heap, size, K_NO_WAIT)) == NULL) {
+		struct reassembly_slot *oldest = slot_oldest();
+
+		if (oldest == NULL) {
+			LOG_WRN("Concatenated message of %d parts exceeds the reassembly memory",
+				total_msgs);
+			return NULL;
+		}
+		slot_drop(oldest, "out of memory");
+	}
+
+	for (size_t i = 0; i < SLOT_COUNT; i++) {
+		if (!slots[i].in_use) {
+			slot = &slots[i];
+			break;
+		}
+	}
+	if (slot == NULL) {
+		slot = slot_oldest();
+		slot_drop(slot, "out of slots");
+	}
+
+	memset(buf, PART_MISSING, total_msgs);
+	slot->in_use = true;
+	slot->hash = hash;
+	slot->header = *header;
+	slot->buf = buf;
+
+	/* Link to the hash bucket */
+	slot->next = buckets[hash % BUCKET_COUNT];
+	buckets[hash % BUCKET_COUNT] = slot - slots + 1;
+
+	return slot;
+}
+
+static struct sms_data *slot_complete(struct reassembly_slot *slot)
+{
+	uint8_t total_msgs = slot->header.concatenated.total_msgs;
+	uint8_t *lengths = slot->buf;
+	uint8_t *parts = slot->buf + total_msgs;
+	size_t len = 0;
+
+	/* Payloads are moved next to each other. The first part is already in place. */
+	for (uint8_t i = 0; i < total_msgs; i++) {
+		memmove(parts + len, parts + i * SMS_MAX_PAYLOAD_LEN_CHARS, lengths[i]);
+		len += lengths[i];
+	}
+	parts[len] = '\0';
+
+	memset(&reassembled, 0, sizeof(reassembled));
+	reassembled.type = SMS_TYPE_DELIVER;
+	reassembled.header.deliver = slot->header;
+	reassembled.payload_len = lengths[0];
+	memcpy(reassembled.payload, parts, lengths[0]);
+	reassembled.concat_payload = parts;
+	reassembled.concat_payload_len = len;
+
+	/* The buffer is owned by the reassembled message until it is released */
+	reassembled_buf = slot->buf;
+	slot->buf = NULL;
+	slot_free(slot);
+
+	return &reassembled;
+}
+
+struct sms_data *sms_reassembly_add(struct sms_data *data)
+{
+	const struct sms_deliver_header *header = &data->header.deliver;
+	const struct sms_udh_concat *concat = &header->concatenated;
+	struct reassembly_slot *slot;
+	uint8_t *lengths;
+	uint8_t *part;
+	int64_t now;
+	uint32_t hash;
+
+	if (data->type != SMS_TYPE_DELIVER || !concat->present || concat->total_msgs < 2 ||
+	    concat->seq_number == 0 || concat->seq_number > concat->total_msgs) {
+		return data;
+	}
+
+	now = k_uptime_get();
+	slots_expire(now);
+
+	hash = key_hash(header);
+	slot = slot_find(hash, header);
+	if (slot != NULL && slot->header.concatenated.total_msgs != concat->total_msgs) {
+		/* Reference number has been reused for another message */
+		slot_drop(slot, "reference reused");
+		slot = NULL;
+	}
+	if (slot == NULL) {
+		slot = slot_alloc(hash, header);
+		if (slot == NULL) {
+			/* Deliver the part as is */
+			return data;
+		}
+	}
+
+	lengths = slot->buf;
+	if (lengths[concat->seq_number - 1] != PART_MISSING) {
+		LOG_DBG("Duplicate part %d of concatenated message (ref %d)",
+			concat->seq_number, concat->ref_number);
+		return NULL;
+	}
+
+	part = slot->buf + concat->total_msgs +
+	       (concat->seq_number - 1) * SMS_MAX_PAYLOAD_LEN_CHARS;
+	memcpy(part, data->payload, data->payload_len);
+	lengths[concat->seq_number - 1] = data->payload_len;
+
+	if (concat->seq_number == 1) {
+		slot->header = *header;
+	}
+	slot->received++;
+	slot->updated = now;
+
+	LOG_DBG("Part %d of %d of concatenated message (ref %d) received",
+		concat->seq_number, concat->total_msgs, concat->ref_number);
+
+	if (slot->received < concat->total_msgs) {
+		return NULL;
+	}
+
+	return slot_complete(slot);
+}
+
+void sms_reassembly_release(struct sms_data *data)
+{
+	if (data != &reassembled) {
+		return;
+	}
+
+	k_heap_free(&reassembly_heap, reassembled_buf);
+	reassembled_buf = NULL;
+	reassembled.concat_payload = NULL;
+	reassembled.concat_payload_len = 0;
+}
+
+void sms_reassembly_reset(void)
+{
+	for (size_t i = 0; i < SLOT_COUNT; i++) {
+		if (slots[i].in_use) {
+			slot_free(&slots[i]);
+		}
+	}
+}
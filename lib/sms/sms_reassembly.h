@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SMS_REASSEMBLY_INCLUDE_H_
+#define _SMS_REASSEMBLY_INCLUDE_H_
+
+/* Forward declaration */
+struct sms_data;
+
+/**
+ * @brief Add a received message to concatenated message reassembly.
+ *
+ * @details Messages that are not parts of a concatenated message are returned as is.
+ * Parts are stored until all parts of the message have been received, and the complete
+ * message is returned when the last part is added. Parts that do not fit into the memory
+ * budget are returned as is.
+ *
+ * @param[in] data Received message.
+ *
+ * @return Message to be notified to the listeners, or NULL if there is nothing to notify.
+ *         The returned message must be released with sms_reassembly_release().
+ */
+struct sms_data *sms_reassembly_add(struct sms_data *data);
+
+/**
+ * @brief Release a message returned by sms_reassembly_add().
+ *
+ * @param[in] data Message returned by sms_reassembly_add().
+ */
+void sms_reassembly_release(struct sms_data *data);
+
+/**
+ * @brief Drop all partially received messages.
+ */
+void sms_reassembly_reset(void);
+
+#endif
@@ -13,6 +13,9 @@
 #define STR_7BIT_ESCAPE_IND     0x80
 #define STR_7BIT_CODE_MASK      0x7F
 #define STR_7BIT_ESCAPE_CODE    0x1B
+/* Number of characters packed into a group of bytes, see string_conversion_7bit_sms_packing() */
+#define STR_7BIT_GROUP_CHARS    8
+#define STR_7BIT_GROUP_BYTES    7
 
 /**
  * @brief Conversion table from ASCII (with ISO-8859-15 extension) to GSM 7 bit
@@ -301,6 +304,24 @@ uint8_t string_conversion_7bit_sms_packing(uint8_t *data, uint8_t data_len)
 		return 0;
 	}
 
+	/* Pack full groups of 8 characters into 7 bytes at a time. The bytes of a group are
+	 * written after all of its characters have been read, so packing in place is safe.
+	 */
+	while (data_len - src >= STR_7BIT_GROUP_CHARS) {
+		uint64_t group = 0;
+
+		for (int i = 0; i < STR_7BIT_GROUP_CHARS; i++) {
+			group |= (uint64_t)data[src + i] << (7 * i);
+		}
+		for (int i = 0; i < STR_7BIT_GROUP_BYTES; i++) {
+			data[dst + i] = (uint8_t)(group >> (8 * i));
+		}
+
+		src += STR_7BIT_GROUP_CHARS;
+		dst += STR_7BIT_GROUP_BYTES;
+	}
+
+	/* Remaining characters */
 	while (src < data_len) {
 		data[dst] = data[src] >> shift;
 		src++;
@@ -325,29 +346,38 @@ uint8_t string_conversion_7bit_sms_unpacking(
 	uint8_t *unpacked,
 	uint8_t num_char)
 {
-	uint8_t shift = 1;
-	uint8_t index_pack = 1;
+	uint8_t index_pack = 0;
 	uint8_t index_char = 0;
 
 	if ((packed == NULL) || (unpacked == NULL) || (num_char == 0)) {
 		return 0;
 	}
 
-	unpacked[0] = packed[0] & STR_7BIT_CODE_MASK;
-	index_char++;
+	/* Unpack full groups of 7 bytes into 8 characters at a time */
+	while (num_char - index_char >= STR_7BIT_GROUP_CHARS) {
+		uint64_t group = 0;
 
-	while (index_char < num_char) {
-		unpacked[index_char] =
-			(packed[index_pack] << shift) | (packed[index_pack - 1] >> (8 - shift));
-		unpacked[index_char] &= STR_7BIT_CODE_MASK;
+		for (int i = 0; i < STR_7BIT_GROUP_BYTES; i++) {
+			group |= (uint64_t)packed[index_pack + i] << (8 * i);
+		}
+		for (int i = 0; i < STR_7BIT_GROUP_CHARS; i++) {
+			unpacked[index_char + i] = (group >> (7 * i)) & STR_7BIT_CODE_MASK;
+		}
 
-		shift++;
-		if (shift == 8) {
-			shift = 0;
-		} else {
-			index_pack++;
+		index_pack += STR_7BIT_GROUP_BYTES;
+		index_char += STR_7BIT_GROUP_CHARS;
+	}
+
+	/* Remaining characters. Only the bytes that hold bits of the character are read. */
+	for (uint8_t i = 0; index_char < num_char; i++, index_char++) {
+		uint8_t byte = index_pack + (7 * i) / 8;
+		uint8_t bit = (7 * i) % 8;
+		uint8_t value = packed[byte] >> bit;
+
+		if (bit > 1) {
+			value |= packed[byte + 1] << (8 - bit);
 		}
-		index_char++;
+		unpacked[index_char] = value & STR_7BIT_CODE_MASK;
 	}
 
 	return index_char;
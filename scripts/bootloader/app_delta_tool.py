@@ -0,0 +1,316 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""
+Utility for creating application delta patches.
+
+An application delta patch updates the image in the primary slot to a new image,
+and is applied by the application delta DFU target while it is downloaded.
+See include/dfu/dfu_target_app_delta.h for the format, all fields little-endian:
+
+- Header: magic, source size, target size, SHA-256 of the source image and
+  SHA-256 of the target image.
+- Records until the target image is complete. Each record holds the number of
+  target bytes copied from the source image, the number of target bytes stored
+  in the patch and the source offset adjustment after the record. It is
+  followed by the copy operations and the inserted bytes.
+- A copy operation holds the number of source bytes copied unchanged and the
+  number of source bytes replaced by the bytes following the operation.
+
+Like bsdiff, the patch is built from the regions of the target image that match
+the source image, possibly at a different offset. Matching regions at the same
+offset from each other are merged, so that small changes, such as updated
+addresses, are stored as replaced bytes within a copy.
+
+Usage examples:
+
+Creating a patch:
+./app_delta_tool.py create --source old_app.bin --target new_app.bin app_delta.bin
+
+Applying a patch:
+./app_delta_tool.py apply --source old_app.bin app_delta.bin new_app.bin
+
+Showing a patch header:
+./app_delta_tool.py show app_delta.bin
+"""
+
+import argparse
+import hashlib
+import struct
+
+MAGIC = 0x544c4441
+HEADER_FORMAT = '<III32s32s'
+RECORD_FORMAT = '<IIi'
+COPY_OP_FORMAT = '<HH'
+COPY_OP_MAX_LEN = 0xffff
+
+# Length of the blocks used to find the regions of the target that match the source
+BLOCK_LEN = 16
+# Number of source offsets kept per block; repeated blocks, like padding, keep the first ones
+BLOCK_CANDIDATES_MAX = 8
+# Number of bytes compared at a time when extending a match
+COMPARE_LEN = 64
+
+
+def match_len(source: bytes, source_off: int, target: bytes, target_off: int) -> int:
+    """
+    Length of the identical data at the given offsets of the source and the target
+    """
+
+    length = 0
+    max_len = min(len(source) - source_off, len(target) - target_off)
+
+    while length + COMPARE_LEN <= max_len and \
+            source[source_off + length:source_off + length + COMPARE_LEN] == \
+            target[target_off + length:target_off + length + COMPARE_LEN]:
+        length += COMPARE_LEN
+
+    while length < max_len and source[source_off + length] == target[target_off + length]:
+        length += 1
+
+    return length
+
+
+def find_matches(source: bytes, target: bytes) -> list:
+    """
+    Find the regions of the target that match the source, as
+    (target offset, source offset, length) tuples in target order
+    """
+
+    index = {}
+    for off in range(len(source) - BLOCK_LEN + 1):
+        candidates = index.setdefault(source[off:off + BLOCK_LEN], [])
+        if len(candidates) < BLOCK_CANDIDATES_MAX:
+            candidates.append(off)
+
+    matches = []
+    delta = None
+    target_off = 0
+
+    while target_off + BLOCK_LEN <= len(target):
+        best_off = None
+        best_len = 0
+
+        # Prefer continuing at the offset of the previous match
+        if delta is not None and 0 <= target_off + delta < len(source):
+            best_off = target_off + delta
+            best_len = match_len(source, best_off, target, target_off)
+
+        for source_off in index.get(target[target_off:target_off + BLOCK_LEN], []):
+            length = match_len(source, source_off, target, target_off)
+            if length > best_len:
+                best_off = source_off
+                best_len = length
+
+        if best_len >= BLOCK_LEN:
+            matches.append((target_off, best_off, best_len))
+            delta = best_off - target_off
+            target_off += best_len
+        else:
+            target_off += 1
+
+    return matches
+
+
+def merge_matches(matches: list) -> list:
+    """
+    Merge the matches at the same offset from each other into copy regions, as
+    [target offset, source offset, length] lists. The data between the merged
+    matches replaces the source data.
+    """
+
+    regions = []
+
+    for target_off, source_off, length in matches:
+        if regions and regions[-1][1] - regions[-1][0] == source_off - target_off:
+            regions[-1][2] = target_off + length - regions[-1][0]
+        else:
+            regions.append([target_off, source_off, length])
+
+    return regions
+
+
+def copy_ops(source: bytes, source_off: int, target: bytes, target_off: int,
+             length: int) -> bytes:
+    """
+    Encode the copy of a region as runs of unchanged and replaced bytes
+    """
+
+    ops = bytearray()
+    off = 0
+
+    while off < length:
+        same_len = 0
+        while off + same_len < length and same_len < COPY_OP_MAX_LEN and \
+                source[source_off + off + same_len] == target[target_off + off + same_len]:
+            same_len += 1
+
+        diff_off = off + same_len
+        diff_len = 0
+        while diff_off + diff_len < length and diff_len < COPY_OP_MAX_LEN and \
+                source[source_off + diff_off + diff_len] != \
+                target[target_off + diff_off + diff_len]:
+            diff_len += 1
+
+        ops += struct.pack(COPY_OP_FORMAT, same_len, diff_len)
+        ops += target[target_off + diff_off:target_off + diff_off + diff_len]
+        off = diff_off + diff_len
+
+    return bytes(ops)
+
+
+def create_patch(source: bytes, target: bytes) -> bytes:
+    """
+    Create a patch that updates the source image to the target image
+    """
+
+    if not target:
+        raise ValueError('Target image is empty')
+
+    regions = merge_matches(find_matches(source, target))
+
+    patch = bytearray(struct.pack(HEADER_FORMAT, MAGIC, len(source), len(target),
+                                  hashlib.sha256(source).digest(),
+                                  hashlib.sha256(target).digest()))
+
+    # The target data before the first match is inserted by a record without a copy
+    if not regions or regions[0][0] > 0:
+        regions.insert(0, [0, 0, 0])
+
+    for i, (target_off, source_off, length) in enumerate(regions):
+        if i + 1 < len(regions):
+            insert_end, next_source_off, _ = regions[i + 1]
+        else:
+            insert_end, next_source_off = len(target), source_off + length
+
+        patch += struct.pack(RECORD_FORMAT, length, insert_end - target_off - length,
+                             next_source_off - source_off - length)
+        patch += copy_ops(source, source_off, target, target_off, length)
+        patch += target[target_off + length:insert_end]
+
+    return bytes(patch)
+
+
+def apply_patch(source: bytes, patch: bytes) -> bytes:
+    """
+    Apply a patch to the source image, as done by the DFU target
+    """
+
+    magic, source_size, target_size, source_hash, target_hash = \
+        struct.unpack_from(HEADER_FORMAT, patch)
+    off = struct.calcsize(HEADER_FORMAT)
+
+    if magic != MAGIC:
+        raise ValueError('Invalid patch magic')
+    if len(source) != source_size or hashlib.sha256(source).digest() != source_hash:
+        raise ValueError('Source image does not match the patch')
+
+    target = bytearray()
+    source_off = 0
+
+    while len(target) < target_size:
+        copy_len, insert_len, seek = struct.unpack_from(RECORD_FORMAT, patch, off)
+        off += struct.calcsize(RECORD_FORMAT)
+
+        while copy_len > 0:
+            same_len, diff_len = struct.unpack_from(COPY_OP_FORMAT, patch, off)
+            off += struct.calcsize(COPY_OP_FORMAT)
+            if same_len + diff_len == 0 or same_len + diff_len > copy_len:
+                raise ValueError('Invalid copy operation')
+
+            target += source[source_off:source_off + same_len]
+            target += patch[off:off + diff_len]
+            off += diff_len
+            source_off += same_len + diff_len
+            copy_len -= same_len + diff_len
+
+        target += patch[off:off + insert_len]
+        off += insert_len
+        source_off += seek
+
+    if off != len(patch) or hashlib.sha256(target).digest() != target_hash:
+        raise ValueError('Patched image does not match the patch')
+
+    return bytes(target)
+
+
+def show_header(input_file: str) -> None:
+    """
+    Parse and print the patch header
+    """
+
+    with open(input_file, 'rb') as file:
+        magic, source_size, target_size, source_hash, target_hash = \
+            struct.unpack(HEADER_FORMAT, file.read(struct.calcsize(HEADER_FORMAT)))
+
+    if magic != MAGIC:
+        raise ValueError('Invalid patch magic')
+
+    print(f'Source: {source_size} bytes, SHA-256 {source_hash.hex()}')
+    print(f'Target: {target_size} bytes, SHA-256 {target_hash.hex()}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Application delta patch tool',
+                                     fromfile_prefix_chars='@',
+                                     allow_abbrev=False)
+    subcommands = parser.add_subparsers(dest='subcommand', title='valid subcommands')
+
+    create_parser = subcommands.add_parser(
+        'create', help='Create a patch')
+    create_parser.add_argument(
+        '-s', '--source', required=True, help='Path to the image in the primary slot')
+    create_parser.add_argument(
+        '-t', '--target', required=True, help='Path to the new image')
+    create_parser.add_argument(
+        'output_file', help='Path to output patch file')
+
+    apply_parser = subcommands.add_parser(
+        'apply', help='Apply a patch')
+    apply_parser.add_argument(
+        '-s', '--source', required=True, help='Path to the image in the primary slot')
+    apply_parser.add_argument(
+        'input_file', help='Path to patch file')
+    apply_parser.add_argument(
+        'output_file', help='Path to output image file')
+
+    show_parser = subcommands.add_parser(
+        'show', help='Show patch header')
+    show_parser.add_argument(
+        'input_file', help='Path to patch file')
+
+    args = parser.parse_args()
+
+    if args.subcommand == 'create':
+        with open(args.source, 'rb') as file:
+            source = file.read()
+        with open(args.target, 'rb') as file:
+            target = file.read()
+
+        patch = create_patch(source, target)
+        # Make sure that the patch reproduces the target image
+        if apply_patch(source, patch) != target:
+            raise RuntimeError('Patch does not reproduce the target image')
+
+        with open(args.output_file, 'wb') as file:
+            file.write(patch)
+        print(f'Patch: {len(patch)} bytes for a {len(target)} byte image')
+    elif args.subcommand == 'apply':
+        with open(args.source, 'rb') as file:
+            source = file.read()
+        with open(args.input_file, 'rb') as file:
+            patch = file.read()
+
+        with open(args.output_file, 'wb') as file:
+            file.write(apply_patch(source, patch))
+    elif args.subcommand == 'show':
+        show_header(args.input_file)
+    else:
+        parser.print_help()
+
+
+if __name__ == "__main__":
+    main()
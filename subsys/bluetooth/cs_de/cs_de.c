@@ -11,9 +11,12 @@
 
 #include <zephyr/bluetooth/hci_types.h>
 #include <zephyr/logging/log.h>
+#include <dsp/basic_math_functions.h>
+#include <dsp/complex_math_functions.h>
 #include <dsp/transform_functions.h>
 #include <dsp/fast_math_functions.h>
 #include <dsp/statistics_functions.h>
+#include <dsp/support_functions.h>
 #include <arm_const_structs.h>
 #include <bluetooth/cs_de.h>
 
@@ -32,6 +35,27 @@ LOG_MODULE_REGISTER(cs_de, CONFIG_BT_CS_DE_LOG_LEVEL);
 #define NORMAL_PEAK_TO_NULL                                                                        \
 	((CONFIG_BT_CS_DE_NFFT_SIZE + CS_DE_NUM_CHANNELS - 1) / (CS_DE_NUM_CHANNELS))
 
+/* The FFT twiddle factors and bit reversal tables are constant. They are shared by all
+ * of the antenna paths and procedures.
+ */
+#if CONFIG_BT_CS_DE_NFFT_SIZE == 512
+#define CFFT_F32_INSTANCE arm_cfft_sR_f32_len512
+#define CFFT_Q31_INSTANCE arm_cfft_sR_q31_len512
+#elif CONFIG_BT_CS_DE_NFFT_SIZE == 1024
+#define CFFT_F32_INSTANCE arm_cfft_sR_f32_len1024
+#define CFFT_Q31_INSTANCE arm_cfft_sR_q31_len1024
+#elif CONFIG_BT_CS_DE_NFFT_SIZE == 2048
+#define CFFT_F32_INSTANCE arm_cfft_sR_f32_len2048
+#define CFFT_Q31_INSTANCE arm_cfft_sR_q31_len2048
+#else
+#error "Unsupported CONFIG_BT_CS_DE_NFFT_SIZE"
+#endif
+
+/* Peak value of the normalized combined IQ values converted to Q31. Leave headroom to
+ * avoid saturation in the conversion.
+ */
+#define Q31_INPUT_PEAK (0.5f)
+
 static float m_iq_scratch_mem[2 * CONFIG_BT_CS_DE_NFFT_SIZE];
 
 static cs_de_quality_t set_best_estimate(cs_de_dist_estimates_t *p_estimates_public)
@@ -83,10 +107,12 @@ cs_de_quality_t cs_de_calc(cs_de_report_t *p_report)
 			continue;
 		}
 
-		memset(m_iq_scratch_mem, 0, sizeof(m_iq_scratch_mem));
-
-		/* Combine init and refl IQ values and store in scratch mem. */
+		/* Combine init and refl IQ values and store in scratch mem. The remaining part of
+		 * the scratch mem is zero padding for the IFFT.
+		 */
 		cs_de_combined_iq_calculate(&p_report->iq_tones[ap], m_iq_scratch_mem);
+		memset(&m_iq_scratch_mem[2 * CS_DE_NUM_CHANNELS], 0,
+		       sizeof(m_iq_scratch_mem) - (2 * CS_DE_NUM_CHANNELS * sizeof(float)));
 
 		p_report->distance_estimates[ap].phase_slope = cs_de_phase_slope(m_iq_scratch_mem);
 
@@ -213,6 +239,50 @@ static int32_t calculate_left_null_compensation_of_peak(int32_t peak_index,
 	return compensated_peak_index;
 }
 
+#if defined(CONFIG_BT_CS_DE_IFFT_Q31)
+static void calculate_fft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE])
+{
+	/* The buffer is reused for the Q31 values. Zero padding has the same representation in
+	 * both formats, so only the combined IQ values need to be converted.
+	 */
+	q31_t *iq_tones_comb_q31 = (q31_t *)iq_tones_comb;
+	float iq_abs_max;
+	uint32_t iq_abs_max_index;
+
+	arm_absmax_f32(iq_tones_comb, 2 * CS_DE_NUM_CHANNELS, &iq_abs_max, &iq_abs_max_index);
+
+	if (iq_abs_max == 0.0f) {
+		memset(iq_tones_comb, 0, CONFIG_BT_CS_DE_NFFT_SIZE * sizeof(float));
+		return;
+	}
+
+	float input_scale = Q31_INPUT_PEAK / iq_abs_max;
+
+	arm_scale_f32(iq_tones_comb, input_scale, iq_tones_comb, 2 * CS_DE_NUM_CHANNELS);
+	arm_float_to_q31(iq_tones_comb, iq_tones_comb_q31, 2 * CS_DE_NUM_CHANNELS);
+
+	/* The Q31 FFT output is downscaled by CONFIG_BT_CS_DE_NFFT_SIZE. */
+	arm_cfft_q31(&CFFT_Q31_INSTANCE, iq_tones_comb_q31, 0, 1);
+
+	/* The magnitude is in the 2.30 format. */
+	arm_cmplx_mag_q31(iq_tones_comb_q31, iq_tones_comb_q31, CONFIG_BT_CS_DE_NFFT_SIZE);
+	arm_q31_to_float(iq_tones_comb_q31, iq_tones_comb, CONFIG_BT_CS_DE_NFFT_SIZE);
+
+	/* Revert the input normalization and the 2.30 format. */
+	arm_scale_f32(iq_tones_comb, 2.0f / input_scale, iq_tones_comb,
+		      CONFIG_BT_CS_DE_NFFT_SIZE);
+}
+#else
+static void calculate_fft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE])
+{
+	arm_cfft_f32(&CFFT_F32_INSTANCE, iq_tones_comb, 0, 1);
+
+	arm_cmplx_mag_f32(iq_tones_comb, iq_tones_comb, CONFIG_BT_CS_DE_NFFT_SIZE);
+	arm_scale_f32(iq_tones_comb, 1.0f / CONFIG_BT_CS_DE_NFFT_SIZE, iq_tones_comb,
+		      CONFIG_BT_CS_DE_NFFT_SIZE);
+}
+#endif /* defined(CONFIG_BT_CS_DE_IFFT_Q31) */
+
 static void calculate_ifft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE])
 {
 	/* This function calculates the magnitude of the IFFT of the input IQ values.
@@ -234,28 +304,12 @@ static void calculate_ifft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE
 		iq_tones_comb[i * 2 + 1] = -iq_tones_comb[i * 2 + 1];
 	}
 
-	/* Perform the FFT. */
-	#if CONFIG_BT_CS_DE_NFFT_SIZE == 512
-		arm_cfft_f32(&arm_cfft_sR_f32_len512, iq_tones_comb, 0, 1);
-	#elif CONFIG_BT_CS_DE_NFFT_SIZE == 1024
-		arm_cfft_f32(&arm_cfft_sR_f32_len1024, iq_tones_comb, 0, 1);
-	#elif CONFIG_BT_CS_DE_NFFT_SIZE == 2048
-		arm_cfft_f32(&arm_cfft_sR_f32_len2048, iq_tones_comb, 0, 1);
-	#else
-	#error
-	#endif
-
-	/* Compute the magnitude of complex values in
+	/* Perform the FFT and compute the magnitude of complex values in
 	 * iq_tones_comb[0:2*CONFIG_BT_CS_DE_NFFT_SIZE - 1]
-	 * and scale by 1/CONFIG_BT_CS_DE_NFFT_SIZE.
+	 * scaled by 1/CONFIG_BT_CS_DE_NFFT_SIZE.
 	 * Store output in iq_tones_comb[0:CONFIG_BT_CS_DE_NFFT_SIZE - 1]
 	 */
-	for (uint32_t n = 0; n < CONFIG_BT_CS_DE_NFFT_SIZE; n++) {
-		float realIn = iq_tones_comb[2 * n] / CONFIG_BT_CS_DE_NFFT_SIZE;
-		float imagIn = iq_tones_comb[(2 * n) + 1] / CONFIG_BT_CS_DE_NFFT_SIZE;
-
-		arm_sqrt_f32((realIn * realIn) + (imagIn * imagIn), &iq_tones_comb[n]);
-	}
+	calculate_fft_mag(iq_tones_comb);
 }
 
 static uint32_t find_ifft_peak_index(float ifft_mag[2 * CONFIG_BT_CS_DE_NFFT_SIZE])
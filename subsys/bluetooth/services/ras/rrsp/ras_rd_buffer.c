@@ -9,6 +9,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/slist.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/bluetooth/conn.h>
@@ -22,6 +23,9 @@ LOG_MODULE_DECLARE(ras_rrsp, CONFIG_BT_RAS_RRSP_LOG_LEVEL);
 #define RD_POOL_SIZE (CONFIG_BT_RAS_RRSP_MAX_ACTIVE_CONN * CONFIG_BT_RAS_RRSP_RD_BUFFERS_PER_CONN)
 #define DROP_PROCEDURE_COUNTER_EMPTY (-1)
 
+/* Reference counter value of a buffer that is being written. The buffer cannot be claimed. */
+#define REFCOUNT_WRITER_LOCKED (-1)
+
 BUILD_ASSERT(RD_POOL_SIZE <= UINT8_MAX);
 
 static struct ras_rd_buffer rd_buffer_pool[RD_POOL_SIZE];
@@ -65,15 +69,47 @@ static struct ras_rd_buffer *rd_buffer_get(struct bt_conn *conn, uint16_t rangin
 	return NULL;
 }
 
+static bool rd_buffer_writer_lock(struct ras_rd_buffer *buf)
+{
+	/* Readers cannot claim the buffer once it is locked by the writer. */
+	return atomic_cas(&buf->refcount, 0, REFCOUNT_WRITER_LOCKED);
+}
+
+static bool rd_buffer_reader_ref(struct ras_rd_buffer *buf)
+{
+	atomic_val_t refcount;
+
+	do {
+		refcount = atomic_get(&buf->refcount);
+
+		if (refcount == REFCOUNT_WRITER_LOCKED) {
+			return false;
+		}
+	} while (!atomic_cas(&buf->refcount, refcount, refcount + 1));
+
+	return true;
+}
+
 static void rd_buffer_init(struct bt_conn *conn, struct ras_rd_buffer *buf,
 			   uint16_t ranging_counter)
 {
+	__ASSERT_NO_MSG(atomic_get(&buf->refcount) == REFCOUNT_WRITER_LOCKED);
+
 	buf->conn = bt_conn_ref(conn);
 	buf->ranging_counter = ranging_counter;
 	buf->ready = false;
 	buf->busy = true;
 	buf->acked = false;
 	buf->subevent_cursor = 0;
+}
+
+static void rd_buffer_publish(struct ras_rd_buffer *buf)
+{
+	buf->ready = true;
+	buf->busy = false;
+
+	/* Make the stored ranging data visible before the buffer can be claimed. */
+	barrier_dmem_fence_full();
 	atomic_clear(&buf->refcount);
 }
 
@@ -87,8 +123,9 @@ static void rd_buffer_free(struct ras_rd_buffer *buf)
 	buf->ready = false;
 	buf->busy = false;
 	buf->acked = false;
-	buf->refcount = 0;
 	buf->subevent_cursor = 0;
+
+	barrier_dmem_fence_full();
 	atomic_clear(&buf->refcount);
 }
 
@@ -128,18 +165,26 @@ static struct ras_rd_buffer *rd_buffer_alloc(struct bt_conn *conn, uint16_t rang
 	 * the maximum number of buffers allocated.
 	 */
 	if (conn_buffer_count < CONFIG_BT_RAS_RRSP_RD_BUFFERS_PER_CONN) {
+		__ASSERT_NO_MSG(available_free_buffer != NULL);
+
+		if (!rd_buffer_writer_lock(available_free_buffer)) {
+			return NULL;
+		}
+
 		rd_buffer_init(conn, available_free_buffer, ranging_counter);
 
 		return available_free_buffer;
 	}
 
-	/* Overwrite the oldest stored ranging buffer that is not in use */
-	if (available_oldest_buffer != NULL) {
+	/* Overwrite the oldest stored ranging buffer that is not in use. A reader could have
+	 * claimed the buffer after it was selected, so it is locked before it is overwritten.
+	 */
+	if ((available_oldest_buffer != NULL) && rd_buffer_writer_lock(available_oldest_buffer)) {
 		if (!available_oldest_buffer->acked) {
 			/* Only notify if the peer has not read the buffer yet. */
 			notify_rd_overwritten(conn, oldest_ranging_counter);
 		}
-		rd_buffer_free(available_oldest_buffer);
+		bt_conn_unref(available_oldest_buffer->conn);
 
 		rd_buffer_init(conn, available_oldest_buffer, ranging_counter);
 
@@ -291,8 +336,7 @@ static void subevent_data_available(struct bt_conn *conn,
 
 	if (hdr->ranging_done_status == BT_CONN_LE_CS_PROCEDURE_COMPLETE ||
 	    hdr->ranging_done_status == BT_CONN_LE_CS_PROCEDURE_ABORTED) {
-		buf->ready = true;
-		buf->busy = false;
+		rd_buffer_publish(buf);
 		notify_new_rd_stored(conn, ranging_counter);
 	}
 }
@@ -330,17 +374,23 @@ struct ras_rd_buffer *bt_ras_rd_buffer_claim(struct bt_conn *conn, uint16_t rang
 {
 	struct ras_rd_buffer *buf = rd_buffer_get(conn, ranging_counter, true, false);
 
-	if (buf) {
-		atomic_inc(&buf->refcount);
-		return buf;
+	if (!buf || !rd_buffer_reader_ref(buf)) {
+		return NULL;
 	}
 
-	return NULL;
+	/* The buffer could have been overwritten before the reference was taken. */
+	barrier_dmem_fence_full();
+	if (buf->conn != conn || buf->ranging_counter != ranging_counter || !buf->ready) {
+		atomic_dec(&buf->refcount);
+		return NULL;
+	}
+
+	return buf;
 }
 
 int bt_ras_rd_buffer_release(struct ras_rd_buffer *buf)
 {
-	if (!buf || atomic_get(&buf->refcount) == 0) {
+	if (!buf || atomic_get(&buf->refcount) <= 0) {
 		return -EINVAL;
 	}
 
@@ -240,31 +240,14 @@ struct __packed fw_validation_pointer {
 OFFSET_CHECK(struct fw_validation_pointer, magic, 0);
 OFFSET_CHECK(struct fw_validation_pointer, validation_info, 12);
 
-static bool validation_info_check(const struct fw_validation_info *vinfo)
-{
-	const uint32_t validation_info_magic[] = {VALIDATION_INFO_MAGIC};
-
-	if (memcmp(vinfo->magic, validation_info_magic,
-					CONFIG_FW_INFO_MAGIC_LEN) == 0) {
-		return vinfo;
-	}
-	return NULL;
-}
-
-
 /* Find the validation_info at the end of the firmware. */
 static const struct fw_validation_info *
 validation_info_find(uint32_t start_address, uint32_t search_distance)
 {
-	const struct fw_validation_info *vinfo;
+	const uint32_t validation_info_magic[] = {VALIDATION_INFO_MAGIC};
 
-	for (int i = 0; i <= search_distance; i++) {
-		vinfo = (const struct fw_validation_info *)(start_address + i);
-		if (validation_info_check(vinfo)) {
-			return vinfo;
-		}
-	}
-	return NULL;
+	return magic_find(start_address, search_distance, validation_info_magic,
+			  CONFIG_FW_INFO_MAGIC_LEN);
 }
 
 #if defined(CONFIG_SB_VALIDATE_FW_SIGNATURE)
@@ -11,6 +11,7 @@
 extern "C" {
 #endif
 
+#include <string.h>
 #include <zephyr/types.h>
 
 
@@ -43,6 +44,24 @@ static bool region_within(uint32_t inner_start, uint32_t inner_end,
 	return true;
 }
 
+/* Find the first address within search_distance bytes after start_address
+ * where the magic is found. The validation metadata can be placed at any
+ * offset after the firmware (see the --offset argument of validation_data.py),
+ * so every byte offset is checked, not only word aligned ones.
+ */
+static const void *magic_find(uintptr_t start_address, uint32_t search_distance,
+			const uint32_t *magic, size_t magic_len)
+{
+	for (uint32_t i = 0; i <= search_distance; i++) {
+		const void *candidate = (const void *)(start_address + i);
+
+		if (memcmp(candidate, magic, magic_len) == 0) {
+			return candidate;
+		}
+	}
+	return NULL;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -26,6 +26,10 @@ DEF_DFU_TARGET(modem_delta);
 #include "dfu/dfu_target_mcuboot.h"
 DEF_DFU_TARGET(mcuboot);
 #endif
+#ifdef CONFIG_DFU_TARGET_APP_DELTA
+#include "dfu/dfu_target_app_delta.h"
+DEF_DFU_TARGET(app_delta);
+#endif
 #ifdef CONFIG_DFU_TARGET_FULL_MODEM
 #include "dfu/dfu_target_full_modem.h"
 DEF_DFU_TARGET(full_modem);
@@ -56,6 +60,11 @@ enum dfu_target_image_type dfu_target_img_type(const void *const buf, size_t len
 		return DFU_TARGET_IMAGE_TYPE_MCUBOOT;
 	}
 #endif
+#ifdef CONFIG_DFU_TARGET_APP_DELTA
+	if (dfu_target_app_delta_identify(buf)) {
+		return DFU_TARGET_IMAGE_TYPE_APP_DELTA;
+	}
+#endif
 #ifdef CONFIG_DFU_TARGET_MODEM_DELTA
 	if (dfu_target_modem_delta_identify(buf)) {
 		return DFU_TARGET_IMAGE_TYPE_MODEM_DELTA;
@@ -98,6 +107,11 @@ int dfu_target_init(int img_type, int img_num, size_t file_size, dfu_target_call
 		new_target = &dfu_target_mcuboot;
 	}
 #endif
+#ifdef CONFIG_DFU_TARGET_APP_DELTA
+	if (img_type == DFU_TARGET_IMAGE_TYPE_APP_DELTA) {
+		new_target = &dfu_target_app_delta;
+	}
+#endif
 #ifdef CONFIG_DFU_TARGET_MODEM_DELTA
 	if (img_type == DFU_TARGET_IMAGE_TYPE_MODEM_DELTA) {
 		new_target = &dfu_target_modem_delta;
@@ -129,10 +143,12 @@ int dfu_target_init(int img_type, int img_num, size_t file_size, dfu_target_call
 	 * Avoid re-initializing generally to ensure that the download can
 	 * continue where it left off. Re-initializing is required for
 	 * modem_delta upgrades to re-open the DFU socket that is closed on
-	 * abort and to change the image number.
+	 * abort and to change the image number. Application delta patches
+	 * are always applied from the start.
 	 */
 	if (new_target == current_target && img_type != DFU_TARGET_IMAGE_TYPE_MODEM_DELTA &&
-	    img_type != DFU_TARGET_IMAGE_TYPE_SMP && current_img_num == img_num) {
+	    img_type != DFU_TARGET_IMAGE_TYPE_SMP && img_type != DFU_TARGET_IMAGE_TYPE_APP_DELTA &&
+	    current_img_num == img_num) {
 		return 0;
 	}
 
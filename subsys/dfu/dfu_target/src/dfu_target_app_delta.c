@@ -0,0 +1,489 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <psa/crypto.h>
+#include <dfu/dfu_target.h>
+#include <dfu/dfu_target_mcuboot.h>
+#include <dfu/dfu_target_app_delta.h>
+
+LOG_MODULE_REGISTER(dfu_target_app_delta, CONFIG_DFU_TARGET_LOG_LEVEL);
+
+#define SOURCE_PARTITION_ID FIXED_PARTITION_ID(slot0_partition)
+
+enum patch_state {
+	STATE_HEADER,
+	STATE_RECORD,
+	STATE_COPY_OP,
+	STATE_COPY_SAME,
+	STATE_COPY_DIFF,
+	STATE_INSERT,
+	STATE_DONE,
+	STATE_ERROR,
+};
+
+static struct {
+	enum patch_state state;
+	/* Header, record or copy operation being received */
+	uint8_t field[sizeof(struct dfu_target_app_delta_header)];
+	size_t field_len;
+	uint32_t source_size;
+	uint32_t target_size;
+	uint8_t target_hash[DFU_TARGET_APP_DELTA_HASH_SIZE];
+	/* Parts of the current record left to apply */
+	size_t copy_left;
+	size_t same_left;
+	size_t diff_left;
+	size_t insert_left;
+	int32_t seek;
+	size_t source_off;
+	size_t target_off;
+	size_t patch_off;
+	psa_hash_operation_t hash;
+	const struct flash_area *source;
+	bool target_open;
+} patch;
+
+static uint8_t source_buf[CONFIG_DFU_TARGET_APP_DELTA_SOURCE_BUF_SIZE];
+
+bool dfu_target_app_delta_identify(const void *const buf)
+{
+	return sys_get_le32(buf) == DFU_TARGET_APP_DELTA_MAGIC;
+}
+
+static void patch_state_reset(void)
+{
+	if (patch.source != NULL) {
+		flash_area_close(patch.source);
+	}
+
+	(void)psa_hash_abort(&patch.hash);
+
+	memset(&patch, 0, sizeof(patch));
+	patch.hash = psa_hash_operation_init();
+	patch.state = STATE_HEADER;
+}
+
+/**
+ * @brief Collect a fixed size field of the patch.
+ *
+ * @return true when the whole field has been received.
+ */
+static bool field_collect(const uint8_t **buf, size_t *len, size_t field_size)
+{
+	size_t chunk_len = MIN(*len, field_size - patch.field_len);
+
+	memcpy(&patch.field[patch.field_len], *buf, chunk_len);
+	patch.field_len += chunk_len;
+	*buf += chunk_len;
+	*len -= chunk_len;
+
+	if (patch.field_len < field_size) {
+		return false;
+	}
+
+	patch.field_len = 0;
+
+	return true;
+}
+
+static int source_verify(const uint8_t *expected_hash)
+{
+	uint8_t hash[DFU_TARGET_APP_DELTA_HASH_SIZE];
+	psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
+	psa_status_t status;
+	size_t hash_len;
+	size_t chunk_len;
+	int err;
+
+	if (patch.source_size > patch.source->fa_size) {
+		LOG_ERR("Source image does not fit in the active slot");
+		return -ENOENT;
+	}
+
+	status = psa_hash_setup(&operation, PSA_ALG_SHA_256);
+	if (status != PSA_SUCCESS) {
+		return -EIO;
+	}
+
+	for (size_t off = 0; off < patch.source_size; off += chunk_len) {
+		chunk_len = MIN(sizeof(source_buf), patch.source_size - off);
+
+		err = flash_area_read(patch.source, off, source_buf, chunk_len);
+		if (err != 0) {
+			psa_hash_abort(&operation);
+			return err;
+		}
+
+		status = psa_hash_update(&operation, source_buf, chunk_len);
+		if (status != PSA_SUCCESS) {
+			psa_hash_abort(&operation);
+			return -EIO;
+		}
+	}
+
+	status = psa_hash_finish(&operation, hash, sizeof(hash), &hash_len);
+	if (status != PSA_SUCCESS) {
+		return -EIO;
+	}
+
+	if (memcmp(hash, expected_hash, sizeof(hash)) != 0) {
+		LOG_ERR("Active image is not the source image of the patch");
+		return -ENOENT;
+	}
+
+	return 0;
+}
+
+static int target_open(void)
+{
+	size_t offset;
+	int err;
+
+	err = dfu_target_mcuboot_init(patch.target_size, 0, NULL);
+	if (err != 0) {
+		return err;
+	}
+
+	err = dfu_target_mcuboot_offset_get(&offset);
+	if (err != 0) {
+		return err;
+	}
+
+	if (offset != 0) {
+		/* The patch is applied from the start, drop progress of an earlier image. */
+		err = dfu_target_mcuboot_reset();
+		if (err != 0) {
+			return err;
+		}
+
+		err = dfu_target_mcuboot_init(patch.target_size, 0, NULL);
+		if (err != 0) {
+			return err;
+		}
+	}
+
+	patch.target_open = true;
+
+	return 0;
+}
+
+static int header_apply(void)
+{
+	const struct dfu_target_app_delta_header *header = (const void *)patch.field;
+	int err;
+
+	if (sys_le32_to_cpu(header->magic) != DFU_TARGET_APP_DELTA_MAGIC) {
+		LOG_ERR("Invalid patch magic");
+		return -EINVAL;
+	}
+
+	patch.source_size = sys_le32_to_cpu(header->source_size);
+	patch.target_size = sys_le32_to_cpu(header->target_size);
+	memcpy(patch.target_hash, header->target_hash, sizeof(patch.target_hash));
+
+	if (patch.target_size == 0) {
+		return -EINVAL;
+	}
+
+	err = flash_area_open(SOURCE_PARTITION_ID, &patch.source);
+	if (err != 0) {
+		LOG_ERR("Unable to open the active slot: %d", err);
+		return err;
+	}
+
+	err = source_verify(header->source_hash);
+	if (err != 0) {
+		return err;
+	}
+
+	if (psa_hash_setup(&patch.hash, PSA_ALG_SHA_256) != PSA_SUCCESS) {
+		return -EIO;
+	}
+
+	err = target_open();
+	if (err != 0) {
+		LOG_ERR("Unable to open the secondary slot: %d", err);
+		return err;
+	}
+
+	LOG_INF("Applying patch, %u to %u bytes", patch.source_size, patch.target_size);
+
+	patch.state = STATE_RECORD;
+
+	return 0;
+}
+
+static int record_apply(void)
+{
+	const struct dfu_target_app_delta_record *record = (const void *)patch.field;
+
+	patch.copy_left = sys_le32_to_cpu(record->copy_len);
+	patch.insert_left = sys_le32_to_cpu(record->insert_len);
+	patch.seek = (int32_t)sys_le32_to_cpu(record->seek);
+
+	if (patch.copy_left > patch.target_size - patch.target_off ||
+	    patch.insert_left > patch.target_size - patch.target_off - patch.copy_left) {
+		LOG_ERR("Record exceeds the target image");
+		return -EINVAL;
+	}
+
+	if (patch.copy_left > patch.source_size - patch.source_off) {
+		LOG_ERR("Record exceeds the source image");
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int copy_op_apply(void)
+{
+	const struct dfu_target_app_delta_copy_op *op = (const void *)patch.field;
+	size_t op_len;
+
+	patch.same_left = sys_le16_to_cpu(op->same_len);
+	patch.diff_left = sys_le16_to_cpu(op->diff_len);
+	op_len = patch.same_left + patch.diff_left;
+
+	if (op_len == 0 || op_len > patch.copy_left) {
+		LOG_ERR("Invalid copy operation");
+		return -EINVAL;
+	}
+
+	patch.copy_left -= op_len;
+
+	return 0;
+}
+
+/**
+ * @brief Select what to apply next, once a part of the record is complete.
+ */
+static int record_next(void)
+{
+	int64_t source_off;
+
+	if (patch.same_left > 0) {
+		patch.state = STATE_COPY_SAME;
+	} else if (patch.diff_left > 0) {
+		patch.state = STATE_COPY_DIFF;
+	} else if (patch.copy_left > 0) {
+		patch.state = STATE_COPY_OP;
+	} else if (patch.insert_left > 0) {
+		patch.state = STATE_INSERT;
+	} else {
+		source_off = (int64_t)patch.source_off + patch.seek;
+		if (source_off < 0 || source_off > patch.source_size) {
+			LOG_ERR("Seek outside the source image");
+			return -EINVAL;
+		}
+
+		patch.source_off = source_off;
+		patch.state = (patch.target_off == patch.target_size) ? STATE_DONE : STATE_RECORD;
+	}
+
+	return 0;
+}
+
+static int target_write(const uint8_t *data, size_t len)
+{
+	if (psa_hash_update(&patch.hash, data, len) != PSA_SUCCESS) {
+		return -EIO;
+	}
+
+	patch.target_off += len;
+
+	return dfu_target_mcuboot_write(data, len);
+}
+
+static int same_apply(void)
+{
+	size_t chunk_len;
+	int err;
+
+	while (patch.same_left > 0) {
+		chunk_len = MIN(sizeof(source_buf), patch.same_left);
+
+		err = flash_area_read(patch.source, patch.source_off, source_buf, chunk_len);
+		if (err != 0) {
+			return err;
+		}
+
+		err = target_write(source_buf, chunk_len);
+		if (err != 0) {
+			return err;
+		}
+
+		patch.source_off += chunk_len;
+		patch.same_left -= chunk_len;
+	}
+
+	return 0;
+}
+
+static int patch_apply(const uint8_t *buf, size_t len)
+{
+	size_t chunk_len;
+	int err = 0;
+
+	while (err == 0 && (len > 0 || patch.state == STATE_COPY_SAME)) {
+		switch (patch.state) {
+		case STATE_HEADER:
+			if (field_collect(&buf, &len, sizeof(struct dfu_target_app_delta_header))) {
+				err = header_apply();
+			}
+			break;
+		case STATE_RECORD:
+			if (field_collect(&buf, &len, sizeof(struct dfu_target_app_delta_record))) {
+				err = record_apply();
+				if (err == 0) {
+					err = record_next();
+				}
+			}
+			break;
+		case STATE_COPY_OP:
+			if (field_collect(&buf, &len,
+					  sizeof(struct dfu_target_app_delta_copy_op))) {
+				err = copy_op_apply();
+				if (err == 0) {
+					err = record_next();
+				}
+			}
+			break;
+		case STATE_COPY_SAME:
+			/* Source data does not consume patch data */
+			err = same_apply();
+			if (err == 0) {
+				err = record_next();
+			}
+			break;
+		case STATE_COPY_DIFF:
+			chunk_len = MIN(len, patch.diff_left);
+			err = target_write(buf, chunk_len);
+			buf += chunk_len;
+			len -= chunk_len;
+			patch.source_off += chunk_len;
+			patch.diff_left -= chunk_len;
+			if (err == 0 && patch.diff_left == 0) {
+				err = record_next();
+			}
+			break;
+		case STATE_INSERT:
+			chunk_len = MIN(len, patch.insert_left);
+			err = target_write(buf, chunk_len);
+			buf += chunk_len;
+			len -= chunk_len;
+			patch.insert_left -= chunk_len;
+			if (err == 0 && patch.insert_left == 0) {
+				err = record_next();
+			}
+			break;
+		case STATE_DONE:
+			LOG_ERR("Data after the end of the patch");
+			err = -EINVAL;
+			break;
+		default:
+			err = -EINVAL;
+			break;
+		}
+	}
+
+	return err;
+}
+
+int dfu_target_app_delta_init(size_t file_size, int img_num, dfu_target_callback_t cb)
+{
+	ARG_UNUSED(file_size);
+	ARG_UNUSED(cb);
+
+	if (img_num != 0) {
+		LOG_ERR("Only image pair 0 is supported");
+		return -ENOTSUP;
+	}
+
+	if (psa_crypto_init() != PSA_SUCCESS) {
+		return -EIO;
+	}
+
+	patch_state_reset();
+
+	return 0;
+}
+
+int dfu_target_app_delta_offset_get(size_t *out)
+{
+	if (out == NULL) {
+		return -EINVAL;
+	}
+
+	*out = patch.patch_off;
+
+	return 0;
+}
+
+int dfu_target_app_delta_write(const void *const buf, size_t len)
+{
+	int err;
+
+	if (patch.state == STATE_ERROR) {
+		return -EINVAL;
+	}
+
+	err = patch_apply(buf, len);
+	if (err != 0) {
+		LOG_ERR("Unable to apply patch at offset %zu: %d", patch.patch_off, err);
+		patch.state = STATE_ERROR;
+		return err;
+	}
+
+	patch.patch_off += len;
+
+	return 0;
+}
+
+int dfu_target_app_delta_done(bool successful)
+{
+	uint8_t hash[DFU_TARGET_APP_DELTA_HASH_SIZE];
+	size_t hash_len;
+	int result = 0;
+	int err = 0;
+
+	if (successful) {
+		if (patch.state != STATE_DONE) {
+			LOG_ERR("Patch is incomplete");
+			result = -EINVAL;
+		} else if (psa_hash_finish(&patch.hash, hash, sizeof(hash), &hash_len) !=
+			   PSA_SUCCESS) {
+			result = -EIO;
+		} else if (memcmp(hash, patch.target_hash, sizeof(hash)) != 0) {
+			LOG_ERR("Patched image hash mismatch");
+			result = -EINVAL;
+		}
+	}
+
+	if (patch.target_open) {
+		err = dfu_target_mcuboot_done(successful && result == 0);
+	}
+
+	patch_state_reset();
+
+	return (result != 0) ? result : err;
+}
+
+int dfu_target_app_delta_schedule_update(int img_num)
+{
+	return dfu_target_mcuboot_schedule_update(img_num);
+}
+
+int dfu_target_app_delta_reset(void)
+{
+	patch_state_reset();
+
+	return dfu_target_mcuboot_reset();
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024 Nordic Semiconductor ASA
+ * Copyright (c) 2020-2026 Nordic Semiconductor ASA
  *
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
@@ -24,6 +24,8 @@ static const char *current_id;
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 
 static char current_name_key[32];
+/* Write progress in the last stored record */
+static size_t progress_stored;
 
 /**
  * @brief Store the information stored in the stream_flash instance so that it
@@ -42,9 +44,25 @@ static int store_progress(void)
 		return err;
 	}
 
+	progress_stored = bytes_written;
+
 	return 0;
 }
 
+/**
+ * @brief Store the write progress if enough data has been written since the
+ *        last stored record.
+ */
+static int update_progress(void)
+{
+	if (stream_flash_bytes_written(&stream) - progress_stored <
+	    CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_INTERVAL) {
+		return 0;
+	}
+
+	return store_progress();
+}
+
 /**
  * @brief Function used by settings_load() to restore the stream_flash ctx.
  *	  See the Zephyr documentation of the settings subsystem for more
@@ -98,6 +116,165 @@ SETTINGS_STATIC_HANDLER_DEFINE(dfu_target, MODULE, NULL, settings_set,
 
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND
+/* Data passed to dfu_target_stream_write, but not yet written to flash */
+struct wb_buf {
+	void *fifo_reserved;
+	size_t len;
+	uint8_t data[CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND_BUF_SIZE];
+};
+
+/* One buffer is filled while the other one is written to flash */
+K_MEM_SLAB_DEFINE_STATIC(wb_slab, sizeof(struct wb_buf), 2, 4);
+static K_FIFO_DEFINE(wb_fifo);
+static K_SEM_DEFINE(wb_idle_sem, 0, 1);
+
+/* Buffer being filled by dfu_target_stream_write */
+static struct wb_buf *wb_active;
+/* Number of buffers queued for the flash thread */
+static atomic_t wb_queued;
+/* First error of the flash thread, returned by the next call to the stream */
+static int wb_err;
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+/**
+ * @brief Erase the page following the erased area, if the data written so far
+ *        reaches into the next staging buffer. Stream flash skips the erase
+ *        when the data is written to the page.
+ */
+static void wb_pre_erase(void)
+{
+	int err;
+	size_t ahead = stream_flash_bytes_written(&stream) + stream_flash_bytes_buffered(&stream) +
+		       CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND_BUF_SIZE;
+
+	if ((size_t)stream.erased_up_to >= MIN(ahead, stream.available)) {
+		return;
+	}
+
+	err = stream_flash_erase_page(&stream, stream.offset + stream.erased_up_to);
+	if (err != 0) {
+		/* Not critical, the page is erased when the data is written */
+		LOG_WRN("Unable to erase page ahead: %d", err);
+	}
+}
+#endif /* CONFIG_STREAM_FLASH_ERASE */
+
+static void wb_thread_fn(void *p1, void *p2, void *p3)
+{
+	struct wb_buf *buf;
+	int err;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		buf = k_fifo_get(&wb_fifo, K_FOREVER);
+
+		if (wb_err == 0) {
+			err = stream_flash_buffered_write(&stream, buf->data, buf->len, false);
+			if (err != 0) {
+				LOG_ERR("stream_flash_buffered_write error %d", err);
+				wb_err = err;
+			}
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
+			else {
+				err = update_progress();
+				if (err != 0) {
+					LOG_WRN("Unable to store write progress: %d", err);
+				}
+			}
+#endif
+		}
+
+		k_mem_slab_free(&wb_slab, buf);
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+		if (wb_err == 0 && atomic_get(&wb_queued) == 1) {
+			/* Nothing else to write, prepare for the next buffer */
+			wb_pre_erase();
+		}
+#endif
+
+		/* The stream is not idle until the page ahead has been erased */
+		if (atomic_dec(&wb_queued) == 1) {
+			k_sem_give(&wb_idle_sem);
+		}
+	}
+}
+
+K_THREAD_DEFINE(dfu_target_stream_wb_thread, CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND_STACK_SIZE,
+		wb_thread_fn, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND_THREAD_PRIO), 0, 0);
+
+static void wb_queue(void)
+{
+	atomic_inc(&wb_queued);
+	k_fifo_put(&wb_fifo, wb_active);
+	wb_active = NULL;
+}
+
+/**
+ * @brief Wait until the queued buffers have been written to flash.
+ */
+static int wb_wait(void)
+{
+	while (atomic_get(&wb_queued) != 0) {
+		(void)k_sem_take(&wb_idle_sem, K_FOREVER);
+	}
+
+	return wb_err;
+}
+
+/**
+ * @brief Write the buffer being filled, and wait until all data passed to the
+ *        stream has been written to flash.
+ */
+static int wb_flush(void)
+{
+	if (wb_active != NULL) {
+		if (wb_active->len > 0) {
+			wb_queue();
+		} else {
+			k_mem_slab_free(&wb_slab, wb_active);
+			wb_active = NULL;
+		}
+	}
+
+	return wb_wait();
+}
+
+static int wb_write(const uint8_t *buf, size_t len)
+{
+	size_t chunk_len;
+
+	if (wb_err != 0) {
+		return wb_err;
+	}
+
+	while (len > 0) {
+		if (wb_active == NULL) {
+			/* Waits while the other buffer is written to flash */
+			(void)k_mem_slab_alloc(&wb_slab, (void **)&wb_active, K_FOREVER);
+			wb_active->len = 0;
+		}
+
+		chunk_len = MIN(len, sizeof(wb_active->data) - wb_active->len);
+		memcpy(&wb_active->data[wb_active->len], buf, chunk_len);
+		wb_active->len += chunk_len;
+		buf += chunk_len;
+		len -= chunk_len;
+
+		if (wb_active->len == sizeof(wb_active->data)) {
+			wb_queue();
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND */
+
 struct stream_flash_ctx *dfu_target_stream_get_stream(void)
 {
 	return &stream;
@@ -145,8 +322,14 @@ int dfu_target_stream_init(const struct dfu_target_stream_init *init)
 		LOG_ERR("settings_load failed (err %d)", err);
 		return err;
 	}
+
+	progress_stored = stream_flash_bytes_written(&stream);
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND
+	wb_err = 0;
+#endif
+
 	return 0;
 }
 
@@ -156,6 +339,11 @@ int dfu_target_stream_offset_get(size_t *out)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND
+	/* Include the buffer being filled, as without write-behind */
+	(void)wb_flush();
+#endif
+
 	*out = stream_flash_bytes_written(&stream);
 
 	return 0;
@@ -167,6 +355,10 @@ int dfu_target_stream_bytes_buffered_get(size_t *out)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND
+	(void)wb_flush();
+#endif
+
 	*out = stream_flash_bytes_buffered(&stream);
 
 	return 0;
@@ -174,6 +366,10 @@ int dfu_target_stream_bytes_buffered_get(size_t *out)
 
 int dfu_target_stream_write(const uint8_t *buf, size_t len)
 {
+#ifdef CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND
+	/* Written to flash and progress stored by the flash thread */
+	return wb_write(buf, len);
+#else
 #ifdef CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS
 	/**
 	 * Flush immediately.
@@ -197,7 +393,7 @@ int dfu_target_stream_write(const uint8_t *buf, size_t len)
 	}
 
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
-	err = store_progress();
+	err = update_progress();
 	if (err != 0) {
 		/* Failing to store progress is not a critical error you'll just
 		 * be left to download a bit more if you fail and resume.
@@ -207,12 +403,25 @@ int dfu_target_stream_write(const uint8_t *buf, size_t len)
 #endif
 
 	return err;
+#endif /* CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND */
 }
 
 int dfu_target_stream_done(bool successful)
 {
 	int err = 0;
 
+#ifdef CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND
+	/* All data passed to the stream is written before it is completed */
+	int wb_rc = wb_flush();
+
+	if (wb_rc != 0) {
+		/* Keep the progress of the data that has been written */
+		LOG_ERR("Flash write error %d", wb_rc);
+		successful = false;
+		wb_err = 0;
+	}
+#endif
+
 	if (successful) {
 		err = stream_flash_buffered_write(&stream, NULL, 0, true);
 		if (err != 0) {
@@ -240,6 +449,12 @@ int dfu_target_stream_done(bool successful)
 
 	current_id = NULL;
 
+#ifdef CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND
+	if (wb_rc != 0) {
+		return wb_rc;
+	}
+#endif
+
 	return err;
 }
 
@@ -247,6 +462,17 @@ int dfu_target_stream_reset(void)
 {
 	int err = 0;
 
+#ifdef CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND
+	/* Drop the data that has not been queued, and let the queued data be written */
+	if (wb_active != NULL) {
+		k_mem_slab_free(&wb_slab, wb_active);
+		wb_active = NULL;
+	}
+
+	(void)wb_wait();
+	wb_err = 0;
+#endif
+
 	stream.buf_bytes = 0;
 	stream.bytes_written = 0;
 
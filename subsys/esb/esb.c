@@ -173,10 +173,22 @@ struct payload_tx_fifo {
 	atomic_t count;	/* Number of elements in the queue. */
 };
 
+/* Received packet stored in the RX FIFO. */
+struct rx_fifo_entry {
+	/* Radio PDU buffer owned by the entry. The radio receives directly into it. */
+	struct esb_radio_pdu *pdu;
+
+	uint8_t length;	/* Length of the received payload. */
+	uint8_t pipe;	/* Pipe the packet was received on. */
+	int8_t rssi;	/* RSSI of the received packet. */
+	uint8_t noack;	/* Packet was sent without acknowledgment request. */
+	uint8_t pid;	/* Packet ID. */
+};
+
 /* First-in, first-out queue of received payloads. */
 struct payload_rx_fifo {
 	 /* Payload queue */
-	struct esb_payload *payload[CONFIG_ESB_RX_FIFO_SIZE];
+	struct rx_fifo_entry entry[CONFIG_ESB_RX_FIFO_SIZE];
 
 	uint32_t back;	/* Back of the queue (last in). */
 	uint32_t front;	/* Front of queue (first out). */
@@ -276,8 +288,16 @@ static struct payload_rx_fifo rx_fifo;
 
 static uint8_t tx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH +
 				 sizeof(struct esb_radio_pdu)];
-static uint8_t rx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH +
-				 sizeof(struct esb_radio_pdu)];
+
+/* Radio PDU buffers for received packets. Every RX FIFO entry owns one buffer and the remaining
+ * buffer is used by the radio. After a packet is received, the radio buffer is exchanged with the
+ * buffer of the first free RX FIFO entry, so the packet is never copied in the radio ISR.
+ */
+#define RX_PDU_BUF_SIZE ROUND_UP(CONFIG_ESB_MAX_PAYLOAD_LENGTH + sizeof(struct esb_radio_pdu), 4)
+
+__ALIGN(4)
+static uint8_t rx_pdu_pool[CONFIG_ESB_RX_FIFO_SIZE + 1][RX_PDU_BUF_SIZE];
+static struct esb_radio_pdu *rx_radio_pdu;
 
 /* Random access buffer variables for ACK payload handling */
 struct payload_wrap ack_pl_wrap[CONFIG_ESB_TX_FIFO_SIZE];
@@ -1195,7 +1215,6 @@ static void reset_fifos(void)
 
 static void initialize_fifos(void)
 {
-	static struct esb_payload rx_payload[CONFIG_ESB_RX_FIFO_SIZE];
 	static struct esb_payload tx_payload[CONFIG_ESB_TX_FIFO_SIZE];
 
 	reset_fifos();
@@ -1205,9 +1224,11 @@ static void initialize_fifos(void)
 	}
 
 	for (size_t i = 0; i < CONFIG_ESB_RX_FIFO_SIZE; i++) {
-		rx_fifo.payload[i] = &rx_payload[i];
+		rx_fifo.entry[i].pdu = (struct esb_radio_pdu *)rx_pdu_pool[i];
 	}
 
+	rx_radio_pdu = (struct esb_radio_pdu *)rx_pdu_pool[CONFIG_ESB_RX_FIFO_SIZE];
+
 	for (size_t i = 0; i < CONFIG_ESB_TX_FIFO_SIZE; i++) {
 		ack_pl_wrap[i].p_payload = &tx_payload[i];
 		ack_pl_wrap[i].in_use = false;
@@ -1232,11 +1253,45 @@ static void tx_fifo_remove_first(void)
 	atomic_dec(&tx_fifo.count);
 }
 
-/*  Function to push the content of the rx_buffer to the RX FIFO.
+static bool rx_fifo_entry_fill(struct rx_fifo_entry *entry, const struct esb_radio_pdu *rx_pdu,
+			       uint8_t pipe, uint8_t pid)
+{
+	if (esb_cfg.protocol == ESB_PROTOCOL_ESB_DPL) {
+		if (rx_pdu->type.dpl_pdu.length > CONFIG_ESB_MAX_PAYLOAD_LENGTH) {
+			return false;
+		}
+
+		entry->length = rx_pdu->type.dpl_pdu.length;
+	} else if (esb_cfg.mode == ESB_MODE_PTX) {
+		/* Received packet is an acknowledgment */
+		entry->length = 0;
+	} else {
+		entry->length = esb_cfg.payload_length;
+	}
+
+	entry->pipe = pipe;
+	entry->rssi = nrf_radio_rssi_sample_get(NRF_RADIO);
+	entry->pid = pid;
+	entry->noack = !rx_pdu->type.dpl_pdu.ack;
+
+	return true;
+}
+
+static void rx_fifo_commit(void)
+{
+	if (++rx_fifo.back >= CONFIG_ESB_RX_FIFO_SIZE) {
+		rx_fifo.back = 0;
+	}
+	atomic_inc(&rx_fifo.count);
+}
+
+/*  Function to push the packet received by the radio to the RX FIFO.
  *
- *  The module will point the register NRF_RADIO->PACKETPTR to a buffer for
- *  receiving packets. After receiving a packet the module will call this
- *  function to copy the received data to the RX FIFO.
+ *  The module will point the register NRF_RADIO->PACKETPTR to the buffer
+ *  referenced by rx_radio_pdu. After receiving a packet the module will call
+ *  this function to hand the buffer over to the first free RX FIFO entry. The
+ *  buffer previously owned by the entry becomes the new rx_radio_pdu and must
+ *  be set as NRF_RADIO->PACKETPTR before the radio is started again.
  *
  *  @param  pipe Pipe number to set for the packet.
  *  @param  pid  Packet ID.
@@ -1246,37 +1301,52 @@ static void tx_fifo_remove_first(void)
  */
 static bool rx_fifo_push_rfbuf(uint8_t pipe, uint8_t pid)
 {
-	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
+	struct rx_fifo_entry *entry = &rx_fifo.entry[rx_fifo.back];
+	struct esb_radio_pdu *rx_pdu = rx_radio_pdu;
 
 	if (atomic_get(&rx_fifo.count) >= CONFIG_ESB_RX_FIFO_SIZE) {
 		return false;
 	}
 
-	if (esb_cfg.protocol == ESB_PROTOCOL_ESB_DPL) {
-		if (rx_pdu->type.dpl_pdu.length > CONFIG_ESB_MAX_PAYLOAD_LENGTH) {
-			return false;
-		}
-
-		rx_fifo.payload[rx_fifo.back]->length = rx_pdu->type.dpl_pdu.length;
-	} else if (esb_cfg.mode == ESB_MODE_PTX) {
-		/* Received packet is an acknowledgment */
-		rx_fifo.payload[rx_fifo.back]->length = 0;
-	} else {
-		rx_fifo.payload[rx_fifo.back]->length = esb_cfg.payload_length;
+	if (!rx_fifo_entry_fill(entry, rx_pdu, pipe, pid)) {
+		return false;
 	}
 
-	memcpy(rx_fifo.payload[rx_fifo.back]->data, rx_pdu->data,
-	       rx_fifo.payload[rx_fifo.back]->length);
+	rx_radio_pdu = entry->pdu;
+	entry->pdu = rx_pdu;
 
-	rx_fifo.payload[rx_fifo.back]->pipe = pipe;
-	rx_fifo.payload[rx_fifo.back]->rssi = nrf_radio_rssi_sample_get(NRF_RADIO);
-	rx_fifo.payload[rx_fifo.back]->pid = pid;
-	rx_fifo.payload[rx_fifo.back]->noack = !rx_pdu->type.dpl_pdu.ack;
+	rx_fifo_commit();
 
-	if (++rx_fifo.back >= CONFIG_ESB_RX_FIFO_SIZE) {
-		rx_fifo.back = 0;
+	return true;
+}
+
+/*  Function to copy the packet received by the radio to the RX FIFO.
+ *
+ *  Used in monitor mode. The radio is restarted by the END to START short
+ *  before the packet is handled, so NRF_RADIO->PACKETPTR cannot be changed
+ *  for the next packet and the buffer must stay with the radio.
+ *
+ *  @param  pipe Pipe number to set for the packet.
+ *  @param  pid  Packet ID.
+ *
+ *  @retval true   Operation successful.
+ *  @retval false  Operation failed.
+ */
+static bool rx_fifo_push_rfbuf_copy(uint8_t pipe, uint8_t pid)
+{
+	struct rx_fifo_entry *entry = &rx_fifo.entry[rx_fifo.back];
+
+	if (atomic_get(&rx_fifo.count) >= CONFIG_ESB_RX_FIFO_SIZE) {
+		return false;
 	}
-	atomic_inc(&rx_fifo.count);
+
+	if (!rx_fifo_entry_fill(entry, rx_radio_pdu, pipe, pid)) {
+		return false;
+	}
+
+	memcpy(entry->pdu->data, rx_radio_pdu->data, entry->length);
+
+	rx_fifo_commit();
 
 	return true;
 }
@@ -1650,7 +1720,7 @@ static void on_radio_disabled_tx(void)
 		update_rf_payload_format_esb(0);
 	}
 
-	nrf_radio_packetptr_set(NRF_RADIO, rx_payload_buffer);
+	nrf_radio_packetptr_set(NRF_RADIO, rx_radio_pdu);
 	if (fast_switching) {
 		nrf_radio_int_disable(NRF_RADIO, ESB_RADIO_INT_END_MASK);
 		nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_START);
@@ -1784,7 +1854,7 @@ static void schedule_retx_in_timeslot(void)
 
 static void on_radio_disabled_tx_wait_for_ack(void)
 {
-	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
+	struct esb_radio_pdu *rx_pdu = rx_radio_pdu;
 	/* This marks the completion of a TX_RX sequence (TX with ACK) */
 
 	/* Make sure the timer will not deactivate the radio if a packet is
@@ -1953,7 +2023,7 @@ static void start_rx_listening(void)
 	nrf_radio_rxaddresses_set(NRF_RADIO, esb_addr.rx_pipes_enabled);
 	nrf_radio_frequency_set(NRF_RADIO, (RADIO_BASE_FREQUENCY + esb_addr.rf_channel));
 	atomic_clear_bit(&esb_addr.rf_channel_flags, RF_CHANNEL_UPDATE_FLAG);
-	nrf_radio_packetptr_set(NRF_RADIO, rx_payload_buffer);
+	nrf_radio_packetptr_set(NRF_RADIO, rx_radio_pdu);
 
 	NVIC_ClearPendingIRQ(ESB_RADIO_IRQ_NUMBER);
 	irq_enable(ESB_RADIO_IRQ_NUMBER);
@@ -1979,7 +2049,7 @@ static void clear_events_restart_rx(void)
 		update_rf_payload_format_esb(esb_cfg.payload_length);
 	}
 
-	nrf_radio_packetptr_set(NRF_RADIO, rx_payload_buffer);
+	nrf_radio_packetptr_set(NRF_RADIO, rx_radio_pdu);
 
 	nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_DISABLED);
 	nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
@@ -2004,10 +2074,10 @@ static void clear_events_restart_rx(void)
 	radio_start();
 }
 
-static void prepare_ack_pdu_dpl(bool retransmit_payload, struct pipe_info *pipe_info)
+static void prepare_ack_pdu_dpl(const struct esb_radio_pdu *rx_pdu, bool retransmit_payload,
+				struct pipe_info *pipe_info)
 {
 	struct esb_radio_pdu *tx_pdu = (struct esb_radio_pdu *)tx_payload_buffer;
-	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
 
 	uint32_t pipe = nrf_radio_rxmatch_get(NRF_RADIO);
 
@@ -2053,8 +2123,9 @@ static void on_radio_disabled_rx(void)
 {
 	bool retransmit_payload = false;
 	bool send_rx_event = true;
+	bool rx_received = false;
 	struct pipe_info *pipe_info;
-	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
+	struct esb_radio_pdu *rx_pdu = rx_radio_pdu;
 	struct esb_radio_pdu *tx_pdu = (struct esb_radio_pdu *)tx_payload_buffer;
 
 	if (!nrf_radio_crc_status_check(NRF_RADIO)) {
@@ -2078,13 +2149,22 @@ static void on_radio_disabled_rx(void)
 	pipe_info->pid = rx_pdu->type.dpl_pdu.pid;
 	pipe_info->crc = nrf_radio_rxcrc_get(NRF_RADIO);
 
+	if (send_rx_event) {
+		/* Hand the received packet over to the RX FIFO before the radio is
+		 * started again. The rx_pdu buffer is owned by the RX FIFO from now
+		 * on, but it stays valid until the application reads it.
+		 */
+		rx_received = rx_fifo_push_rfbuf(nrf_radio_rxmatch_get(NRF_RADIO),
+						 pipe_info->pid);
+	}
+
 	/* Check if an ack should be sent */
 	if ((esb_cfg.selective_auto_ack == false) || rx_pdu->type.dpl_pdu.ack) {
 		esb_fem_for_tx_ack();
 
 		switch (esb_cfg.protocol) {
 		case ESB_PROTOCOL_ESB_DPL:
-			prepare_ack_pdu_dpl(retransmit_payload, pipe_info);
+			prepare_ack_pdu_dpl(rx_pdu, retransmit_payload, pipe_info);
 			break;
 
 		case ESB_PROTOCOL_ESB:
@@ -2117,15 +2197,9 @@ static void on_radio_disabled_rx(void)
 		clear_events_restart_rx();
 	}
 
-	if (send_rx_event) {
-		/* Push the new packet to the RX buffer and trigger a received
-		 * event if the operation was
-		 * successful.
-		 */
-		if (rx_fifo_push_rfbuf(nrf_radio_rxmatch_get(NRF_RADIO), pipe_info->pid)) {
-			atomic_set_bit(&interrupt_flags, ESB_EVENT_RX_RECEIVED);
-			set_evt_interrupt();
-		}
+	if (rx_received) {
+		atomic_set_bit(&interrupt_flags, ESB_EVENT_RX_RECEIVED);
+		set_evt_interrupt();
 	}
 }
 
@@ -2137,7 +2211,7 @@ static void on_radio_disabled_rx_send_ack(void)
 		update_rf_payload_format_esb(esb_cfg.payload_length);
 	}
 
-	nrf_radio_packetptr_set(NRF_RADIO, rx_payload_buffer);
+	nrf_radio_packetptr_set(NRF_RADIO, rx_radio_pdu);
 	if (fast_switching) {
 		nrf_radio_shorts_set(NRF_RADIO,
 				     (RADIO_RSSI_SHORTS | NRF_RADIO_SHORT_RXREADY_START_MASK));
@@ -2154,10 +2228,10 @@ static void on_radio_disabled_rx_send_ack(void)
 static void on_radio_end_monitor(void)
 {
 	struct pipe_info pipe;
-	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
+	struct esb_radio_pdu *rx_pdu = rx_radio_pdu;
 
 	pipe.pid = rx_pdu->type.dpl_pdu.pid;
-	if (rx_fifo_push_rfbuf(nrf_radio_rxmatch_get(NRF_RADIO), pipe.pid)) {
+	if (rx_fifo_push_rfbuf_copy(nrf_radio_rxmatch_get(NRF_RADIO), pipe.pid)) {
 		atomic_set_bit(&interrupt_flags, ESB_EVENT_RX_RECEIVED);
 		set_evt_interrupt();
 	}
@@ -2733,6 +2807,24 @@ int esb_write_payload(const struct esb_payload *payload)
 	return 0;
 }
 
+static void rx_fifo_pop(struct esb_payload *payload)
+{
+	const struct rx_fifo_entry *entry = &rx_fifo.entry[rx_fifo.front];
+
+	payload->length = entry->length;
+	payload->pipe = entry->pipe;
+	payload->rssi = entry->rssi;
+	payload->pid = entry->pid;
+	payload->noack = entry->noack;
+	memcpy(payload->data, entry->pdu->data, payload->length);
+
+	if (++rx_fifo.front >= CONFIG_ESB_RX_FIFO_SIZE) {
+		rx_fifo.front = 0;
+	}
+
+	atomic_dec(&rx_fifo.count);
+}
+
 int esb_read_rx_payload(struct esb_payload *payload)
 {
 	if (esb_state == ESB_STATE_UNINITIALIZED) {
@@ -2745,21 +2837,32 @@ int esb_read_rx_payload(struct esb_payload *payload)
 		return -ENODATA;
 	}
 
-	payload->length = rx_fifo.payload[rx_fifo.front]->length;
-	payload->pipe = rx_fifo.payload[rx_fifo.front]->pipe;
-	payload->rssi = rx_fifo.payload[rx_fifo.front]->rssi;
-	payload->pid = rx_fifo.payload[rx_fifo.front]->pid;
-	payload->noack = rx_fifo.payload[rx_fifo.front]->noack;
-	memcpy(payload->data, rx_fifo.payload[rx_fifo.front]->data,
-	       payload->length);
+	rx_fifo_pop(payload);
 
-	if (++rx_fifo.front >= CONFIG_ESB_RX_FIFO_SIZE) {
-		rx_fifo.front = 0;
+	return 0;
+}
+
+int esb_read_rx_payloads(struct esb_payload *payloads, size_t count)
+{
+	size_t available;
+
+	if (esb_state == ESB_STATE_UNINITIALIZED) {
+		return -EACCES;
+	}
+	if ((payloads == NULL) || (count == 0)) {
+		return -EINVAL;
 	}
 
-	atomic_dec(&rx_fifo.count);
+	available = MIN(count, (size_t)atomic_get(&rx_fifo.count));
+	if (available == 0) {
+		return -ENODATA;
+	}
 
-	return 0;
+	for (size_t i = 0; i < available; i++) {
+		rx_fifo_pop(&payloads[i]);
+	}
+
+	return available;
 }
 
 int esb_start_tx(void)
@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2018-2021 mcumgr authors
- * Copyright (c) 2022-2025 Nordic Semiconductor ASA
+ * Copyright (c) 2022-2026 Nordic Semiconductor ASA
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -172,6 +172,30 @@ struct img_mgmt_state g_img_mgmt_state;
 static K_MUTEX_DEFINE(img_mgmt_mutex);
 #endif
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND
+/* Image data that has been acknowledged to the client, but not yet written to flash */
+struct img_mgmt_wb_chunk {
+	void *fifo_reserved;
+	/* Chunks of an upload that has been reset or restarted are dropped */
+	uint32_t upload_id;
+	size_t off;
+	size_t len;
+	/* Size of the image area to erase before the data is written, 0 if none */
+	size_t erase_size;
+	uint8_t data[CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND_CHUNK_SIZE];
+};
+
+K_MEM_SLAB_DEFINE_STATIC(img_mgmt_wb_slab, sizeof(struct img_mgmt_wb_chunk),
+			 CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND_WINDOW, 4);
+static K_FIFO_DEFINE(img_mgmt_wb_fifo);
+static K_SEM_DEFINE(img_mgmt_wb_idle_sem, 0, 1);
+
+/* Protected by the image management lock */
+static uint32_t img_mgmt_wb_upload_id;
+static int img_mgmt_wb_rc;
+static bool img_mgmt_wb_erase_failed;
+#endif
+
 #ifdef CONFIG_MCUMGR_GRP_IMG_VERBOSE_ERR
 const char *img_mgmt_err_str_app_reject = "app reject";
 const char *img_mgmt_err_str_hdr_malformed = "header malformed";
@@ -595,9 +619,103 @@ static void img_mgmt_reset_upload(void)
 	img_mgmt_take_lock();
 	memset(&g_img_mgmt_state, 0, sizeof(g_img_mgmt_state));
 	g_img_mgmt_state.area_id = -1;
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND
+	img_mgmt_wb_upload_id++;
+	img_mgmt_wb_rc = 0;
+	img_mgmt_wb_erase_failed = false;
+#endif
 	img_mgmt_release_lock();
 }
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND
+static void img_mgmt_wb_chunk_write(struct img_mgmt_wb_chunk *chunk)
+{
+	int rc;
+#if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
+	int32_t err_rc;
+	uint16_t err_group;
+#endif
+
+	if (chunk->upload_id != img_mgmt_wb_upload_id || img_mgmt_wb_rc != 0) {
+		/* Upload has been reset or a previous chunk has failed */
+		return;
+	}
+
+	if (chunk->erase_size != 0) {
+		rc = img_mgmt_erase_image_data(0, chunk->erase_size);
+		if (rc != 0) {
+			LOG_ERR("Flash erase failed: %d", rc);
+			img_mgmt_wb_rc = rc;
+			img_mgmt_wb_erase_failed = true;
+			return;
+		}
+	}
+
+	rc = img_mgmt_write_image_data(chunk->off, chunk->data, chunk->len, false);
+	if (rc != 0) {
+		LOG_ERR("Irrecoverable error: flash write failed: %d", rc);
+		img_mgmt_wb_rc = rc;
+		return;
+	}
+
+#if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
+	(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_CHUNK_WRITE_COMPLETE, NULL, 0,
+				   &err_rc, &err_group);
+#endif
+}
+
+static void img_mgmt_wb_thread_fn(void *p1, void *p2, void *p3)
+{
+	struct img_mgmt_wb_chunk *chunk;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		chunk = k_fifo_get(&img_mgmt_wb_fifo, K_FOREVER);
+
+		img_mgmt_take_lock();
+		img_mgmt_wb_chunk_write(chunk);
+		img_mgmt_release_lock();
+
+		k_mem_slab_free(&img_mgmt_wb_slab, chunk);
+
+		if (k_mem_slab_num_used_get(&img_mgmt_wb_slab) == 0) {
+			k_sem_give(&img_mgmt_wb_idle_sem);
+		}
+	}
+}
+
+K_THREAD_DEFINE(img_mgmt_wb_thread, CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND_STACK_SIZE,
+		img_mgmt_wb_thread_fn, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND_THREAD_PRIO), 0, 0);
+
+/*
+ * Waits until the queued chunks are written to flash. Must be called with the image
+ * management lock taken once, the lock is released while waiting.
+ */
+static int img_mgmt_wb_flush(void)
+{
+	uint32_t upload_id = img_mgmt_wb_upload_id;
+
+	k_sem_reset(&img_mgmt_wb_idle_sem);
+
+	if (k_mem_slab_num_used_get(&img_mgmt_wb_slab) != 0) {
+		img_mgmt_release_lock();
+		(void)k_sem_take(&img_mgmt_wb_idle_sem, K_FOREVER);
+		img_mgmt_take_lock();
+	}
+
+	if (upload_id != img_mgmt_wb_upload_id) {
+		/* Upload has been reset while waiting */
+		return IMG_MGMT_ERR_UNKNOWN;
+	}
+
+	return img_mgmt_wb_rc;
+}
+#endif
+
 /**
  * Command handler: image erase
  */
@@ -926,6 +1044,10 @@ img_mgmt_upload(struct smp_streamer *ctxt)
 	bool last = false;
 	bool reset = false;
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND
+	struct img_mgmt_wb_chunk *chunk = NULL;
+#endif
+
 #ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
 	bool data_match = false;
 #endif
@@ -973,8 +1095,37 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		return MGMT_ERR_EINVAL;
 	}
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND
+	/* Wait for a free chunk before the request is processed. This limits the amount of
+	 * acknowledged data that has not been written to flash yet.
+	 */
+	if (req.img_data.len != 0 &&
+	    req.img_data.len <= CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND_CHUNK_SIZE) {
+		(void)k_mem_slab_alloc(&img_mgmt_wb_slab, (void **)&chunk, K_FOREVER);
+		chunk->erase_size = 0;
+	}
+#endif
+
 	img_mgmt_take_lock();
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND
+	if (img_mgmt_wb_rc != 0) {
+		/* An acknowledged chunk could not be written, the upload has to be restarted */
+		rc = img_mgmt_wb_rc;
+
+		if (img_mgmt_wb_erase_failed) {
+			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(&action,
+				img_mgmt_err_str_flash_erase_failed);
+		} else {
+			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(&action,
+				img_mgmt_err_str_flash_write_failed);
+		}
+
+		ok = smp_add_cmd_err(zse, MGMT_GROUP_ID_IMAGE, rc);
+		goto end;
+	}
+#endif
+
 	/* Determine what actions to take as a result of this request. */
 	rc = img_mgmt_upload_inspect(&req, &action);
 	if (rc != 0) {
@@ -995,6 +1146,13 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		 */
 		rc = img_mgmt_upload_good_rsp(ctxt);
 		img_mgmt_release_lock();
+
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND
+		if (chunk != NULL) {
+			k_mem_slab_free(&img_mgmt_wb_slab, chunk);
+		}
+#endif
+
 		return rc;
 	}
 
@@ -1024,6 +1182,14 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 	g_img_mgmt_state.area_id = action.area_id;
 	g_img_mgmt_state.size = action.size;
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND
+	if (chunk != NULL && req.off + req.img_data.len == action.size) {
+		/* The last chunk is written before responding, so that the image can be checked */
+		k_mem_slab_free(&img_mgmt_wb_slab, chunk);
+		chunk = NULL;
+	}
+#endif
+
 	if (req.off == 0) {
 		/*
 		 * New upload.
@@ -1035,6 +1201,11 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 
 		g_img_mgmt_state.off = 0;
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND
+		/* Drop the queued chunks of a previous upload */
+		img_mgmt_wb_upload_id++;
+#endif
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0, &err_rc,
 					   &err_group);
@@ -1083,6 +1254,14 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 #endif
 
 #ifndef CONFIG_IMG_ERASE_PROGRESSIVELY
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND
+		if (action.erase && chunk != NULL) {
+			/* Erased by the flash thread, so that the response is not delayed */
+			chunk->erase_size = req.size;
+			action.erase = false;
+		}
+#endif
+
 		/* erase the entire req.size all at once */
 		if (action.erase) {
 			rc = img_mgmt_erase_image_data(0, req.size);
@@ -1107,8 +1286,30 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			last = true;
 		}
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND
+		if (chunk != NULL) {
+			chunk->upload_id = img_mgmt_wb_upload_id;
+			chunk->off = req.off;
+			chunk->len = action.write_bytes;
+			memcpy(chunk->data, req.img_data.value, action.write_bytes);
+
+			k_fifo_put(&img_mgmt_wb_fifo, chunk);
+			chunk = NULL;
+
+			g_img_mgmt_state.off += action.write_bytes;
+			goto end;
+		}
+
+		/* Chunks are written in order */
+		rc = img_mgmt_wb_flush();
+		if (rc == 0) {
+			rc = img_mgmt_write_image_data(req.off, req.img_data.value,
+						       action.write_bytes, last);
+		}
+#else
 		rc = img_mgmt_write_image_data(req.off, req.img_data.value, action.write_bytes,
 						    last);
+#endif
 		if (rc == 0) {
 			g_img_mgmt_state.off += action.write_bytes;
 		} else {
@@ -1164,6 +1365,13 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 	}
 end:
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND
+	if (chunk != NULL) {
+		/* Chunk has not been queued */
+		k_mem_slab_free(&img_mgmt_wb_slab, chunk);
+	}
+#endif
+
 	img_mgmt_upload_log(req.off == 0, g_img_mgmt_state.off == g_img_mgmt_state.size, rc);
 
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
@@ -16,6 +16,7 @@ int dl_socket_configure_and_connect(
 int dl_socket_close(int *fd);
 int dl_socket_send(int fd, void *buf, size_t len);
 ssize_t dl_socket_recv(int fd, void *buf, size_t len);
+ssize_t dl_socket_recv_nowait(int fd, void *buf, size_t len);
 int dl_socket_recv_timeout_set(int fd, uint32_t timeout_ms);
 int dl_socket_send_timeout_set(int fd, uint32_t timeout_ms);
 
@@ -451,3 +451,19 @@ ssize_t dl_socket_recv(int fd, void *buf, size_t len)
 
 	return err;
 }
+
+ssize_t dl_socket_recv_nowait(int fd, void *buf, size_t len)
+{
+	int err = 0;
+
+	if (fd == -1) {
+		return -EINVAL;
+	}
+
+	err = zsock_recv(fd, buf, len, ZSOCK_MSG_DONTWAIT);
+	if (err < 0) {
+		return -errno;
+	}
+
+	return err;
+}
@@ -109,6 +109,34 @@ struct transport_params_http {
 	bool new_data_req;
 	/** Redirect retries */
 	uint8_t redirects;
+
+#if defined(CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL)
+	/** Concurrent range requests */
+	struct {
+		/** Ranges are downloaded concurrently. */
+		bool active;
+		/** Number of connections in use. */
+		uint8_t conns;
+		/** Size of a reorder buffer slot. */
+		uint32_t slot_size;
+		/** File offset of the next range to request. */
+		uint32_t next_off;
+		struct {
+			/** Socket descriptor, unused for the first connection. */
+			int fd;
+			/** File offset of the requested range. */
+			uint32_t off;
+			/** Length of the requested range, zero if idle. */
+			uint32_t len;
+			/** Bytes in the reorder buffer slot. */
+			uint32_t slot_len;
+			/** Bytes passed on to the application. */
+			uint32_t delivered;
+			/** Whether the HTTP header of the range has been received. */
+			bool has_hdr;
+		} conn[CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL_CONNS_MAX];
+	} par;
+#endif
 };
 
 BUILD_ASSERT(CONFIG_DOWNLOADER_TRANSPORT_PARAMS_SIZE >= sizeof(struct transport_params_http));
@@ -467,6 +495,337 @@ static int http_parse(struct downloader *dl, size_t len)
 	return len;
 }
 
+#if defined(CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL)
+/* The first range connection is the socket of the download. */
+static int *range_conn_fd(struct transport_params_http *http, int i)
+{
+	return (i == 0) ? &http->sock.fd : &http->par.conn[i].fd;
+}
+
+static char *range_conn_slot(struct transport_params_http *http, int i)
+{
+	return http->cfg.reorder_buf + (i * http->par.slot_size);
+}
+
+static int range_conn_connect(struct downloader *dl, int i)
+{
+	int err;
+	int *fd;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+	fd = range_conn_fd(http, i);
+
+	err = dl_socket_configure_and_connect(fd, http->sock.proto, http->sock.type,
+					      http->sock.port, &http->sock.remote_addr,
+					      dl->hostname, &dl->host_cfg);
+	if (err) {
+		return err;
+	}
+
+	err = dl_socket_recv_timeout_set(*fd, http->cfg.sock_recv_timeo_ms);
+	if (err) {
+		LOG_ERR("Failed to set http recv timeout, err %d", err);
+		dl_socket_close(fd);
+		return err;
+	}
+
+	return 0;
+}
+
+static int range_conn_request(struct downloader *dl, int i)
+{
+	int err;
+	int len;
+	int *fd;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+	fd = range_conn_fd(http, i);
+
+	http->par.conn[i].off = http->par.next_off;
+	http->par.conn[i].len = MIN(dl->host_cfg.range_override,
+				    dl->file_size - http->par.next_off);
+	http->par.conn[i].slot_len = 0;
+	http->par.conn[i].delivered = 0;
+	http->par.conn[i].has_hdr = false;
+
+	/* The downloader buffer is not used for data while ranges are downloaded concurrently. */
+	len = snprintf(dl->cfg.buf, dl->cfg.buf_size, HTTP_GET_RANGE, dl->file, dl->hostname,
+		       http->par.conn[i].off, http->par.conn[i].off + http->par.conn[i].len - 1);
+	if (len < 0 || len > dl->cfg.buf_size) {
+		LOG_ERR("Cannot create GET request, buffer too small");
+		return -ENOMEM;
+	}
+
+	LOG_DBG("Range request %u-%u on connection %d", http->par.conn[i].off,
+		http->par.conn[i].off + http->par.conn[i].len - 1, i);
+
+	err = dl_socket_send(*fd, dl->cfg.buf, len);
+	if (err) {
+		/* The server may have closed an idle connection, reconnect once. */
+		dl_socket_close(fd);
+		err = range_conn_connect(dl, i);
+		if (!err) {
+			err = dl_socket_send(*fd, dl->cfg.buf, len);
+		}
+		if (err) {
+			LOG_ERR("Failed to send HTTP request on connection %d, err %d", i, err);
+			return -ECONNRESET;
+		}
+	}
+
+	http->par.next_off += http->par.conn[i].len;
+
+	return 0;
+}
+
+static int range_conn_hdr_parse(struct downloader *dl, int i)
+{
+	char *p;
+	char *slot;
+	size_t hdr_len;
+	unsigned long status_code = 0;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+	slot = range_conn_slot(http, i);
+
+	p = strnstr(slot, "\r\n\r\n", http->par.conn[i].slot_len);
+	if (!p) {
+		if (http->par.conn[i].slot_len == http->par.slot_size) {
+			LOG_ERR("Could not parse HTTP header lines from server (> %d)",
+				http->par.slot_size);
+			return -E2BIG;
+		}
+		/* Wait for rest of header */
+		return 0;
+	}
+
+	hdr_len = p + strlen("\r\n\r\n") - slot;
+
+	if (IS_ENABLED(CONFIG_DOWNLOADER_LOG_HEADERS)) {
+		LOG_HEXDUMP_DBG(slot, hdr_len, "HTTP response");
+	}
+
+	p = strnstr(slot, "HTTP/1.1 ", hdr_len);
+	if (p) {
+		status_code = strtoul(p + strlen("HTTP/1.1 "), NULL, 10);
+	}
+
+	if (status_code != HTTP_RESPONSE_PARTIAL_CONTENT) {
+		LOG_ERR("Unexpected HTTP response code %lu", status_code);
+		return -EBADMSG;
+	}
+
+	/* Keep the payload at the start of the slot */
+	http->par.conn[i].slot_len -= hdr_len;
+	memmove(slot, slot + hdr_len, http->par.conn[i].slot_len);
+	http->par.conn[i].has_hdr = true;
+
+	if (http->par.conn[i].slot_len > http->par.conn[i].len) {
+		LOG_ERR("Server sent more data than requested");
+		return -EBADMSG;
+	}
+
+	return 0;
+}
+
+static int range_conn_recv(struct downloader *dl, int i, bool wait)
+{
+	ssize_t len;
+	size_t max_len;
+	char *slot;
+	int fd;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+	slot = range_conn_slot(http, i);
+	fd = *range_conn_fd(http, i);
+
+	if (http->par.conn[i].has_hdr) {
+		if (http->par.conn[i].slot_len == http->par.conn[i].len) {
+			/* Range complete */
+			return 0;
+		}
+		/* Don't read into the next response */
+		max_len = http->par.conn[i].len - http->par.conn[i].slot_len;
+	} else {
+		max_len = http->par.slot_size - http->par.conn[i].slot_len;
+	}
+
+	if (wait) {
+		len = dl_socket_recv(fd, slot + http->par.conn[i].slot_len, max_len);
+	} else {
+		len = dl_socket_recv_nowait(fd, slot + http->par.conn[i].slot_len, max_len);
+		if (len == -EAGAIN) {
+			return 0;
+		}
+	}
+
+	if (len < 0) {
+		return len;
+	}
+
+	if (len == 0) {
+		/* Closed before the range was complete, reconnect and resume from progress. */
+		LOG_WRN("Peer closed connection %d, will re-connect", i);
+		return -ECONNRESET;
+	}
+
+	http->par.conn[i].slot_len += len;
+
+	if (!http->par.conn[i].has_hdr) {
+		return range_conn_hdr_parse(dl, i);
+	}
+
+	return 0;
+}
+
+static void range_par_stop(struct downloader *dl)
+{
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	for (int i = 1; i < http->par.conns; i++) {
+		dl_socket_close(&http->par.conn[i].fd);
+	}
+
+	memset(&http->par, 0, sizeof(http->par));
+}
+
+static void range_par_start(struct downloader *dl)
+{
+	int err;
+	uint32_t slot_size;
+	uint32_t range_max;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	if (http->cfg.range_conns < 2 || !dl->host_cfg.range_override || !dl->file_size ||
+	    (dl->file_size - dl->progress) <= dl->host_cfg.range_override) {
+		/* Not worth it, or the file size is not known yet */
+		return;
+	}
+
+	/* Each slot holds a whole response, the header followed by the range */
+	slot_size = http->cfg.reorder_buf_size / http->cfg.range_conns;
+	range_max = slot_size - CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL_HDR_SIZE;
+	if (dl->host_cfg.range_override > range_max) {
+		LOG_WRN("Range override > reorder buffer slot, setting to %u", range_max);
+		dl->host_cfg.range_override = range_max;
+	}
+
+	http->par.slot_size = slot_size;
+	http->par.next_off = dl->progress;
+	http->par.conns = 1;
+
+	for (int i = 1; i < http->cfg.range_conns; i++) {
+		http->par.conn[i].fd = -1;
+
+		err = range_conn_connect(dl, i);
+		if (err) {
+			/* Continue with the connections we have */
+			LOG_WRN("Failed to open range connection %d, err %d", i, err);
+			break;
+		}
+
+		http->par.conns++;
+	}
+
+	if (http->par.conns < 2) {
+		range_par_stop(dl);
+		return;
+	}
+
+	http->par.active = true;
+
+	LOG_DBG("Downloading ranges over %d connections", http->par.conns);
+}
+
+/* Receive on all connections, and deliver the data of the range at the download progress. */
+static int range_par_download(struct downloader *dl)
+{
+	int err;
+	int head = -1;
+	uint32_t len;
+	char *slot;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	/* Keep every connection busy */
+	for (int i = 0; i < http->par.conns; i++) {
+		if (!http->par.conn[i].len && http->par.next_off < dl->file_size) {
+			err = range_conn_request(dl, i);
+			if (err) {
+				return err;
+			}
+		}
+	}
+
+	for (int i = 0; i < http->par.conns; i++) {
+		if (http->par.conn[i].len && http->par.conn[i].off == dl->progress) {
+			head = i;
+			break;
+		}
+	}
+
+	if (head < 0) {
+		LOG_ERR("No range requested at offset %u", dl->progress);
+		return -ECONNRESET;
+	}
+
+	/* Ranges ahead of the progress are received into their reorder buffer slot */
+	for (int i = 0; i < http->par.conns; i++) {
+		if (i == head || !http->par.conn[i].len) {
+			continue;
+		}
+
+		err = range_conn_recv(dl, i, false);
+		if (err) {
+			return err;
+		}
+	}
+
+	if (!http->par.conn[head].has_hdr ||
+	    http->par.conn[head].slot_len == http->par.conn[head].delivered) {
+		/* Nothing buffered to deliver, wait for the range at the progress */
+		err = range_conn_recv(dl, head, true);
+		if (err) {
+			return err;
+		}
+	}
+
+	len = http->par.conn[head].has_hdr ?
+	      http->par.conn[head].slot_len - http->par.conn[head].delivered : 0;
+	if (!len) {
+		return 0;
+	}
+
+	slot = range_conn_slot(http, head);
+	http->par.conn[head].delivered += len;
+	if (http->par.conn[head].delivered == http->par.conn[head].len) {
+		/* Request the next range when the slot has been delivered */
+		http->par.conn[head].len = 0;
+	}
+
+	dl->progress += len;
+	dl_transport_evt_data(dl, slot + http->par.conn[head].delivered - len, len);
+
+	if (dl->progress == dl->file_size) {
+		/* A full file has been received */
+		dl->complete = true;
+		http->new_data_req = true;
+		range_par_stop(dl);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL */
+
 static bool dl_http_proto_supported(struct downloader *dl, const char *url)
 {
 	if (strncmp(url, HTTPS, (sizeof(HTTPS) - 1)) == 0) {
@@ -552,6 +911,10 @@ static int dl_http_deinit(struct downloader *dl)
 
 	http = (struct transport_params_http *)dl->transport_internal;
 
+#if defined(CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL)
+	range_par_stop(dl);
+#endif
+
 	if (http->sock.fd != -1) {
 		dl_socket_close(&http->sock.fd);
 	}
@@ -596,6 +959,10 @@ static int dl_http_close(struct downloader *dl)
 
 	http = (struct transport_params_http *)dl->transport_internal;
 
+#if defined(CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL)
+	range_par_stop(dl);
+#endif
+
 	if (http->sock.fd != -1) {
 		err = dl_socket_close(&http->sock.fd);
 		return err;
@@ -613,6 +980,25 @@ static int dl_http_download(struct downloader *dl)
 
 	http = (struct transport_params_http *)dl->transport_internal;
 
+#if defined(CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL)
+	if (http->par.active) {
+		if (!dl->file_size) {
+			/* A new download was started while ranges were in flight */
+			range_par_stop(dl);
+			return -ECONNRESET;
+		}
+
+		return range_par_download(dl);
+	}
+
+	if (http->new_data_req) {
+		range_par_start(dl);
+		if (http->par.active) {
+			return range_par_download(dl);
+		}
+	}
+#endif
+
 	if (http->new_data_req) {
 		/* Request next fragment */
 		dl->buf_offset = 0;
@@ -717,6 +1103,23 @@ int downloader_transport_http_set_config(struct downloader *dl,
 		return -EINVAL;
 	}
 
+	if (cfg->range_conns > 1) {
+#if defined(CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL)
+		if (cfg->range_conns > CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL_CONNS_MAX ||
+		    !cfg->reorder_buf) {
+			return -EINVAL;
+		}
+
+		/* Each slot must have room for the response header and some data */
+		if (cfg->reorder_buf_size / cfg->range_conns <=
+		    CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL_HDR_SIZE) {
+			return -EINVAL;
+		}
+#else
+		return -ENOTSUP;
+#endif
+	}
+
 	http = (struct transport_params_http *)dl->transport_internal;
 	http->cfg_set = true;
 	http->cfg = *cfg;
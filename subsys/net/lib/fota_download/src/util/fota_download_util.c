@@ -293,6 +293,11 @@ int fota_download_util_dfu_target_init(enum dfu_target_image_type dfu_target_typ
 		ret = fota_download_mcuboot_target_init();
 		break;
 #endif
+#if defined(CONFIG_DFU_TARGET_APP_DELTA)
+	case DFU_TARGET_IMAGE_TYPE_APP_DELTA:
+		ret = fota_download_mcuboot_target_init();
+		break;
+#endif
 
 #if defined(CONFIG_DFU_TARGET_FULL_MODEM)
 	case DFU_TARGET_IMAGE_TYPE_FULL_MODEM:
@@ -382,6 +387,11 @@ int fota_download_util_apply_update(enum dfu_target_image_type dfu_target_type)
 		ret = 0;
 		break;
 #endif
+#if defined(CONFIG_DFU_TARGET_APP_DELTA)
+	case DFU_TARGET_IMAGE_TYPE_APP_DELTA:
+		ret = 0;
+		break;
+#endif
 #if defined(CONFIG_DFU_TARGET_FULL_MODEM)
 	case DFU_TARGET_IMAGE_TYPE_FULL_MODEM:
 		ret = fota_download_full_modem_apply_update();
@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <stddef.h>
 #include <stdio.h>
+#include <string.h>
 #include <strings.h>
 #include <zephyr/kernel.h>
 #include <zephyr/types.h>
@@ -14,399 +16,294 @@
 
 LOG_MODULE_REGISTER(icalendar_parser, CONFIG_ICAL_PARSER_LOG_LEVEL);
 
-static size_t unfold_contentline(const char *buf, char *prop_buf)
+/* Calendar components. Reference: RFC 5545 3.6 Calendar Components */
+static const char *const component_names[] = {
+	[ICAL_EVT_VEVENT] = "VEVENT",
+	[ICAL_EVT_VTODO] = "VTODO",
+	[ICAL_EVT_VJOURNAL] = "VJOURNAL",
+	[ICAL_EVT_VTIMEZONE] = "VTIMEZONE",
+	[ICAL_EVT_VFREEBUSY] = "VFREEBUSY",
+};
+
+/* Supported properties of the VEVENT component. */
+static const struct {
+	const char *name;
+	/* Offset of the value buffer in struct ical_component. */
+	size_t offset;
+	size_t max_value_len;
+	/* Property parameters are allowed, and ignored. */
+	bool params;
+	enum ical_parser_error_id error;
+} event_props[] = {
+	{ "SUMMARY", offsetof(struct ical_component, summary),
+	  CONFIG_ICAL_PARSER_SUMMARY_SIZE, false, ICAL_ERROR_SUMMARY },
+	{ "LOCATION", offsetof(struct ical_component, location),
+	  CONFIG_ICAL_PARSER_LOCATION_SIZE, false, ICAL_ERROR_LOCATION },
+	{ "DESCRIPTION", offsetof(struct ical_component, description),
+	  CONFIG_ICAL_PARSER_DESCRIPTION_SIZE, false, ICAL_ERROR_DESCRIPTION },
+	{ "DTSTART", offsetof(struct ical_component, dtstart),
+	  CONFIG_ICAL_PARSER_DTSTART_SIZE, true, ICAL_ERROR_DTSTART },
+	{ "DTEND", offsetof(struct ical_component, dtend),
+	  CONFIG_ICAL_PARSER_DTEND_SIZE, true, ICAL_ERROR_DTEND },
+};
+
+static bool name_equals(const char *line, size_t name_len, const char *name)
 {
-	const char *sol = buf;
-	char *eol;
-	uint16_t total_line_len = 0, single_line_len = 0;
-
-	while (1) {
-		eol = strstr(sol, "\r\n");
-		if (!eol) {
-			return 0;
-		}
-		single_line_len = eol - sol;
-		if ((total_line_len + single_line_len) <= CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE) {
-			memcpy(prop_buf + total_line_len, sol, single_line_len);
-			total_line_len += single_line_len;
-		} else {
-			LOG_WRN("Property value overflow."
-				"Increase CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE.");
-			return 0;
-		}
-		if (!strncmp(eol, "\r\n ", strlen("\r\n "))) {
-			/* Long content line is split into multiple lines.
-			 * Copy the folded part to unfolded buffer.
-			 */
-			sol = eol + strlen("\r\n ");
-		} else {
-			/* Content line is delimited. */
-			break;
+	return (strlen(name) == name_len) && !strncasecmp(line, name, name_len);
+}
+
+/* Return the value of a content line, which follows the first colon that is not
+ * in a quoted parameter value. Reference: RFC 5545 3.1 Content Lines
+ */
+static const char *contentline_value(const char *line, size_t name_len)
+{
+	bool quoted = false;
+
+	for (const char *c = line + name_len; *c != '\0'; c++) {
+		if (*c == '"') {
+			quoted = !quoted;
+		} else if (*c == ':' && !quoted) {
+			return c + 1;
 		}
 	}
-	prop_buf[total_line_len] = '\0';
 
-	return total_line_len;
+	return NULL;
 }
 
-static bool parse_desc_props(const char *buf,
-			     const char *name,
-			     size_t name_size,
-			     char *value,
-			     size_t max_value_len)
+static bool parse_prop(struct icalendar_parser *ical, size_t prop, size_t name_len)
 {
-	bool ret;
-	size_t unfold_size;
-	char ical_prop_buf[CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE + 1];
-
-	unfold_size = unfold_contentline(buf, ical_prop_buf);
-	if (unfold_size <= 0) {
-		/* Property wrong format - no parameter or value. */
-		LOG_ERR("%s no value/param.", name);
+	const char *name = event_props[prop].name;
+	const char *value;
+	size_t value_len;
+	char *dest;
+
+	if (ical->line_overflow) {
+		LOG_ERR("%s value overflow.", name);
 		return false;
 	}
 
-	if (ical_prop_buf[name_size] == ':') {
-		size_t value_len = unfold_size - name_size - 1;
-
-		if (value_len <= max_value_len) {
-			memcpy(value, ical_prop_buf + name_size + 1, value_len);
-			value[value_len] = '\0';
-			ret = true;
-		} else {
-			/* Property value overflow. */
-			LOG_ERR("%s value overflow.", name);
-			ret = false;
-		}
-	} else if (ical_prop_buf[name_size] == ';') {
+	if (ical->line[name_len] == ';' && !event_props[prop].params) {
 		/* Does not support property parameter. */
 		LOG_ERR("%s param not supported.", name);
-		ret = false;
-	} else {
-		/* Property wrong format - no parameter or value. */
-		LOG_ERR("%s wrong format.", name);
-		ret = false;
+		return false;
 	}
 
-	return ret;
-}
-
-static bool parse_datetime_props(const char *buf,
-				 const char *name,
-				 size_t name_size,
-				 char *value,
-				 size_t max_value_len)
-{
-	bool ret;
-	size_t unfold_size;
-	char ical_prop_buf[CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE + 1];
-
-	unfold_size = unfold_contentline(buf, ical_prop_buf);
-	if (unfold_size <= 0) {
-		/* Property wrong format - fail to unfold property. */
-		LOG_ERR("%s wrong format. Fail to unfold property", name);
+	value = contentline_value(ical->line, name_len);
+	if (value == NULL) {
+		/* Property wrong format - no value. */
+		LOG_ERR("%s wrong format - no value.", name);
 		return false;
 	}
 
-	if (ical_prop_buf[name_size] == ':') {
-		size_t value_len = unfold_size - name_size - 1;
-
-		if (value_len <= max_value_len) {
-			memcpy(value, ical_prop_buf + name_size + 1, value_len);
-			value[value_len] = '\0';
-			ret = true;
-		} else {
-			/* Property value overflow. */
-			LOG_ERR("%s value overflow.", name);
-			ret = false;
-		}
-	} else if (ical_prop_buf[name_size] == ';') {
-		char *dtvalue;
-
-		dtvalue = strchr(ical_prop_buf, ':');
-		if (dtvalue) {
-			dtvalue = dtvalue + 1;
-			size_t value_len;
-
-			value_len = unfold_size - (dtvalue - ical_prop_buf);
-			if (value_len <= max_value_len) {
-				memcpy(value, dtvalue, value_len);
-				value[value_len] = '\0';
-				ret = true;
-			} else {
-				/* Property value overflow. */
-				LOG_ERR("%s value overflow.", name);
-				ret = false;
-			}
-		} else {
-			/* Property wrong format - no value. */
-			LOG_ERR("%s wrong format - no value.", name);
-			ret = false;
-		}
-	} else {
-		/* Property wrong format - no parameter or value. */
-		LOG_ERR("%s wrong format.", name);
-		ret = false;
+	value_len = ical->line + ical->line_len - value;
+	if (value_len > event_props[prop].max_value_len) {
+		/* Property value overflow. */
+		LOG_ERR("%s value overflow.", name);
+		return false;
 	}
 
-	return ret;
+	dest = (char *)&ical->evt.ical_com + event_props[prop].offset;
+	memcpy(dest, value, value_len);
+	dest[value_len] = '\0';
+
+	return true;
 }
 
-static size_t parse_calprops(const char *buf)
+static void parse_eventprop(struct icalendar_parser *ical, size_t name_len)
 {
-	const char *parsed = buf;
-	char *end = NULL;
-	char prop_value[CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE + 1];
-
-	parsed = strstr(parsed, "BEGIN:VCALENDAR\r\n");
-	if (parsed == NULL) {
-		return 0;
+	if (ical->evt.id != ICAL_EVT_VEVENT || ical->evt.error != ICAL_ERROR_NONE) {
+		return;
 	}
-	parsed += strlen("BEGIN:VCALENDAR\r\n");
 
-	end = strstr(parsed, "\r\nBEGIN:");
-	if (end == NULL) {
-		return 0;
-	}
-	end += strlen("\r\n");
-
-	while (parsed < end) {
-		memset(prop_value, 0, sizeof(prop_value));
-		if (!strncmp(parsed, "PRODID", 6)) {
-			if (!parse_desc_props(parsed, "PRODID", 6,
-					prop_value, sizeof(prop_value))) {
-				LOG_ERR("Wrong PRODID");
-			}
-		} else if (!strncmp(parsed, "VERSION", 7)) {
-			if (!parse_desc_props(parsed, "VERSION", 7,
-					prop_value, sizeof(prop_value))) {
-				LOG_ERR("Wrong VERSION");
+	for (size_t i = 0; i < ARRAY_SIZE(event_props); i++) {
+		if (name_equals(ical->line, name_len, event_props[i].name)) {
+			if (!parse_prop(ical, i, name_len)) {
+				ical->evt.error = event_props[i].error;
 			}
+			return;
 		}
-		parsed = strstr(parsed, "\r\n");
-		parsed += strlen("\r\n");
 	}
-
-	return (parsed - buf);
 }
 
-static size_t parse_eventprop(const char *buf, struct ical_parser_evt *evt)
+static void send_event(struct icalendar_parser *ical)
 {
-	const char *parsed = buf;
-	char *com_end;
+	int err;
 
-	if (strncmp(buf, "BEGIN:VEVENT\r\n", strlen("BEGIN:VEVENT\r\n"))) {
-		return 0;
-	}
+	err = ical->callback(&ical->evt);
+	ical->event_count++;
 
-	com_end = strstr(buf, "END:VEVENT\r\n");
-	if (com_end == NULL) {
-		return 0;
+	if (err) {
+		LOG_DBG("Parsing stopped by the application");
+		ical->stopped = true;
+	} else if (ical->max_events > 0 && ical->event_count >= ical->max_events) {
+		LOG_DBG("Parsing stopped after %zu events", ical->event_count);
+		ical->stopped = true;
 	}
+}
 
-	evt->id = ICAL_EVT_VEVENT;
-	evt->error = ICAL_ERROR_NONE;
-	com_end += strlen("END:VEVENT\r\n");
-	while (parsed < com_end) {
-		if (!strncasecmp(parsed, "SUMMARY", 7)) {
-			if (!parse_desc_props(
-				parsed, "SUMMARY", 7,
-				evt->ical_com.summary,
-				CONFIG_ICAL_PARSER_SUMMARY_SIZE)) {
-				evt->error = ICAL_ERROR_SUMMARY;
-				parsed = com_end;
-			}
-		} else if (!strncasecmp(parsed, "LOCATION", 8)) {
-			if (!parse_desc_props(
-				parsed, "LOCATION", 8,
-				evt->ical_com.location,
-				CONFIG_ICAL_PARSER_LOCATION_SIZE)) {
-				evt->error = ICAL_ERROR_LOCATION;
-				parsed = com_end;
-			}
-		} else if (!strncasecmp(parsed, "DESCRIPTION", 11)) {
-			if (!parse_desc_props(
-				parsed, "DESCRIPTION", 11,
-				evt->ical_com.description,
-				CONFIG_ICAL_PARSER_DESCRIPTION_SIZE)) {
-				evt->error = ICAL_ERROR_DESCRIPTION;
-				parsed = com_end;
-			}
-		} else if (!strncasecmp(parsed, "DTSTART", 7)) {
-			if (!parse_datetime_props(
-				parsed, "DTSTART", 7,
-				evt->ical_com.dtstart,
-				CONFIG_ICAL_PARSER_DTSTART_SIZE)) {
-				evt->error = ICAL_ERROR_DTSTART;
-				parsed = com_end;
-			}
-		} else if (!strncasecmp(parsed,
-					"DTEND", 5)) {
-			if (!parse_datetime_props(
-				parsed, "DTEND", 5,
-				evt->ical_com.dtend,
-				CONFIG_ICAL_PARSER_DTEND_SIZE)) {
-				evt->error = ICAL_ERROR_DTEND;
-				parsed = com_end;
-			}
+static void parse_begin(struct icalendar_parser *ical, const char *com_name)
+{
+	if (!ical->icalobject_begin) {
+		/* Check begin of iCalendar object delimiter
+		 * Reference: RFC 5545 3.4 iCalendar Object
+		 */
+		if (!strcasecmp(com_name, "VCALENDAR")) {
+			LOG_DBG("Found a calendar stream");
+			ical->icalobject_begin = true;
 		}
-
-		/* Move parsed pointer to end of line break */
-		parsed = strstr(parsed, "\r\n") + 2;
+		return;
 	}
 
-	return parsed - buf;
-}
-
-static size_t parse_todoprop(const char *buf, struct ical_parser_evt *evt)
-{
-	const char *parsed = buf;
-	char *com_end;
+	if (ical->in_component || ical->skip_depth > 0) {
+		/* Subcomponent, such as VALARM, or a component inside an unknown component. */
+		ical->skip_depth++;
+		return;
+	}
 
-	com_end = strstr(buf, "END:VTODO\r\n");
-	if (com_end) {
-		parsed = com_end + strlen("END:VTODO\r\n");
+	for (size_t i = 0; i < ARRAY_SIZE(component_names); i++) {
+		if (!strcasecmp(com_name, component_names[i])) {
+			memset(&ical->evt, 0, sizeof(ical->evt));
+			ical->evt.id = i;
+			ical->evt.error = (i == ICAL_EVT_VEVENT) ?
+					  ICAL_ERROR_NONE : ICAL_ERROR_COM_NOT_SUPPORTED;
+			ical->in_component = true;
+			return;
+		}
 	}
-	evt->id = ICAL_EVT_VTODO;
-	evt->error = ICAL_ERROR_COM_NOT_SUPPORTED;
 
-	return parsed - buf;
+	/* Unknown component, such as an experimental X-component. */
+	ical->skip_depth++;
 }
 
-static size_t parse_jourprop(const char *buf,
-				struct ical_parser_evt *evt)
+static void parse_end(struct icalendar_parser *ical, const char *com_name)
 {
-	const char *parsed = buf;
-	char *com_end;
-
-	com_end = strstr(buf, "END:VJOURNAL\r\n");
-	if (com_end) {
-		parsed = com_end + strlen("END:VJOURNAL\r\n");
+	if (!ical->icalobject_begin) {
+		return;
 	}
-	evt->id = ICAL_EVT_VJOURNAL;
-	evt->error = ICAL_ERROR_COM_NOT_SUPPORTED;
-
-	return parsed - buf;
-}
 
-static size_t parse_fbprop(const char *buf, struct ical_parser_evt *evt)
-{
-	const char *parsed = buf;
-	char *com_end;
+	if (ical->skip_depth > 0) {
+		ical->skip_depth--;
+		return;
+	}
 
-	com_end = strstr(buf, "END:VFREEBUSY\r\n");
-	if (com_end) {
-		parsed = com_end + strlen("END:VFREEBUSY\r\n");
+	if (ical->in_component) {
+		if (!strcasecmp(com_name, component_names[ical->evt.id])) {
+			ical->in_component = false;
+			send_event(ical);
+		}
+		return;
 	}
-	evt->id = ICAL_EVT_VFREEBUSY;
-	evt->error = ICAL_ERROR_COM_NOT_SUPPORTED;
 
-	return parsed - buf;
+	if (!strcasecmp(com_name, "VCALENDAR")) {
+		ical->icalobject_begin = false;
+	}
 }
 
-static size_t parse_tzprop(const char *buf, struct ical_parser_evt *evt)
+static void parse_contentline(struct icalendar_parser *ical)
 {
-	const char *parsed = buf;
-	char *com_end;
+	size_t name_len = strcspn(ical->line, ":;");
+	const char *value;
+
+	if (name_equals(ical->line, name_len, "BEGIN") ||
+	    name_equals(ical->line, name_len, "END")) {
+		value = contentline_value(ical->line, name_len);
+		if (value == NULL) {
+			LOG_WRN("Component delimiter without name");
+			return;
+		}
 
-	com_end = strstr(buf, "END:VTIMEZONE\r\n");
-	if (com_end) {
-		parsed = com_end + strlen("END:VTIMEZONE\r\n");
+		if (name_len == strlen("BEGIN")) {
+			parse_begin(ical, value);
+		} else {
+			parse_end(ical, value);
+		}
+		return;
 	}
-	evt->id = ICAL_EVT_VTIMEZONE;
-	evt->error = ICAL_ERROR_COM_NOT_SUPPORTED;
 
-	return parsed - buf;
-}
-
-static size_t parse_component(char *buf, struct ical_parser_evt *evt)
-{
-	char *com_begin = buf;
-	size_t ret = 0;
-
-	/* Search begin of component */
-	if (!strncmp(com_begin, "BEGIN:VEVENT\r\n", 14)) {
-		ret += parse_eventprop(com_begin, evt);
-	} else if (!strncmp(com_begin, "BEGIN:VTODO\r\n", 13)) {
-		ret += parse_todoprop(com_begin, evt);
-	} else if (!strncmp(com_begin, "BEGIN:VJOURNAL\r\n", 16)) {
-		ret += parse_jourprop(com_begin, evt);
-	} else if (!strncmp(com_begin, "BEGIN:VFREEBUSY\r\n", 17)) {
-		ret += parse_fbprop(com_begin, evt);
-	} else if (!strncmp(com_begin, "BEGIN:VTIMEZONE\r\n", 17)) {
-		ret += parse_tzprop(com_begin, evt);
+	if (ical->in_component && ical->skip_depth == 0) {
+		parse_eventprop(ical, name_len);
 	}
-
-	return ret;
 }
 
-static size_t parse_icalbody(char *buf,	icalendar_parser_callback_t callback)
+static void line_append(struct icalendar_parser *ical, const char *data, size_t len)
 {
-	size_t parsed_bytes = 0, parsed_offset = 0;
-
-	do {
-		struct ical_parser_evt evt;
+	size_t space = CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE - ical->line_len;
 
-		parsed_bytes = parse_component(buf + parsed_offset, &evt);
-		parsed_offset += parsed_bytes;
-		if (parsed_bytes > 0) {
-			callback(&evt);
-		}
-	} while (parsed_bytes > 0);
+	if (len > space) {
+		len = space;
+		ical->line_overflow = true;
+	}
 
-	return parsed_offset;
+	memcpy(ical->line + ical->line_len, data, len);
+	ical->line_len += len;
 }
 
 size_t ical_parser_parse(struct icalendar_parser *ical, const char *data, size_t len)
 {
 	size_t parsed_offset = 0;
 
-	if (CONFIG_ICAL_PARSER_BUFFER_SIZE < (ical->offset + len)) {
-		return -ENOBUFS;
-	}
+	while (parsed_offset < len && !ical->stopped) {
+		const char *sol = data + parsed_offset;
+		const char *eol;
+		size_t line_len;
+
+		if (ical->line_break) {
+			ical->line_break = false;
+
+			if (*sol == ' ' || *sol == '\t') {
+				/* Long content line is split into multiple lines.
+				 * Drop the line break and the whitespace to unfold it.
+				 * Reference: RFC 5545 3.1 Content Lines
+				 */
+				parsed_offset++;
+				continue;
+			}
 
-	memcpy(ical->buf + ical->offset, data, len);
-	ical->buf[ical->offset + len] = '\0';
+			/* Content line is delimited. */
+			ical->line[ical->line_len] = '\0';
+			parse_contentline(ical);
 
-	/* Check begin of iCalendar object delimiter
-	 * Reference: RFC 5545 3.4 iCalendar Object
-	 */
-	if (!ical->icalobject_begin) {
-		/* The body of the iCalendar object consists of
-		 * a sequence of calendar properties and
-		 * one or more calendar components.
-		 *
-		 * Reference: RFC 5545 3.6 Calendar Components
-		 */
-		parsed_offset += parse_calprops(ical->buf);
-		if (parsed_offset > 0) {
-			LOG_DBG("Found a calendar stream");
-			ical->icalobject_begin = true;
+			ical->line_len = 0;
+			ical->line_overflow = false;
+
+			if (ical->stopped) {
+				break;
+			}
 		}
-	}
 
-	/* If we got a calendar property, start parsing calendar body. */
-	if (ical->icalobject_begin) {
-		parsed_offset += parse_icalbody(ical->buf + parsed_offset, ical->callback);
-	}
+		eol = memchr(sol, '\n', len - parsed_offset);
+		line_len = eol ? (size_t)(eol - sol) : (len - parsed_offset);
+
+		line_append(ical, sol, line_len);
+		parsed_offset += line_len;
+
+		if (eol) {
+			parsed_offset++;
+			ical->line_break = true;
 
-	if (parsed_offset) {
-		ical->offset = ical->offset + len - parsed_offset;
-		memcpy(ical->buf, ical->buf + parsed_offset, ical->offset);
+			/* Content lines are delimited by CRLF, also accept a bare LF. */
+			if (ical->line_len > 0 && ical->line[ical->line_len - 1] == '\r') {
+				ical->line_len--;
+			}
+		}
 	}
 
 	return parsed_offset;
 }
 
+void ical_parser_max_events_set(struct icalendar_parser *ical, size_t max_events)
+{
+	ical->max_events = max_events;
+}
+
 int ical_parser_init(struct icalendar_parser *ical, icalendar_parser_callback_t callback)
 {
 	if (ical == NULL || callback == NULL) {
 		return -EINVAL;
 	}
 
+	memset(ical, 0, sizeof(*ical));
 	ical->callback = callback;
-	ical->icalobject_begin = false;
-	ical->offset = 0;
 
 	return 0;
 }
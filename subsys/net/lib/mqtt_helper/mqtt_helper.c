@@ -37,6 +37,14 @@ MQTT_HELPER_STATIC K_SEM_DEFINE(connection_poll_sem, 0, 1);
 static struct mqtt_helper_cfg current_cfg;
 MQTT_HELPER_STATIC enum mqtt_state mqtt_state = MQTT_STATE_UNINIT;
 
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE > 0
+/* Message IDs of QoS 1 messages waiting for a PUBACK. 0 marks a free slot, as it is not a valid
+ * message ID.
+ */
+MQTT_HELPER_STATIC uint16_t publish_window[CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE];
+static K_MUTEX_DEFINE(publish_window_lock);
+#endif /* CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE > 0 */
+
 static const char *state_name_get(enum mqtt_state state)
 {
 	switch (state) {
@@ -241,6 +249,61 @@ static int certificates_provision(void)
 }
 #endif /* CONFIG_MQTT_HELPER_PROVISION_CERTIFICATES */
 
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE > 0
+/* Returns 0 if a slot was reserved for the message ID, 1 if the message ID is already waiting
+ * for a PUBACK, or -EAGAIN if all slots are in use.
+ */
+static int publish_window_reserve(uint16_t message_id)
+{
+	int free_slot = -1;
+	int err = -EAGAIN;
+
+	k_mutex_lock(&publish_window_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(publish_window); i++) {
+		if (publish_window[i] == message_id) {
+			free_slot = -1;
+			err = 1;
+			break;
+		}
+
+		if (publish_window[i] == 0 && free_slot < 0) {
+			free_slot = i;
+		}
+	}
+
+	if (free_slot >= 0) {
+		publish_window[free_slot] = message_id;
+		err = 0;
+	}
+
+	k_mutex_unlock(&publish_window_lock);
+
+	return err;
+}
+
+static void publish_window_release(uint16_t message_id)
+{
+	k_mutex_lock(&publish_window_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(publish_window); i++) {
+		if (publish_window[i] == message_id) {
+			publish_window[i] = 0;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&publish_window_lock);
+}
+
+static void publish_window_clear(void)
+{
+	k_mutex_lock(&publish_window_lock, K_FOREVER);
+	memset(publish_window, 0, sizeof(publish_window));
+	k_mutex_unlock(&publish_window_lock);
+}
+#endif /* CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE > 0 */
+
 static int publish_get_payload(struct mqtt_client *const mqtt_client, size_t length)
 {
 	if (length > sizeof(payload_buf)) {
@@ -267,6 +330,49 @@ static void send_ack(struct mqtt_client *const mqtt_client, uint16_t message_id)
 	LOG_DBG("PUBACK sent for message ID %d", message_id);
 }
 
+#if defined(CONFIG_MQTT_HELPER_PAYLOAD_STREAMING)
+/* Pass the payload to the application in fragments of up to the size of the payload buffer.
+ * The rest of the payload is read from the socket and dropped if the application rejects
+ * a fragment, to keep the MQTT stream in sync.
+ */
+static int publish_stream_payload(struct mqtt_helper_buf topic, size_t length)
+{
+	int err;
+	size_t offset = 0;
+	bool discard = false;
+	struct mqtt_helper_buf fragment = {
+		.ptr = payload_buf,
+	};
+
+	do {
+		fragment.size = MIN(length - offset, sizeof(payload_buf));
+
+		if (fragment.size > 0) {
+			err = mqtt_readall_publish_payload(&mqtt_client, payload_buf,
+							   fragment.size);
+			if (err) {
+				LOG_ERR("Failed to read payload at offset %zu of %zu, error: %d",
+					offset, length, err);
+				return err;
+			}
+		}
+
+		if (!discard) {
+			err = current_cfg.cb.on_publish_fragment(topic, fragment, offset, length);
+			if (err) {
+				LOG_WRN("Payload discarded at offset %zu of %zu, error: %d",
+					offset, length, err);
+				discard = true;
+			}
+		}
+
+		offset += fragment.size;
+	} while (offset < length);
+
+	return discard ? -ECANCELED : 0;
+}
+#endif /* CONFIG_MQTT_HELPER_PAYLOAD_STREAMING */
+
 MQTT_HELPER_STATIC void on_publish(const struct mqtt_evt *mqtt_evt)
 {
 	int err;
@@ -279,6 +385,28 @@ MQTT_HELPER_STATIC void on_publish(const struct mqtt_evt *mqtt_evt)
 		.ptr = payload_buf,
 	};
 
+#if defined(CONFIG_MQTT_HELPER_PAYLOAD_STREAMING)
+	if (current_cfg.cb.on_publish_fragment) {
+		err = publish_stream_payload(topic, p->message.payload.len);
+		if (err == -ECANCELED) {
+			/* Not acknowledged, so that the broker sends the message again. */
+			return;
+		} else if (err) {
+			if (current_cfg.cb.on_error) {
+				current_cfg.cb.on_error(MQTT_HELPER_ERROR_MSG_INCOMPLETE);
+			}
+
+			return;
+		}
+
+		if (p->message.topic.qos == MQTT_QOS_1_AT_LEAST_ONCE) {
+			send_ack(&mqtt_client, p->message_id);
+		}
+
+		return;
+	}
+#endif /* CONFIG_MQTT_HELPER_PAYLOAD_STREAMING */
+
 	err = publish_get_payload(&mqtt_client, p->message.payload.len);
 	if (err) {
 		LOG_ERR("publish_get_payload, error: %d", err);
@@ -332,6 +460,10 @@ MQTT_HELPER_STATIC void mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 
 		mqtt_state_set(MQTT_STATE_DISCONNECTED);
 
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE > 0
+		publish_window_clear();
+#endif
+
 		if (current_cfg.cb.on_disconnect) {
 			current_cfg.cb.on_disconnect(mqtt_evt->result);
 		}
@@ -347,6 +479,10 @@ MQTT_HELPER_STATIC void mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 			mqtt_evt->param.puback.message_id,
 			mqtt_evt->result);
 
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE > 0
+		publish_window_release(mqtt_evt->param.puback.message_id);
+#endif
+
 		if (current_cfg.cb.on_puback) {
 			current_cfg.cb.on_puback(mqtt_evt->param.puback.message_id,
 						 mqtt_evt->result);
@@ -610,6 +746,10 @@ int mqtt_helper_init(struct mqtt_helper_cfg *cfg)
 
 	mqtt_client_init(&mqtt_client);
 
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE > 0
+	publish_window_clear();
+#endif
+
 	mqtt_state_set(MQTT_STATE_DISCONNECTED);
 
 	return 0;
@@ -629,6 +769,10 @@ int mqtt_helper_connect(struct mqtt_helper_conn_params *conn_params)
 		return -EOPNOTSUPP;
 	}
 
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE > 0
+	publish_window_clear();
+#endif
+
 	err = client_connect(conn_params);
 	if (err) {
 		mqtt_state_set(MQTT_STATE_DISCONNECTED);
@@ -720,6 +864,30 @@ int mqtt_helper_publish(const struct mqtt_publish_param *param)
 		return -EOPNOTSUPP;
 	}
 
+#if CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE > 0
+	if (param->message.topic.qos == MQTT_QOS_1_AT_LEAST_ONCE) {
+		int err;
+		bool reserved;
+
+		err = publish_window_reserve(param->message_id);
+		if (err < 0) {
+			LOG_WRN("%d messages are waiting for PUBACK, try again later",
+				CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE);
+			return err;
+		}
+
+		/* A retransmission keeps the slot reserved by the original message. */
+		reserved = (err == 0);
+
+		err = mqtt_publish(&mqtt_client, param);
+		if (err && reserved) {
+			publish_window_release(param->message_id);
+		}
+
+		return err;
+	}
+#endif /* CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE > 0 */
+
 	return mqtt_publish(&mqtt_client, param);
 }
 
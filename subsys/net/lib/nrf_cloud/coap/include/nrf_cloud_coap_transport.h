@@ -25,6 +25,8 @@ extern "C" {
 
 struct nrf_cloud_coap_client {
 	struct k_mutex mutex;
+	/* One credit per request that may be outstanding at the same time */
+	struct k_sem credits;
 	struct coap_client cc;
 	int sock;
 	bool initialized;
@@ -35,6 +37,43 @@ struct nrf_cloud_coap_client {
 
 #define NRF_CLOUD_COAP_PROXY_RSC "proxy"
 
+/**@brief Completion callback of an asynchronous CoAP request.
+ *
+ * Called once per request, from the CoAP client thread or the system workqueue.
+ * The callback must not block.
+ *
+ * @param result 0 if the request succeeded, a positive value indicating a CoAP result code
+ * of a failed Non-confirmable request, or a negative error number.
+ * @param user Pointer to user-specific data passed to @ref nrf_cloud_coap_request_async.
+ */
+typedef void (*nrf_cloud_coap_done_cb_t)(int result, void *user);
+
+/** @brief CoAP request parameters. */
+struct nrf_cloud_coap_request {
+	/** CoAP method. */
+	enum coap_method method;
+	/** String containing the specific CoAP endpoint to access. */
+	const char *resource;
+	/** Optional string containing REST-style query parameters. */
+	const char *query;
+	/** Optional payload. */
+	const uint8_t *buf;
+	/** Length of payload or 0 if none. */
+	size_t len;
+	/** CoAP content format of the payload. */
+	enum coap_content_format fmt_out;
+	/** CoAP content format for the Accept message option of the returned payload. */
+	enum coap_content_format fmt_in;
+	/** True to add the Accept message option. */
+	bool response_expected;
+	/** True to use a Confirmable message, otherwise, a Non-confirmable message. */
+	bool reliable;
+	/** Optional callback function to receive the response. */
+	coap_client_response_cb_t cb;
+	/** Pointer to user-specific data to be passed back to the response callback. */
+	void *user;
+};
+
 /**
  * @defgroup nrf_cloud_coap_transport nRF CoAP API
  * @{
@@ -118,6 +157,25 @@ int nrf_cloud_coap_transport_proxy_dl_uri_get(char *const uri, size_t uri_len,
  */
 bool nrf_cloud_coap_is_connected(void);
 
+/**@brief Send a CoAP request without waiting for the response.
+ *
+ * Up to CONFIG_NRF_CLOUD_COAP_MAX_PENDING_REQUESTS requests, including the ones made with
+ * the blocking functions, can wait for a response at the same time.
+ * The payload must remain valid until @p done is called.
+ * A Non-confirmable request is completed when the response is received, or after
+ * a few seconds if no response is received.
+ *
+ * @param req Request parameters.
+ * @param done Callback to call when the request is completed, or NULL.
+ * @param done_user Pointer to user-specific data to be passed to @p done.
+ *
+ * @retval -EAGAIN The maximum number of requests are already outstanding.
+ * @retval -ENOBUFS No transfer context available.
+ * @return 0 if the request was sent, otherwise a negative error code.
+ */
+int nrf_cloud_coap_request_async(const struct nrf_cloud_coap_request *req,
+				 nrf_cloud_coap_done_cb_t done, void *done_user);
+
 /**@brief Perform CoAP GET request.
  *
  * The function will block until the response or an error have been returned.
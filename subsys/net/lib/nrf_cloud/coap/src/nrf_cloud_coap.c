@@ -43,11 +43,19 @@ LOG_MODULE_REGISTER(nrf_cloud_coap, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
 #define MAX_COAP_PAYLOAD_SIZE (CONFIG_COAP_CLIENT_BLOCK_SIZE - \
 			       CONFIG_COAP_CLIENT_MESSAGE_HEADER_SIZE)
 
-/* Semaphore to guard CoAP client callback data/error codes for GET and FETCH operations.
- * A single semaphore is sufficient for all public functions since nrf_cloud_coap_transport
- * only allows one transfer at a time.
+/* Semaphores to guard CoAP client callback data/error codes for GET and FETCH operations.
+ * Each operation has its own semaphore, since nrf_cloud_coap_transport allows
+ * several transfers at a time; a slow location request does not hold back a FOTA job check.
  */
-static K_SEM_DEFINE(coap_transfer_sem, 1, 1);
+#if defined(CONFIG_NRF_CLOUD_AGNSS)
+static K_SEM_DEFINE(agnss_sem, 1, 1);
+#endif
+#if defined(CONFIG_NRF_CLOUD_PGPS)
+static K_SEM_DEFINE(pgps_sem, 1, 1);
+#endif
+static K_SEM_DEFINE(location_sem, 1, 1);
+static K_SEM_DEFINE(fota_sem, 1, 1);
+static K_SEM_DEFINE(shadow_sem, 1, 1);
 
 static int64_t get_ts(void)
 {
@@ -105,7 +113,7 @@ int nrf_cloud_coap_agnss_data_get(struct nrf_cloud_coap_agnss_request const *con
 	int err;
 
 	/* Take the semaphore before modifying the static buffer */
-	(void)k_sem_take(&coap_transfer_sem, K_FOREVER);
+	(void)k_sem_take(&agnss_sem, K_FOREVER);
 
 	err = coap_codec_agnss_encode(request, buffer, &len,
 				     COAP_CONTENT_FORMAT_APP_CBOR);
@@ -146,7 +154,7 @@ int nrf_cloud_coap_agnss_data_get(struct nrf_cloud_coap_agnss_request const *con
 	}
 
 give_and_return:
-	k_sem_give(&coap_transfer_sem);
+	k_sem_give(&agnss_sem);
 	return err;
 }
 #endif /* CONFIG_NRF_CLOUD_AGNSS */
@@ -181,7 +189,7 @@ int nrf_cloud_coap_pgps_url_get(struct nrf_cloud_coap_pgps_request const *const
 	int err;
 
 	/* Take the semaphore before modifying the static buffer */
-	(void)k_sem_take(&coap_transfer_sem, K_FOREVER);
+	(void)k_sem_take(&pgps_sem, K_FOREVER);
 
 	err = coap_codec_pgps_encode(request, buffer, &len,
 				     COAP_CONTENT_FORMAT_APP_CBOR);
@@ -220,7 +228,7 @@ int nrf_cloud_coap_pgps_url_get(struct nrf_cloud_coap_pgps_request const *const
 	}
 
 give_and_return:
-	k_sem_give(&coap_transfer_sem);
+	k_sem_give(&pgps_sem);
 	return err;
 }
 #endif /* CONFIG_NRF_CLOUD_PGPS */
@@ -363,6 +371,170 @@ free_and_return:
 	return err;
 }
 
+#if defined(CONFIG_NRF_CLOUD_COAP_SENSOR_COALESCE)
+#define SENSOR_APP_ID_MAX_LEN 32
+#define SENSOR_FLUSH_RETRY K_MSEC(100)
+
+struct sensor_sample {
+	char app_id[SENSOR_APP_ID_MAX_LEN];
+	double value;
+	int64_t ts;
+};
+
+/* Non-confirmable sensor samples waiting to be sent */
+static struct sensor_sample sensor_queue[CONFIG_NRF_CLOUD_COAP_SENSOR_COALESCE_MAX];
+static size_t sensor_queue_len;
+static K_MUTEX_DEFINE(sensor_queue_mut);
+
+/* Payload of the sensor message in flight; one message is in flight at a time */
+static uint8_t sensor_buf[SENSOR_SEND_CBOR_MAX_SIZE];
+static NRF_CLOUD_OBJ_JSON_DEFINE(sensor_bulk);
+static atomic_t sensor_in_flight;
+
+static void sensor_flush_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(sensor_flush_work, sensor_flush_work_fn);
+
+static int sensor_bulk_encode(const struct sensor_sample *samples, size_t count)
+{
+	int err = nrf_cloud_obj_bulk_init(&sensor_bulk);
+
+	for (size_t i = 0; !err && (i < count); i++) {
+		NRF_CLOUD_OBJ_JSON_DEFINE(msg);
+
+		err = nrf_cloud_obj_msg_init(&msg, samples[i].app_id,
+					     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+		if (!err) {
+			err = nrf_cloud_obj_num_add(&msg, NRF_CLOUD_JSON_DATA_KEY,
+						    samples[i].value, false);
+		}
+		if (!err) {
+			err = nrf_cloud_obj_ts_add(&msg, samples[i].ts);
+		}
+		if (!err) {
+			err = nrf_cloud_obj_bulk_add(&sensor_bulk, &msg);
+		}
+		if (err) {
+			(void)nrf_cloud_obj_free(&msg);
+		}
+	}
+
+	if (!err) {
+		err = nrf_cloud_obj_cloud_encode(&sensor_bulk);
+	}
+	/* Free the JSON object; the encoded data remains */
+	(void)nrf_cloud_obj_free(&sensor_bulk);
+
+	return err;
+}
+
+static void sensor_flush_done(int result, void *user)
+{
+	ARG_UNUSED(user);
+
+	if (result < 0) {
+		LOG_ERR("Send failed: %d", result);
+	} else if (result >= COAP_RESPONSE_CODE_BAD_REQUEST) {
+		LOG_RESULT_CODE_ERR("Error from server:", result);
+	}
+
+	(void)nrf_cloud_obj_cloud_encoded_free(&sensor_bulk);
+	atomic_clear_bit(&sensor_in_flight, 0);
+
+	/* Send the samples queued while this message was in flight */
+	k_work_schedule(&sensor_flush_work, K_NO_WAIT);
+}
+
+static void sensor_flush_work_fn(struct k_work *work)
+{
+	struct nrf_cloud_coap_request req = {
+		.method = COAP_METHOD_POST,
+		.reliable = false,
+	};
+	size_t len = sizeof(sensor_buf);
+	size_t count;
+	int err;
+
+	if (atomic_test_and_set_bit(&sensor_in_flight, 0)) {
+		/* Sent when the message in flight is completed */
+		return;
+	}
+
+	k_mutex_lock(&sensor_queue_mut, K_FOREVER);
+
+	count = sensor_queue_len;
+	if (count == 0) {
+		atomic_clear_bit(&sensor_in_flight, 0);
+		goto unlock;
+	}
+
+	if (count == 1) {
+		err = coap_codec_sensor_encode(sensor_queue[0].app_id, sensor_queue[0].value,
+					       sensor_queue[0].ts, sensor_buf, &len,
+					       COAP_CONTENT_FORMAT_APP_CBOR);
+		req.resource = COAP_D2C_RSC;
+		req.buf = sensor_buf;
+		req.len = len;
+		req.fmt_out = COAP_CONTENT_FORMAT_APP_CBOR;
+	} else {
+		err = sensor_bulk_encode(sensor_queue, count);
+		req.resource = COAP_D2C_BULK_RSC;
+		req.buf = sensor_bulk.encoded_data.ptr;
+		req.len = sensor_bulk.encoded_data.len;
+		req.fmt_out = COAP_CONTENT_FORMAT_APP_JSON;
+	}
+
+	if (!err) {
+		err = nrf_cloud_coap_request_async(&req, sensor_flush_done, NULL);
+		if (!err) {
+			LOG_DBG("Sent %zu sensor samples", count);
+			sensor_queue_len = 0;
+			goto unlock;
+		}
+	}
+
+	(void)nrf_cloud_obj_cloud_encoded_free(&sensor_bulk);
+	atomic_clear_bit(&sensor_in_flight, 0);
+
+	if ((err == -EAGAIN) || (err == -ENOBUFS)) {
+		/* All requests are outstanding; samples queued meanwhile are sent along */
+		k_work_schedule(&sensor_flush_work, SENSOR_FLUSH_RETRY);
+	} else {
+		LOG_ERR("Failed to send %zu sensor samples: %d", count, err);
+		sensor_queue_len = 0;
+	}
+
+unlock:
+	k_mutex_unlock(&sensor_queue_mut);
+}
+
+static int sensor_queue_add(const char *app_id, double value, int64_t ts)
+{
+	struct sensor_sample *sample;
+
+	if (strlen(app_id) >= SENSOR_APP_ID_MAX_LEN) {
+		return -E2BIG;
+	}
+
+	k_mutex_lock(&sensor_queue_mut, K_FOREVER);
+
+	if (sensor_queue_len == ARRAY_SIZE(sensor_queue)) {
+		k_mutex_unlock(&sensor_queue_mut);
+		return -ENOBUFS;
+	}
+
+	sample = &sensor_queue[sensor_queue_len++];
+	strcpy(sample->app_id, app_id);
+	sample->value = value;
+	sample->ts = ts;
+
+	k_mutex_unlock(&sensor_queue_mut);
+
+	k_work_schedule(&sensor_flush_work, K_NO_WAIT);
+
+	return 0;
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_SENSOR_COALESCE */
+
 int nrf_cloud_coap_sensor_send(const char *app_id, double value, int64_t ts_ms, bool confirmable)
 {
 	__ASSERT_NO_MSG(app_id != NULL);
@@ -370,7 +542,15 @@ int nrf_cloud_coap_sensor_send(const char *app_id, double value, int64_t ts_ms,
 		return -EACCES;
 	}
 	int64_t ts = (ts_ms == NRF_CLOUD_NO_TIMESTAMP) ? get_ts() : ts_ms;
-	static uint8_t buffer[SENSOR_SEND_CBOR_MAX_SIZE];
+
+#if defined(CONFIG_NRF_CLOUD_COAP_SENSOR_COALESCE)
+	/* Send from the queue, unless it is full */
+	if (!confirmable && !sensor_queue_add(app_id, value, ts)) {
+		return 0;
+	}
+#endif
+
+	uint8_t buffer[SENSOR_SEND_CBOR_MAX_SIZE];
 	size_t len = sizeof(buffer);
 	int result = 0;
 	int err;
@@ -491,7 +671,7 @@ int nrf_cloud_coap_location_send(const struct nrf_cloud_gnss_data *gnss, bool co
 		return -EACCES;
 	}
 	int64_t ts = (gnss->ts_ms == NRF_CLOUD_NO_TIMESTAMP) ? get_ts() : gnss->ts_ms;
-	static uint8_t buffer[LOCATION_SEND_CBOR_MAX_SIZE];
+	uint8_t buffer[LOCATION_SEND_CBOR_MAX_SIZE];
 	size_t len = sizeof(buffer);
 	int err;
 	int result = 0;
@@ -569,7 +749,7 @@ int nrf_cloud_coap_location_get(struct nrf_cloud_coap_location_request const *co
 	(void)nrf_cloud_ground_fix_url_encode(url, url_size, COAP_GND_FIX_RSC, conf);
 
 	/* Take the semaphore before modifying the static buffer */
-	(void)k_sem_take(&coap_transfer_sem, K_FOREVER);
+	(void)k_sem_take(&location_sem, K_FOREVER);
 
 	loc_err = 0;
 
@@ -615,7 +795,7 @@ int nrf_cloud_coap_location_get(struct nrf_cloud_coap_location_request const *co
 	}
 
 give_and_return:
-	k_sem_give(&coap_transfer_sem);
+	k_sem_give(&location_sem);
 	return err;
 }
 
@@ -647,7 +827,7 @@ int nrf_cloud_coap_fota_job_get(struct nrf_cloud_fota_job_info *const job)
 
 	job->type = NRF_CLOUD_FOTA_TYPE__INVALID;
 
-	(void)k_sem_take(&coap_transfer_sem, K_FOREVER);
+	(void)k_sem_take(&fota_sem, K_FOREVER);
 
 	fota_err = 0;
 
@@ -685,7 +865,7 @@ int nrf_cloud_coap_fota_job_get(struct nrf_cloud_fota_job_info *const job)
 	}
 
 give_and_return:
-	k_sem_give(&coap_transfer_sem);
+	k_sem_give(&fota_sem);
 	return err;
 }
 
@@ -792,7 +972,7 @@ int nrf_cloud_coap_shadow_get(char *buf, size_t *buf_len, bool delta,
 
 	int err;
 
-	(void)k_sem_take(&coap_transfer_sem, K_FOREVER);
+	(void)k_sem_take(&shadow_sem, K_FOREVER);
 
 	shadow_data.buf		= buf;
 	shadow_data.buf_len	= *buf_len;
@@ -823,7 +1003,7 @@ int nrf_cloud_coap_shadow_get(char *buf, size_t *buf_len, bool delta,
 	}
 
 give_and_return:
-	k_sem_give(&coap_transfer_sem);
+	k_sem_give(&shadow_sem);
 	return err;
 }
 
@@ -55,23 +55,38 @@ LOG_MODULE_REGISTER(nrf_cloud_coap_transport, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
 
 #define NRF_CLOUD_COAP_AUTH_RSC "auth/jwt"
 
+/* Bits of cc_xfer_data.state */
+#define XFER_USED	0
+#define XFER_SUBMITTED	1
+#define XFER_COMPLETED	2
+
 /* CoAP client transfer data */
 struct cc_xfer_data {
 	struct nrf_cloud_coap_client *nrfc_cc;
 	coap_client_response_cb_t cb;
 	void *user_data;
+	nrf_cloud_coap_done_cb_t done;
+	void *done_user;
 	int result_code;
-	struct k_sem *sem;
-	atomic_t used;
+	bool reliable;
+	/* Kept until the transfer is completed so it can be cancelled */
+	struct coap_client_request request;
+	/* Completes a Non-confirmable transfer that did not get a response */
+	struct k_work_delayable non_timeout;
+	atomic_t state;
+};
+
+/* Completion of a blocking transfer */
+struct xfer_sync {
+	struct k_sem done;
+	int result;
 };
 
-/* Semaphore to be used with internal coap_client requests */
-static K_SEM_DEFINE(cb_sem, 0, 1);
-/* Semaphore to be used when doing authorization with an external coap_client */
-static K_SEM_DEFINE(ext_cc_sem, 0, 1);
-/* Mutex to be used when using the internal coap_client */
+/* Mutex to be used when connecting or disconnecting the internal coap_client */
 static K_MUTEX_DEFINE(internal_transfer_mut);
 
+BUILD_ASSERT(CONFIG_NRF_CLOUD_COAP_MAX_PENDING_REQUESTS <= CONFIG_COAP_CLIENT_MAX_REQUESTS);
+
 static struct nrf_cloud_coap_client internal_cc = {0};
 
 #if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
@@ -120,16 +135,17 @@ static const char *fmt_name(enum coap_content_format fmt)
 #endif /* CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG */
 
 /* Create a pool of CoAP transfer structures. Memory passed to coap_client needs to
- * persist after any calls to client_transfer() in case a server response to a NON message
- * returns after timeout in client_transfer(), or in case nrf_cloud_coap_transport_disconnect
+ * persist until the transfer is completed, which may be after the caller of an
+ * asynchronous request has returned, or when nrf_cloud_coap_transport_disconnect
  * is called while coap_client is waiting for a packet or timeout from the socket.
  */
 static struct cc_xfer_data xfer_ctx_pool[MAX_XFERS];
+static bool xfer_pool_initialized;
 
 static struct cc_xfer_data *xfer_ctx_take(void)
 {
 	for (int i = 0; i < ARRAY_SIZE(xfer_ctx_pool); i++) {
-		if (!atomic_test_and_set_bit(&xfer_ctx_pool[i].used, 0)) {
+		if (!atomic_test_and_set_bit(&xfer_ctx_pool[i].state, XFER_USED)) {
 			return &xfer_ctx_pool[i];
 		}
 	}
@@ -139,14 +155,15 @@ static struct cc_xfer_data *xfer_ctx_take(void)
 static void xfer_ctx_release(struct cc_xfer_data *ctx)
 {
 	if (ctx) {
-		atomic_clear_bit(&ctx->used, 0);
+		atomic_clear_bit(&ctx->state, XFER_USED);
 	}
 }
 
 static struct cc_xfer_data *xfer_data_init(struct nrf_cloud_coap_client *cc,
 					   coap_client_response_cb_t cb,
 					   void *user,
-					   struct k_sem *sem)
+					   nrf_cloud_coap_done_cb_t done,
+					   void *done_user)
 {
 	struct cc_xfer_data *xfer = xfer_ctx_take();
 
@@ -154,14 +171,83 @@ static struct cc_xfer_data *xfer_data_init(struct nrf_cloud_coap_client *cc,
 		LOG_ERR("Maximum number of CoAP transfers are already in progress");
 		return NULL;
 	}
+	/* The NON timeout of the previous transfer must not complete this one */
+	(void)k_work_cancel_delayable(&xfer->non_timeout);
+	atomic_clear_bit(&xfer->state, XFER_SUBMITTED);
+	atomic_clear_bit(&xfer->state, XFER_COMPLETED);
 	xfer->nrfc_cc = cc;
 	xfer->cb = cb;
 	xfer->user_data = user;
+	xfer->done = done;
+	xfer->done_user = done_user;
 	xfer->result_code = -ECANCELED;
-	xfer->sem = sem;
 	return xfer;
 }
 
+/* Return the transfer and its credit when the request could not be sent */
+static void xfer_abort(struct cc_xfer_data *xfer)
+{
+	struct nrf_cloud_coap_client *client = xfer->nrfc_cc;
+
+	xfer_ctx_release(xfer);
+	k_sem_give(&client->credits);
+}
+
+/* Called once per submitted transfer, when the last response block or an error is
+ * received, when a Non-confirmable transfer times out, or when the transfer is cancelled.
+ */
+static void xfer_complete(struct cc_xfer_data *xfer, int err)
+{
+	struct nrf_cloud_coap_client *client = xfer->nrfc_cc;
+	nrf_cloud_coap_done_cb_t done = xfer->done;
+	void *done_user = xfer->done_user;
+
+	if (atomic_test_and_set_bit(&xfer->state, XFER_COMPLETED)) {
+		return;
+	}
+
+	(void)k_work_cancel_delayable(&xfer->non_timeout);
+
+	if (!xfer->reliable && !err && (xfer->result_code >= COAP_RESPONSE_CODE_BAD_REQUEST)) {
+		/* NON transfers usually do not use a callback,
+		 * so make sure a bad result is not ignored.
+		 */
+		err = xfer->result_code;
+	}
+
+	LOG_DBG("End of client transfer: %d", err);
+	xfer_ctx_release(xfer);
+	k_sem_give(&client->credits);
+
+	if (done) {
+		done(err, done_user);
+	}
+}
+
+static void non_timeout_work_fn(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct cc_xfer_data *xfer = CONTAINER_OF(dwork, struct cc_xfer_data, non_timeout);
+
+	/* Ignore, since caller selected non-reliable transfer. */
+	LOG_DBG("No response to NON request");
+	coap_client_cancel_request(&xfer->nrfc_cc->cc, &xfer->request);
+	xfer_complete(xfer, 0);
+}
+
+/* Complete the transfers that will not get a response after the requests were cancelled */
+static void xfers_cancel(struct nrf_cloud_coap_client *client)
+{
+	for (int i = 0; i < ARRAY_SIZE(xfer_ctx_pool); i++) {
+		struct cc_xfer_data *xfer = &xfer_ctx_pool[i];
+
+		if ((xfer->nrfc_cc == client) && atomic_test_bit(&xfer->state, XFER_USED) &&
+		    atomic_test_bit(&xfer->state, XFER_SUBMITTED)) {
+			xfer_complete(xfer, -ECANCELED);
+		}
+	}
+}
+
 bool nrf_cloud_coap_is_connected(void)
 {
 	return internal_cc.authenticated && !internal_cc.paused;
@@ -495,17 +581,16 @@ static void client_callback(const struct coap_client_response_data *data, void *
 	/* Sanitize the xfer struct to ensure callback is valid, in case transfer
 	 * was cancelled or timed out.
 	 */
-	if (atomic_test_bit(&xfer->used, 0)) {
+	if (atomic_test_bit(&xfer->state, XFER_USED) &&
+	    !atomic_test_bit(&xfer->state, XFER_COMPLETED)) {
 		xfer->result_code = data->result_code;
 		if (xfer->cb) {
 			LOG_DBG("Calling user's callback %p", xfer->cb);
 			xfer->cb(data, xfer->user_data);
 		}
-	}
-	if (data->last_block || (data->result_code >= COAP_RESPONSE_CODE_BAD_REQUEST)) {
-		LOG_DBG("End of client transfer");
-		if (xfer->sem) {
-			k_sem_give(xfer->sem);
+		if (data->last_block || (data->result_code >= COAP_RESPONSE_CODE_BAD_REQUEST) ||
+		    (data->result_code < 0)) {
+			xfer_complete(xfer, 0);
 		}
 	}
 }
@@ -513,86 +598,138 @@ static void client_callback(const struct coap_client_response_data *data, void *
 
 BUILD_ASSERT((NRF_CLOUD_COAP_NUM_INTERNAL_OPTIONS + CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS) <=
 		CONFIG_COAP_CLIENT_MAX_EXTRA_OPTIONS);
-static int client_transfer(enum coap_method method,
-			   const char *resource, const char *query,
-			   const uint8_t *buf, size_t buf_len,
-			   enum coap_content_format fmt_out,
-			   enum coap_content_format fmt_in,
-			   bool response_expected,
-			   bool reliable,
-			   struct cc_xfer_data *xfer)
+
+/* Send the request of a transfer. The transfer is completed by client_callback(),
+ * by the NON timeout, or when the requests are cancelled.
+ */
+static int xfer_submit(struct cc_xfer_data *xfer, const struct nrf_cloud_coap_request *req)
 {
-	if (xfer == NULL) {
-		return -ENOBUFS;
-	}
-	__ASSERT_NO_MSG(resource != NULL);
+	__ASSERT_NO_MSG(req->resource != NULL);
 
 	int err = 0;
-	int retry;
-	struct coap_client_request request = {
-		.method = method,
-		.confirmable = reliable,
-		.fmt = fmt_out,
-		.payload = (uint8_t *)buf,
-		.len = buf_len,
+	struct coap_client_request *request = &xfer->request;
+	struct coap_client *const cc = &xfer->nrfc_cc->cc;
+
+	*request = (struct coap_client_request) {
+		.method = req->method,
+		.confirmable = req->reliable,
+		.fmt = req->fmt_out,
+		.payload = (uint8_t *)req->buf,
+		.len = req->len,
 		.cb = client_callback,
 		.user_data = xfer
 	};
-	struct coap_client *const cc = &xfer->nrfc_cc->cc;
+	xfer->reliable = req->reliable;
 
 	size_t num_internal_options = 0;
-	if (response_expected) {
+	if (req->response_expected) {
 		num_internal_options += 1;
-		request.options[0] = (struct coap_client_option) {
+		request->options[0] = (struct coap_client_option) {
 			.code = COAP_OPTION_ACCEPT,
 			.len = 1,
-			.value[0] = fmt_in
+			.value[0] = req->fmt_in
 		};
 	}
 
 	size_t num_user_options = CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS;
 #if (CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS > 0)
-	nrf_cloud_coap_get_user_options(&request.options[num_internal_options], &num_user_options,
-		resource, xfer->user_data);
+	nrf_cloud_coap_get_user_options(&request->options[num_internal_options],
+		&num_user_options, req->resource, xfer->user_data);
 #endif
 	const size_t total_options = num_internal_options + num_user_options;
 
-	request.num_options = total_options;
+	request->num_options = total_options;
 
-	if (!query) {
-		strncpy(request.path, resource, MAX_PATH_SIZE);
-		request.path[MAX_PATH_SIZE - 1] = '\0';
+	if (!req->query) {
+		strncpy(request->path, req->resource, MAX_PATH_SIZE);
+		request->path[MAX_PATH_SIZE - 1] = '\0';
 	} else {
-		err = snprintk(request.path, sizeof(request.path), "%s?%s", resource, query);
-		if ((err <= 0) || (err >= sizeof(request.path))) {
+		err = snprintk(request->path, sizeof(request->path), "%s?%s",
+			       req->resource, req->query);
+		if ((err <= 0) || (err >= sizeof(request->path))) {
 			/* If we get here, CONFIG_COAP_CLIENT_MAX_PATH_LENGTH needs a bump */
-			LOG_ERR("Could not format string: %s?%s", resource, query);
-			err = -ETXTBSY;
-			goto transfer_end;
+			LOG_ERR("Could not format string: %s?%s", req->resource, req->query);
+			return -ETXTBSY;
 		}
 	}
 
 #if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
-	LOG_DBG("%s %s %s Content-Format:%s, %zd bytes out, Accept:%s", reliable ? "CON" : "NON",
-		METHOD_NAME(method), request.path, fmt_name(fmt_out), buf_len,
-		response_expected ? fmt_name(fmt_in) : "none");
+	LOG_DBG("%s %s %s Content-Format:%s, %zd bytes out, Accept:%s",
+		req->reliable ? "CON" : "NON", METHOD_NAME(req->method), request->path,
+		fmt_name(req->fmt_out), req->len,
+		req->response_expected ? fmt_name(req->fmt_in) : "none");
 #endif /* CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG */
 
+	if (xfer->nrfc_cc->sock < 0) {
+		LOG_ERR("Socket closed during CoAP request");
+		return -ESHUTDOWN;
+	}
+
+	/* Mark the transfer and start the NON timeout before the request is sent;
+	 * the response can arrive and complete the transfer before coap_client_req() returns.
+	 */
+	atomic_set_bit(&xfer->state, XFER_SUBMITTED);
+	if (!req->reliable) {
+		/* The response might never come */
+		k_work_schedule(&xfer->non_timeout, K_SECONDS(NON_RESP_WAIT_S));
+	}
+
+	err = coap_client_req(cc, xfer->nrfc_cc->sock, NULL, request, NULL);
+	if (err < 0) {
+		(void)k_work_cancel_delayable(&xfer->non_timeout);
+		atomic_clear_bit(&xfer->state, XFER_SUBMITTED);
+		return err;
+	}
+
+	if (req->len) {
+		LOG_HEXDUMP_DBG(req->buf, MIN(64, req->len), "Sent");
+	}
+
+	return 0;
+}
+
+static void xfer_sync_done(int result, void *user)
+{
+	struct xfer_sync *sync = user;
+
+	sync->result = result;
+	k_sem_give(&sync->done);
+}
+
+/* Send a request and block until it is completed. Other threads can send requests
+ * while this one waits for its response, up to the number of credits of the client.
+ */
+static int client_transfer(struct nrf_cloud_coap_client *const client,
+			   const struct nrf_cloud_coap_request *req)
+{
+	int err = 0;
+	int retry;
+	struct cc_xfer_data *xfer;
+	struct xfer_sync sync;
+
+	k_sem_init(&sync.done, 0, 1);
+
+	(void)k_sem_take(&client->credits, K_FOREVER);
+
+	xfer = xfer_data_init(client, req->cb, req->user, xfer_sync_done, &sync);
+	if (xfer == NULL) {
+		k_sem_give(&client->credits);
+		return -ENOBUFS;
+	}
+
 	retry = 0;
-	k_sem_reset(xfer->sem);
-	while ((xfer->nrfc_cc->sock >= 0) &&
-	       (err = coap_client_req(cc, xfer->nrfc_cc->sock, NULL, &request, NULL)) == -EAGAIN) {
+	while ((err = xfer_submit(xfer, req)) == -EAGAIN) {
 		if (!nrf_cloud_coap_is_connected()) {
 			err = -EACCES;
 			break;
 		}
-		/* -EAGAIN means the CoAP client is currently waiting for a response
-		 * to a previous request (likely started in a separate thread).
+		/* -EAGAIN means the CoAP client has no room for another request,
+		 * likely because requests of an external client are in progress.
 		 */
 		if (retry++ > CONFIG_NRF_CLOUD_COAP_MAX_RETRIES) {
 			LOG_ERR("Timeout waiting for CoAP client to be available");
 			err = -ETIMEDOUT;
-			goto transfer_end;
+			break;
 		}
 		LOG_DBG("CoAP client busy");
 		k_sleep(K_MSEC(500));
@@ -600,62 +737,85 @@ static int client_transfer(enum coap_method method,
 
 	if (err < 0) {
 		LOG_ERR("Error sending CoAP request: %d", err);
+		xfer_abort(xfer);
 	} else {
+		/* Completed by coap_client exhausting its retries when reliable transfer
+		 * selected, otherwise by the NON timeout because response might never come.
+		 */
+		(void)k_sem_take(&sync.done, K_FOREVER);
+		LOG_DBG("Got callback");
+		err = sync.result;
+	}
 
-		if (xfer->nrfc_cc->sock < 0) {
-			LOG_ERR("Socket closed during CoAP request");
-			err = -ESHUTDOWN;
-			goto transfer_end;
-		}
+	if (err == -ETIMEDOUT && IS_ENABLED(CONFIG_NRF_CLOUD_COAP_DISCONNECT_ON_FAILED_REQUEST)) {
+		nrf_cloud_coap_disconnect();
+	}
+	return err;
+}
 
-		if (buf_len) {
-			LOG_HEXDUMP_DBG(buf, MIN(64, buf_len), "Sent");
-		}
-		/* Wait for coap_client to exhaust retries when reliable transfer selected,
-		 * otherwise wait a finite time because response might never come.
-		 */
-		err = k_sem_take(xfer->sem, reliable ? K_FOREVER : K_SECONDS(NON_RESP_WAIT_S));
-		if (!err) {
-			LOG_DBG("Got callback");
-		} else {
-			LOG_DBG("Got timeout: %d", err);
-			/* Ignore, since caller selected non-reliable transfer. */
-			err = 0;
-		}
+int nrf_cloud_coap_request_async(const struct nrf_cloud_coap_request *req,
+				 nrf_cloud_coap_done_cb_t done, void *done_user)
+{
+	__ASSERT_NO_MSG(req != NULL);
+
+	int err;
+	struct cc_xfer_data *xfer;
+
+	if (!internal_cc.initialized) {
+		return -EACCES;
 	}
 
-	if (!reliable && !err && (xfer->result_code >= COAP_RESPONSE_CODE_BAD_REQUEST)) {
-		/* NON transfers usually do not use a callback,
-		 * so make sure a bad result is not ignored.
-		 */
-		err = xfer->result_code;
+	if (k_sem_take(&internal_cc.credits, K_NO_WAIT)) {
+		return -EAGAIN;
 	}
 
-transfer_end:
-	xfer_ctx_release(xfer);
-	coap_client_cancel_request(cc, &request);
-	if (err == -ETIMEDOUT && IS_ENABLED(CONFIG_NRF_CLOUD_COAP_DISCONNECT_ON_FAILED_REQUEST)) {
-		nrf_cloud_coap_disconnect();
+	xfer = xfer_data_init(&internal_cc, req->cb, req->user, done, done_user);
+	if (xfer == NULL) {
+		k_sem_give(&internal_cc.credits);
+		return -ENOBUFS;
 	}
+
+	err = xfer_submit(xfer, req);
+	if (err) {
+		xfer_abort(xfer);
+	}
+
 	return err;
 }
 
+static int internal_transfer(enum coap_method method,
+			     const char *resource, const char *query,
+			     const uint8_t *buf, size_t len,
+			     enum coap_content_format fmt_out,
+			     enum coap_content_format fmt_in,
+			     bool response_expected, bool reliable,
+			     coap_client_response_cb_t cb, void *user)
+{
+	const struct nrf_cloud_coap_request req = {
+		.method = method,
+		.resource = resource,
+		.query = query,
+		.buf = buf,
+		.len = len,
+		.fmt_out = fmt_out,
+		.fmt_in = fmt_in,
+		.response_expected = response_expected,
+		.reliable = reliable,
+		.cb = cb,
+		.user = user
+	};
+
+	return client_transfer(&internal_cc, &req);
+}
+
 int nrf_cloud_coap_get(const char *resource, const char *query,
 		       const uint8_t *buf, size_t len,
 		       enum coap_content_format fmt_out,
 		       enum coap_content_format fmt_in, bool reliable,
 		       coap_client_response_cb_t cb, void *user)
 {
-	int err = 0;
-
-	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
-	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
-
-	err = client_transfer(COAP_METHOD_GET, resource, query,
-			      buf, len, fmt_out, fmt_in, true, reliable, xfer);
-	k_mutex_unlock(&internal_transfer_mut);
-
-	return err;
+	return internal_transfer(COAP_METHOD_GET, resource, query,
+				 buf, len, fmt_out, fmt_in, true, reliable, cb, user);
 }
 
 int nrf_cloud_coap_post(const char *resource, const char *query,
@@ -663,16 +823,8 @@ int nrf_cloud_coap_post(const char *resource, const char *query,
 			enum coap_content_format fmt, bool reliable,
 			coap_client_response_cb_t cb, void *user)
 {
-	int err = 0;
-
-	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
-	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
-
-	err = client_transfer(COAP_METHOD_POST, resource, query,
-			      buf, len, fmt, fmt, false, reliable, xfer);
-	k_mutex_unlock(&internal_transfer_mut);
-
-	return err;
+	return internal_transfer(COAP_METHOD_POST, resource, query,
+				 buf, len, fmt, fmt, false, reliable, cb, user);
 }
 
 int nrf_cloud_coap_put(const char *resource, const char *query,
@@ -680,16 +832,8 @@ int nrf_cloud_coap_put(const char *resource, const char *query,
 		       enum coap_content_format fmt, bool reliable,
 		       coap_client_response_cb_t cb, void *user)
 {
-	int err = 0;
-
-	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
-	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
-
-	err = client_transfer(COAP_METHOD_PUT, resource, query,
-			      buf, len, fmt, fmt, false, reliable, xfer);
-	k_mutex_unlock(&internal_transfer_mut);
-
-	return err;
+	return internal_transfer(COAP_METHOD_PUT, resource, query,
+				 buf, len, fmt, fmt, false, reliable, cb, user);
 }
 
 int nrf_cloud_coap_delete(const char *resource, const char *query,
@@ -697,16 +841,8 @@ int nrf_cloud_coap_delete(const char *resource, const char *query,
 			  enum coap_content_format fmt, bool reliable,
 			  coap_client_response_cb_t cb, void *user)
 {
-	int err = 0;
-
-	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
-	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
-
-	err = client_transfer(COAP_METHOD_DELETE, resource, query,
-			      buf, len, fmt, fmt, false, reliable, xfer);
-	k_mutex_unlock(&internal_transfer_mut);
-
-	return err;
+	return internal_transfer(COAP_METHOD_DELETE, resource, query,
+				 buf, len, fmt, fmt, false, reliable, cb, user);
 }
 
 int nrf_cloud_coap_fetch(const char *resource, const char *query,
@@ -715,16 +851,8 @@ int nrf_cloud_coap_fetch(const char *resource, const char *query,
 			 enum coap_content_format fmt_in, bool reliable,
 			 coap_client_response_cb_t cb, void *user)
 {
-	int err = 0;
-
-	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
-	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
-
-	err = client_transfer(COAP_METHOD_FETCH, resource, query,
-			      buf, len, fmt_out, fmt_in, true, reliable, xfer);
-	k_mutex_unlock(&internal_transfer_mut);
-
-	return err;
+	return internal_transfer(COAP_METHOD_FETCH, resource, query,
+				 buf, len, fmt_out, fmt_in, true, reliable, cb, user);
 }
 
 int nrf_cloud_coap_patch(const char *resource, const char *query,
@@ -732,16 +860,8 @@ int nrf_cloud_coap_patch(const char *resource, const char *query,
 			 enum coap_content_format fmt, bool reliable,
 			 coap_client_response_cb_t cb, void *user)
 {
-	int err = 0;
-
-	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
-	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
-
-	err = client_transfer(COAP_METHOD_PATCH, resource, query,
-			      buf, len, fmt, fmt, false, reliable, xfer);
-	k_mutex_unlock(&internal_transfer_mut);
-
-	return err;
+	return internal_transfer(COAP_METHOD_PATCH, resource, query,
+				 buf, len, fmt, fmt, false, reliable, cb, user);
 }
 
 static void auth_cb(const struct coap_client_response_data *data, void *user_data)
@@ -759,13 +879,21 @@ static int nrf_cloud_coap_auth_post(struct nrf_cloud_coap_client *const client,
 			     const uint8_t *jwt, size_t jwt_len)
 {
 	/* Use the nrf_cloud_coap_client as the user data so the auth flag can be set */
-	void *xfer = xfer_data_init(client, auth_cb, client,
-				    is_internal(client) ? &cb_sem : &ext_cc_sem);
+	const struct nrf_cloud_coap_request req = {
+		.method = COAP_METHOD_POST,
+		.resource = NRF_CLOUD_COAP_AUTH_RSC,
+		.query = ver_string,
+		.buf = jwt,
+		.len = jwt_len,
+		.fmt_out = COAP_CONTENT_FORMAT_TEXT_PLAIN,
+		.fmt_in = COAP_CONTENT_FORMAT_TEXT_PLAIN,
+		.response_expected = false,
+		.reliable = true,
+		.cb = auth_cb,
+		.user = client
+	};
 
-	return client_transfer(COAP_METHOD_POST, NRF_CLOUD_COAP_AUTH_RSC,
-			       ver_string, jwt, jwt_len,
-			       COAP_CONTENT_FORMAT_TEXT_PLAIN, COAP_CONTENT_FORMAT_TEXT_PLAIN,
-			       false, true, xfer);
+	return client_transfer(client, &req);
 }
 
 int nrf_cloud_coap_disconnect(void)
@@ -790,6 +918,15 @@ int nrf_cloud_coap_transport_init(struct nrf_cloud_coap_client *const client)
 		is_internal(client) ? "internal" : "external");
 
 	k_mutex_init(&client->mutex);
+	k_sem_init(&client->credits, CONFIG_NRF_CLOUD_COAP_MAX_PENDING_REQUESTS,
+		   CONFIG_NRF_CLOUD_COAP_MAX_PENDING_REQUESTS);
+
+	if (!xfer_pool_initialized) {
+		for (int i = 0; i < ARRAY_SIZE(xfer_ctx_pool); i++) {
+			k_work_init_delayable(&xfer_ctx_pool[i].non_timeout, non_timeout_work_fn);
+		}
+		xfer_pool_initialized = true;
+	}
 
 	k_mutex_lock(&client->mutex, K_FOREVER);
 	client->cid_saved = false;
@@ -911,6 +1048,7 @@ int nrf_cloud_coap_transport_disconnect(struct nrf_cloud_coap_client *const clie
 	}
 
 	coap_client_cancel_requests(&client->cc);
+	xfers_cancel(client);
 	LOG_DBG("Cancelled requests");
 
 	int tmp;
@@ -1021,6 +1159,7 @@ int nrf_cloud_coap_transport_pause(struct nrf_cloud_coap_client *const client)
 	if (nrfc_dtls_cid_is_active(client->sock) && client->authenticated) {
 		LOG_DBG("Cancelling requests");
 		coap_client_cancel_requests(&client->cc);
+		xfers_cancel(client);
 
 		k_mutex_lock(&client->mutex, K_FOREVER);
 		client->cid_saved = false;
@@ -0,0 +1,664 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fcb.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_defs.h>
+#include <net/nrf_cloud_telemetry.h>
+#include <net/nrf_cloud_codec.h>
+#if defined(CONFIG_NRF_CLOUD_COAP)
+#include <zephyr/net/coap.h>
+#include <net/nrf_cloud_coap.h>
+#endif
+#if defined(CONFIG_DATE_TIME)
+#include <date_time.h>
+#endif
+
+LOG_MODULE_REGISTER(nrf_cloud_telemetry, CONFIG_NRF_CLOUD_TELEMETRY_LOG_LEVEL);
+
+#if USE_PARTITION_MANAGER
+#define TELEMETRY_PARTITION	NRF_CLOUD_TELEMETRY
+#else
+#define TELEMETRY_PARTITION	nrf_cloud_telemetry
+#endif
+
+#define TELEMETRY_MAGIC		0x7e1e0a17
+#define RECORD_SAMPLE		0x5a
+#define RECORD_ACK		0xac
+#define APP_ID_MAX_LEN		32
+#define PAYLOAD_SIZE		CONFIG_NRF_CLOUD_TELEMETRY_PAYLOAD_SIZE
+
+/* Upper bound of the encoded size of a sample in the bulk message, and of the array
+ * around the samples.
+ */
+#define SAMPLE_ENCODED_SIZE(app_id_len)	(96 + (app_id_len))
+#define BATCH_OVERHEAD			2
+#define BATCH_MAX (PAYLOAD_SIZE / SAMPLE_ENCODED_SIZE(1))
+
+struct record_hdr {
+	/* Sequence number of the sample, or of the last sent sample for an ack */
+	uint32_t seq;
+	uint8_t type;
+	uint8_t app_id_len;
+	uint16_t reserved;
+};
+
+/* Samples are stored in flash up to the end of the app ID. Acks are stored as a header. */
+struct sample_record {
+	struct record_hdr hdr;
+	int64_t ts;
+	double value;
+	char app_id[APP_ID_MAX_LEN];
+};
+
+static struct fcb fcb;
+static struct flash_sector fcb_sectors[CONFIG_NRF_CLOUD_TELEMETRY_FLASH_SECTORS];
+/* Records are padded to the flash write block size */
+static uint8_t write_buf[ROUND_UP(sizeof(struct sample_record), 16)] __aligned(4);
+
+/* Protects the FCB and the queue state */
+static K_MUTEX_DEFINE(fcb_lock);
+/* Serializes flushes */
+static K_MUTEX_DEFINE(flush_lock);
+
+static bool initialized;
+/* Sequence number of the next sample */
+static uint32_t next_seq;
+/* Sequence number of the oldest sample in flash */
+static uint32_t first_seq;
+/* Samples up to this sequence number have been sent */
+static uint32_t acked_seq;
+/* Last sample known to be sent; the search for unsent samples starts after it */
+static struct fcb_entry sent_loc;
+/* Incremented when a sector is erased to make room, which invalidates locations */
+static uint32_t drop_gen;
+/* Upper bound of the encoded size of the unsent samples */
+static size_t pending_size;
+/* The last flush failed, and is retried after the retry interval */
+static bool retry_pending;
+static struct nrf_cloud_telemetry_stats stats;
+
+static void flush_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(flush_work, flush_work_fn);
+
+static K_THREAD_STACK_DEFINE(telemetry_stack, CONFIG_NRF_CLOUD_TELEMETRY_STACK_SIZE);
+static struct k_work_q telemetry_workq;
+static bool workq_started;
+
+/* Bulk message, a JSON array of device messages. Over CoAP it is sent to the d2c/bulk
+ * resource, and over MQTT to the bulk topic.
+ */
+static NRF_CLOUD_OBJ_JSON_DEFINE(batch_obj);
+
+static int batch_start(void)
+{
+	return nrf_cloud_obj_bulk_init(&batch_obj);
+}
+
+static int batch_add(const struct sample_record *rec)
+{
+	NRF_CLOUD_OBJ_JSON_DEFINE(msg);
+	char app_id[APP_ID_MAX_LEN + 1];
+	int err;
+
+	memcpy(app_id, rec->app_id, rec->hdr.app_id_len);
+	app_id[rec->hdr.app_id_len] = '\0';
+
+	err = nrf_cloud_obj_msg_init(&msg, app_id, NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (!err) {
+		err = nrf_cloud_obj_num_add(&msg, NRF_CLOUD_JSON_DATA_KEY, rec->value, false);
+	}
+	if (!err && (rec->ts > NRF_CLOUD_NO_TIMESTAMP)) {
+		err = nrf_cloud_obj_ts_add(&msg, rec->ts);
+	}
+	if (!err) {
+		err = nrf_cloud_obj_bulk_add(&batch_obj, &msg);
+	}
+	if (err) {
+		(void)nrf_cloud_obj_free(&msg);
+	}
+
+	return err;
+}
+
+static void batch_free(void)
+{
+	(void)nrf_cloud_obj_free(&batch_obj);
+}
+
+#if defined(CONFIG_NRF_CLOUD_COAP)
+/* Returns a positive CoAP result code if the message was rejected by nRF Cloud */
+static int batch_send(void)
+{
+	return nrf_cloud_coap_obj_send(&batch_obj, true);
+}
+
+static bool batch_rejected(int err)
+{
+	/* Resending a message that nRF Cloud failed to parse does not help */
+	return (err >= COAP_RESPONSE_CODE_BAD_REQUEST) &&
+	       (err < COAP_RESPONSE_CODE_INTERNAL_ERROR);
+}
+#else /* CONFIG_NRF_CLOUD_MQTT */
+static int batch_send(void)
+{
+	struct nrf_cloud_tx_data msg = {
+		.obj = &batch_obj,
+		.topic_type = NRF_CLOUD_TOPIC_BULK,
+		.qos = MQTT_QOS_1_AT_LEAST_ONCE,
+	};
+
+	return nrf_cloud_send(&msg);
+}
+
+static bool batch_rejected(int err)
+{
+	return false;
+}
+#endif /* CONFIG_NRF_CLOUD_COAP */
+
+static uint32_t pending_count(void)
+{
+	return next_seq - MAX(acked_seq + 1, first_seq);
+}
+
+/* Malformed records, such as records from a different version of this module, are
+ * returned with type 0 and skipped.
+ */
+static int record_read(const struct fcb_entry *loc, struct sample_record *rec)
+{
+	size_t len = MIN(loc->fe_data_len, sizeof(*rec));
+	int err;
+
+	memset(rec, 0, sizeof(*rec));
+
+	err = flash_area_read(fcb.fap, FCB_ENTRY_FA_DATA_OFF((*loc)), rec, len);
+	if (err) {
+		LOG_ERR("Failed to read record: %d", err);
+		return err;
+	}
+
+	if ((len < sizeof(rec->hdr)) ||
+	    ((rec->hdr.type == RECORD_SAMPLE) &&
+	     ((rec->hdr.app_id_len == 0) || (rec->hdr.app_id_len > APP_ID_MAX_LEN) ||
+	      (len < offsetof(struct sample_record, app_id) + rec->hdr.app_id_len)))) {
+		rec->hdr.type = 0;
+	}
+
+	return 0;
+}
+
+/* Erase the oldest sector to make room for new records */
+static int oldest_sector_drop(void)
+{
+	struct fcb_entry loc = {0};
+	struct sample_record rec;
+	uint32_t dropped = 0;
+	int err;
+
+	while (!fcb_getnext(&fcb, &loc) && (loc.fe_sector == fcb.f_oldest)) {
+		err = record_read(&loc, &rec);
+		if (err) {
+			return err;
+		}
+
+		if (rec.hdr.type != RECORD_SAMPLE) {
+			continue;
+		}
+
+		first_seq = MAX(first_seq, rec.hdr.seq + 1);
+		if (rec.hdr.seq > acked_seq) {
+			pending_size -= MIN(pending_size, SAMPLE_ENCODED_SIZE(rec.hdr.app_id_len));
+			dropped++;
+		}
+	}
+
+	if (sent_loc.fe_sector == fcb.f_oldest) {
+		memset(&sent_loc, 0, sizeof(sent_loc));
+	}
+
+	err = fcb_rotate(&fcb);
+	if (err) {
+		LOG_ERR("Failed to erase sector: %d", err);
+		return err;
+	}
+
+	drop_gen++;
+	stats.sectors_erased++;
+
+	if (dropped) {
+		stats.dropped += dropped;
+		LOG_WRN("Queue full, %u unsent samples erased", dropped);
+	}
+
+	return 0;
+}
+
+static int record_append(const void *record, size_t len)
+{
+	struct fcb_entry loc;
+	size_t write_len = ROUND_UP(len, flash_area_align(fcb.fap));
+	int err;
+
+	if (write_len > sizeof(write_buf)) {
+		return -E2BIG;
+	}
+
+	memcpy(write_buf, record, len);
+	memset(&write_buf[len], 0, write_len - len);
+
+	err = fcb_append(&fcb, write_len, &loc);
+	if (err == -ENOSPC) {
+		err = oldest_sector_drop();
+		if (!err) {
+			err = fcb_append(&fcb, write_len, &loc);
+		}
+	}
+	if (err) {
+		LOG_ERR("Failed to append record: %d", err);
+		return err;
+	}
+
+	err = flash_area_write(fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc), write_buf, write_len);
+	if (err) {
+		LOG_ERR("Failed to write record: %d", err);
+		return err;
+	}
+
+	err = fcb_append_finish(&fcb, &loc);
+	if (err) {
+		LOG_ERR("Failed to finish record: %d", err);
+		return err;
+	}
+
+	stats.bytes_written += write_len;
+
+	return 0;
+}
+
+static void flush_schedule(void)
+{
+	uint32_t pending = pending_count();
+
+	if ((pending == 0) || retry_pending) {
+		return;
+	}
+
+	if ((pending >= CONFIG_NRF_CLOUD_TELEMETRY_FLUSH_COUNT) ||
+	    (pending_size + BATCH_OVERHEAD >= PAYLOAD_SIZE)) {
+		k_work_reschedule_for_queue(&telemetry_workq, &flush_work, K_NO_WAIT);
+	} else if (CONFIG_NRF_CLOUD_TELEMETRY_FLUSH_INTERVAL > 0) {
+		/* The flush is not delayed by the samples added after the first one */
+		k_work_schedule_for_queue(&telemetry_workq, &flush_work,
+					  K_SECONDS(CONFIG_NRF_CLOUD_TELEMETRY_FLUSH_INTERVAL));
+	}
+}
+
+/* Record that the samples up to last_seq were sent, and erase the sectors that only
+ * hold sent samples.
+ */
+static int batch_commit(uint32_t last_seq, const struct fcb_entry *last_loc, uint32_t gen,
+			size_t count, size_t size)
+{
+	struct record_hdr ack = {
+		.seq = last_seq,
+		.type = RECORD_ACK,
+	};
+	int err;
+
+	acked_seq = last_seq;
+	pending_size -= MIN(pending_size, size);
+	if (gen == drop_gen) {
+		sent_loc = *last_loc;
+	}
+
+	err = record_append(&ack, sizeof(ack));
+	if (err) {
+		/* The samples are sent again after a reset */
+		return err;
+	}
+
+	if (sent_loc.fe_sector == NULL) {
+		return 0;
+	}
+
+	while (fcb.f_oldest != sent_loc.fe_sector) {
+		err = fcb_rotate(&fcb);
+		if (err) {
+			LOG_ERR("Failed to erase sector: %d", err);
+			return err;
+		}
+		stats.sectors_erased++;
+	}
+
+	return 0;
+}
+
+/* Send the oldest unsent samples that fit in one bulk message */
+static int flush_batch(size_t *count)
+{
+	struct fcb_entry loc;
+	struct fcb_entry next;
+	struct sample_record rec;
+	uint32_t last_seq = 0;
+	uint32_t gen;
+	size_t size = BATCH_OVERHEAD;
+	int err;
+
+	*count = 0;
+
+	k_mutex_lock(&fcb_lock, K_FOREVER);
+
+	loc = sent_loc;
+	gen = drop_gen;
+
+	err = batch_start();
+	while (!err && (*count < BATCH_MAX)) {
+		next = loc;
+		if (fcb_getnext(&fcb, &next)) {
+			break;
+		}
+
+		err = record_read(&next, &rec);
+		if (err) {
+			break;
+		}
+
+		if ((rec.hdr.type == RECORD_SAMPLE) && (rec.hdr.seq > acked_seq)) {
+			if (size + SAMPLE_ENCODED_SIZE(rec.hdr.app_id_len) > PAYLOAD_SIZE) {
+				break;
+			}
+
+			err = batch_add(&rec);
+			if (err) {
+				break;
+			}
+
+			size += SAMPLE_ENCODED_SIZE(rec.hdr.app_id_len);
+			last_seq = rec.hdr.seq;
+			(*count)++;
+		}
+
+		loc = next;
+	}
+
+	k_mutex_unlock(&fcb_lock);
+
+	if (err || (*count == 0)) {
+		batch_free();
+		return err;
+	}
+
+	/* The queue is not locked while sending, samples can be added meanwhile */
+	err = batch_send();
+	batch_free();
+
+	k_mutex_lock(&fcb_lock, K_FOREVER);
+
+	if (err && batch_rejected(err)) {
+		LOG_ERR("%zu samples rejected by nRF Cloud: %d", *count, err);
+		stats.dropped += *count;
+		err = 0;
+	} else if (err) {
+		LOG_WRN("Failed to send %zu samples: %d", *count, err);
+		stats.send_errors++;
+	} else {
+		LOG_DBG("Sent %zu samples", *count);
+		stats.sent += *count;
+		stats.messages++;
+	}
+
+	if (!err) {
+		err = batch_commit(last_seq, &loc, gen, *count, size);
+	}
+
+	k_mutex_unlock(&fcb_lock);
+
+	return err;
+}
+
+static int telemetry_flush(void)
+{
+	size_t count;
+	int err;
+
+	k_mutex_lock(&flush_lock, K_FOREVER);
+
+	do {
+		err = flush_batch(&count);
+	} while (!err && (count > 0));
+
+	k_mutex_lock(&fcb_lock, K_FOREVER);
+
+	if (err) {
+		/* Samples are kept and sent when the retry succeeds */
+		retry_pending = true;
+		k_work_reschedule_for_queue(&telemetry_workq, &flush_work,
+					    K_SECONDS(CONFIG_NRF_CLOUD_TELEMETRY_RETRY_INTERVAL));
+	} else {
+		retry_pending = false;
+		flush_schedule();
+	}
+
+	k_mutex_unlock(&fcb_lock);
+	k_mutex_unlock(&flush_lock);
+
+	return err;
+}
+
+static void flush_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	(void)telemetry_flush();
+}
+
+static int queue_load(void)
+{
+	struct fcb_entry loc = {0};
+	struct sample_record rec;
+	uint32_t max_seq = 0;
+	int err;
+
+	first_seq = UINT32_MAX;
+	acked_seq = 0;
+	pending_size = 0;
+
+	while (!fcb_getnext(&fcb, &loc)) {
+		err = record_read(&loc, &rec);
+		if (err) {
+			return err;
+		}
+
+		if (rec.hdr.type == RECORD_ACK) {
+			acked_seq = MAX(acked_seq, rec.hdr.seq);
+		} else if (rec.hdr.type == RECORD_SAMPLE) {
+			first_seq = MIN(first_seq, rec.hdr.seq);
+		}
+		max_seq = MAX(max_seq, rec.hdr.seq);
+	}
+
+	next_seq = max_seq + 1;
+	first_seq = MIN(first_seq, next_seq);
+
+	memset(&loc, 0, sizeof(loc));
+	while (!fcb_getnext(&fcb, &loc)) {
+		err = record_read(&loc, &rec);
+		if (err) {
+			return err;
+		}
+
+		if ((rec.hdr.type == RECORD_SAMPLE) && (rec.hdr.seq > acked_seq)) {
+			pending_size += SAMPLE_ENCODED_SIZE(rec.hdr.app_id_len);
+		}
+	}
+
+	return 0;
+}
+
+static int fcb_setup(void)
+{
+	const struct flash_area *fa;
+	uint32_t sector_cnt = ARRAY_SIZE(fcb_sectors);
+	int err;
+
+	err = flash_area_get_sectors(PARTITION_ID(TELEMETRY_PARTITION), &sector_cnt,
+				     fcb_sectors);
+	if (err) {
+		LOG_ERR("Failed to get flash sectors: %d", err);
+		return err;
+	}
+
+	memset(&fcb, 0, sizeof(fcb));
+	fcb.f_magic = TELEMETRY_MAGIC;
+	fcb.f_sectors = fcb_sectors;
+	fcb.f_sector_cnt = (uint8_t)sector_cnt;
+
+	err = fcb_init(PARTITION_ID(TELEMETRY_PARTITION), &fcb);
+	if (!err) {
+		return 0;
+	}
+
+	/* The partition holds data that is not a telemetry queue */
+	LOG_WRN("Telemetry partition not valid (%d), erasing", err);
+
+	err = flash_area_open(PARTITION_ID(TELEMETRY_PARTITION), &fa);
+	if (err) {
+		return err;
+	}
+
+	err = flash_area_erase(fa, 0, fa->fa_size);
+	flash_area_close(fa);
+	if (err) {
+		LOG_ERR("Failed to erase telemetry partition: %d", err);
+		return err;
+	}
+
+	stats.sectors_erased += sector_cnt;
+
+	return fcb_init(PARTITION_ID(TELEMETRY_PARTITION), &fcb);
+}
+
+int nrf_cloud_telemetry_init(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "nrf_cloud_telemetry",
+	};
+	struct k_work_sync sync;
+	int err;
+
+	if (!workq_started) {
+		k_work_queue_start(&telemetry_workq, telemetry_stack,
+				   K_THREAD_STACK_SIZEOF(telemetry_stack),
+				   CONFIG_NRF_CLOUD_TELEMETRY_THREAD_PRIORITY, &cfg);
+		workq_started = true;
+	}
+
+	(void)k_work_cancel_delayable_sync(&flush_work, &sync);
+
+	k_mutex_lock(&flush_lock, K_FOREVER);
+	k_mutex_lock(&fcb_lock, K_FOREVER);
+
+	initialized = false;
+	retry_pending = false;
+	drop_gen = 0;
+	memset(&sent_loc, 0, sizeof(sent_loc));
+	memset(&stats, 0, sizeof(stats));
+
+	err = fcb_setup();
+	if (err) {
+		LOG_ERR("Failed to initialize flash circular buffer: %d", err);
+		goto unlock;
+	}
+
+	err = queue_load();
+	if (err) {
+		goto unlock;
+	}
+
+	initialized = true;
+	LOG_DBG("%u unsent samples in flash", pending_count());
+
+	flush_schedule();
+
+unlock:
+	k_mutex_unlock(&fcb_lock);
+	k_mutex_unlock(&flush_lock);
+
+	return err;
+}
+
+int nrf_cloud_telemetry_add(const char *app_id, double value, int64_t ts_ms)
+{
+	struct sample_record rec = {0};
+	size_t app_id_len;
+	int err;
+
+	if (!initialized) {
+		return -EACCES;
+	}
+
+	app_id_len = app_id ? strlen(app_id) : 0;
+	if ((app_id_len == 0) || (app_id_len > APP_ID_MAX_LEN)) {
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_DATE_TIME)
+	/* Samples can be sent long after they were measured */
+	if ((ts_ms == NRF_CLOUD_NO_TIMESTAMP) && date_time_now(&ts_ms)) {
+		ts_ms = NRF_CLOUD_NO_TIMESTAMP;
+	}
+#endif
+
+	rec.hdr.type = RECORD_SAMPLE;
+	rec.hdr.app_id_len = app_id_len;
+	rec.ts = ts_ms;
+	rec.value = value;
+	memcpy(rec.app_id, app_id, app_id_len);
+
+	k_mutex_lock(&fcb_lock, K_FOREVER);
+
+	rec.hdr.seq = next_seq;
+	err = record_append(&rec, offsetof(struct sample_record, app_id) + app_id_len);
+	if (!err) {
+		next_seq++;
+		pending_size += SAMPLE_ENCODED_SIZE(app_id_len);
+		flush_schedule();
+	}
+
+	k_mutex_unlock(&fcb_lock);
+
+	return err;
+}
+
+int nrf_cloud_telemetry_flush(void)
+{
+	if (!initialized) {
+		return -EACCES;
+	}
+
+	return telemetry_flush();
+}
+
+void nrf_cloud_telemetry_stats_get(struct nrf_cloud_telemetry_stats *stats_out)
+{
+	if (!stats_out) {
+		return;
+	}
+
+	k_mutex_lock(&fcb_lock, K_FOREVER);
+
+	*stats_out = stats;
+	stats_out->pending = initialized ? pending_count() : 0;
+
+	k_mutex_unlock(&fcb_lock);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Nordic Semiconductor ASA
+ * Copyright (c) 2024-2026 Nordic Semiconductor ASA
  *
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
@@ -139,13 +139,77 @@ typedef struct dict_cache_t {
 	SizeT dict_pos_begin;
 	/** Indicates which dictionary element is stored as last element of @a data. */
 	SizeT dict_pos_end;
-	/** Write offset, for keeping track on invalidated bytes. */
+	/** Write offset, number of valid bytes in @a data. */
 	SizeT write_offset;
 	/** Cache invalidation flag - if set, it is out of sync with external dictionary. */
 	bool invalid;
 } dict_cache;
 
-static dict_cache cache;
+#ifdef CONFIG_NRF_COMPRESS_DICTIONARY_WRITE_BEHIND
+/* The window being filled by the decoder and the window being written to the dictionary. */
+static dict_cache caches[2];
+#else
+static dict_cache caches[1];
+#endif
+
+/* Window being filled by the decoder. */
+static dict_cache *cache = &caches[0];
+#endif
+
+#ifdef CONFIG_NRF_COMPRESS_DICTIONARY_WRITE_BEHIND
+static K_SEM_DEFINE(dict_write_sem, 0, 1);
+static K_SEM_DEFINE(dict_written_sem, 0, 1);
+
+/* Window passed to the dictionary writer thread. */
+static dict_cache *dict_write_cache;
+static bool dict_write_pending;
+static int dict_write_err;
+
+static void dict_writer_fn(void *p1, void *p2, void *p3)
+{
+	const dict_cache *window;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_sem_take(&dict_write_sem, K_FOREVER);
+
+		window = dict_write_cache;
+
+		if (ext_dict->write(window->dict_pos_begin, window->data, window->write_offset) !=
+		    window->write_offset) {
+			dict_write_err = -EIO;
+		} else {
+			dict_write_err = 0;
+		}
+
+		k_sem_give(&dict_written_sem);
+	}
+}
+
+K_THREAD_DEFINE(nrf_compress_dict_writer, CONFIG_NRF_COMPRESS_DICTIONARY_WRITE_BEHIND_STACK_SIZE,
+		dict_writer_fn, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(CONFIG_NRF_COMPRESS_DICTIONARY_WRITE_BEHIND_THREAD_PRIO), 0, 0);
+
+/**
+ * @brief Wait until the window passed to the dictionary writer thread has been written.
+ *
+ * @retval 0 on success or if no write is pending
+ * @retval -EIO on any error with writing to external dictionary
+ */
+static int dict_write_wait(void)
+{
+	if (!dict_write_pending) {
+		return 0;
+	}
+
+	(void)k_sem_take(&dict_written_sem, K_FOREVER);
+	dict_write_pending = false;
+
+	return dict_write_err;
+}
 #endif
 #endif
 
@@ -161,47 +225,118 @@ static CLzmaDec lzma_decoder;
 /**
  * @brief Synchronize dictionary cache with external dictionary.
  *
- * This function synchronizes data in cache with external
- * dictionary and proceeds with cache window.
+ * This function writes the data in cache to external dictionary and proceeds
+ * with cache window. Windows are written whole and at window-aligned positions,
+ * so the dictionary sees writes of a fixed size. With write-behind, the write is
+ * done by the dictionary writer thread while the decoder fills the other window.
  *
  * @param handle pointer to Lzma dictionary handle struct, for dictionary size reference.
  *
  * @retval 0 on successful synchronization
- * @retval -EIO on any error with reading/writing to external dictionary
+ * @retval -EIO on any error with writing to external dictionary
  */
 static int synchronize_cache(const DictHandle *handle)
 {
-	SizeT dict_read_size;
-	const SizeT dict_write_size = cache.write_offset;
+	dict_cache *next = cache;
+	SizeT dict_pos_begin = cache->dict_pos_end + 1;
+
+#ifdef CONFIG_NRF_COMPRESS_DICTIONARY_WRITE_BEHIND
+	int rc;
 
-	if (ext_dict->write(cache.dict_pos_begin, cache.data, dict_write_size) !=
+	next = (cache == &caches[0]) ? &caches[1] : &caches[0];
+
+	/* The other window is reused, it must have been written. */
+	rc = dict_write_wait();
+	if (rc != 0) {
+		return rc;
+	}
+
+	dict_write_cache = cache;
+	dict_write_pending = true;
+	k_sem_give(&dict_write_sem);
+#else
+	const SizeT dict_write_size = cache->write_offset;
+
+	if (ext_dict->write(cache->dict_pos_begin, cache->data, dict_write_size) !=
 			dict_write_size) {
 		return -EIO;
 	}
+#endif
 
-	cache.write_offset = 0;
-
-	cache.dict_pos_begin = cache.dict_pos_end + 1;
+	cache->invalid = false;
 
-	if (cache.dict_pos_begin == handle->dicBufSize) {
+	if (dict_pos_begin == handle->dicBufSize) {
 		/* We reached the end of dictionary, start caching from the beginning. */
-		cache.dict_pos_begin = 0;
+		dict_pos_begin = 0;
 	}
 
-	dict_read_size = (handle->dicBufSize - cache.dict_pos_begin) < sizeof(cache.data) ?
-						(handle->dicBufSize - cache.dict_pos_begin)
-						: sizeof(cache.data);
+	/* Data following the window is read from the dictionary, so it does not
+	 * need to be read into the cache.
+	 */
+	next->dict_pos_begin = dict_pos_begin;
+	next->dict_pos_end = dict_pos_begin +
+			     MIN(handle->dicBufSize - dict_pos_begin, sizeof(next->data)) - 1;
+	next->write_offset = 0;
+	next->invalid = false;
+	cache = next;
 
-	cache.dict_pos_end = cache.dict_pos_begin + dict_read_size - 1;
+	return 0;
+}
 
-	if (ext_dict->read(cache.dict_pos_begin,
-			cache.data, dict_read_size) != dict_read_size) {
-		return -EIO;
+/**
+ * @brief Synchronize dictionary cache and wait until external dictionary holds all
+ *	  decoded data.
+ */
+static int flush_cache(const DictHandle *handle)
+{
+	int rc = 0;
+
+	if (cache->invalid) {
+		rc = synchronize_cache(handle);
 	}
 
-	cache.invalid = false;
+#ifdef CONFIG_NRF_COMPRESS_DICTIONARY_WRITE_BEHIND
+	int write_rc = dict_write_wait();
 
-	return 0;
+	if (rc == 0) {
+		rc = write_rc;
+	}
+#endif
+
+	return rc;
+}
+
+/**
+ * @brief Find the cached data at a dictionary position.
+ *
+ * @param pos dictionary position.
+ * @param len in: requested length, out: length of the data that is either cached in the
+ *	      returned window, or not cached at all.
+ *
+ * @return window holding the data at @a pos, or NULL if it must be read from the dictionary.
+ */
+static const dict_cache *cache_find(SizeT pos, SizeT *len)
+{
+	/* Start with the window being filled, it holds the most recent data. */
+	for (size_t i = 0; i < ARRAY_SIZE(caches); i++) {
+		const dict_cache *window = &caches[((cache - caches) + i) % ARRAY_SIZE(caches)];
+		const SizeT cached_end = window->dict_pos_begin + window->write_offset;
+
+		if (window->write_offset == 0) {
+			continue;
+		}
+
+		if (pos >= window->dict_pos_begin && pos < cached_end) {
+			*len = MIN(*len, cached_end - pos);
+			return window;
+		}
+
+		if (window->dict_pos_begin > pos) {
+			*len = MIN(*len, window->dict_pos_begin - pos);
+		}
+	}
+
+	return NULL;
 }
 #endif
 
@@ -611,9 +746,8 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 
 	if (decoder->dicPos >= decoder->dicHandle->dicBufSize || last_part) {
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
-		if (cache.invalid) {
-			rc = synchronize_cache(decoder->dicHandle);
-		}
+		/* Output is read from the dictionary by the user. */
+		rc = flush_cache(decoder->dicHandle);
 #endif
 		*output_size = decoder->dicPos;
 		decoder->dicPos = 0;
@@ -643,9 +777,14 @@ DictHandle *LzmaDictionaryOpen(SizeT size)
 	dict_handle.dicBufSize = dict_size;
 
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
-	cache.dict_pos_begin = 0;
-	cache.dict_pos_end = sizeof(cache.data) - 1;
-	cache.write_offset = 0;
+	for (size_t i = 0; i < ARRAY_SIZE(caches); i++) {
+		caches[i].write_offset = 0;
+		caches[i].invalid = false;
+	}
+
+	cache = &caches[0];
+	cache->dict_pos_begin = 0;
+	cache->dict_pos_end = MIN(dict_size, sizeof(cache->data)) - 1;
 #endif
 
 	return &dict_handle;
@@ -666,7 +805,7 @@ SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
 	SizeT bytes_written = 0;
 
-	if (pos > cache.dict_pos_end || pos < cache.dict_pos_begin) {
+	if (pos > cache->dict_pos_end || pos < cache->dict_pos_begin) {
 		/*
 		 * Should never happen, lzma operates on dicPos when writing to dictionary,
 		 * which should be aligned with cache.
@@ -676,17 +815,17 @@ SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT
 
 	while (bytes_written < write_len) {
 		SizeT cache_write_len =
-			(write_len - bytes_written) > (sizeof(cache.data) - cache.write_offset) ?
-				(sizeof(cache.data) - cache.write_offset) :
+			(write_len - bytes_written) > (sizeof(cache->data) - cache->write_offset) ?
+				(sizeof(cache->data) - cache->write_offset) :
 				(write_len - bytes_written);
 
-		memcpy(cache.data + cache.write_offset, data + bytes_written, cache_write_len);
-		cache.invalid = true;
+		memcpy(cache->data + cache->write_offset, data + bytes_written, cache_write_len);
+		cache->invalid = true;
 
 		bytes_written += cache_write_len;
-		cache.write_offset += cache_write_len;
+		cache->write_offset += cache_write_len;
 
-		if (cache.write_offset >= sizeof(cache.data)) {
+		if (cache->dict_pos_begin + cache->write_offset > cache->dict_pos_end) {
 			/* Cache full, synchronize it. */
 			if (synchronize_cache(handle) != 0) {
 				bytes_written = 0;
@@ -715,39 +854,21 @@ SizeT LzmaDictionaryRead(DictHandle *handle, SizeT pos, Byte *data, SizeT len)
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
 	SizeT bytes_read = 0;
 
-	if (pos + read_len > cache.dict_pos_begin && pos <= cache.dict_pos_end) {
-		/* We have at least some of the requested data in the cache. */
-		SizeT cache_pos;
-		SizeT cache_copy_size;
+	while (bytes_read < read_len) {
+		SizeT chunk_len = read_len - bytes_read;
+		const dict_cache *window = cache_find(pos + bytes_read, &chunk_len);
 
-		if (pos < cache.dict_pos_begin) {
-			/* First part of data is from dictionary... */
-			bytes_read = ext_dict->read(pos, data, cache.dict_pos_begin - pos);
-			if (bytes_read != cache.dict_pos_begin - pos) {
-				return bytes_read;
-			}
-
-			cache_pos = 0;
-		} else {
-			cache_pos = pos - cache.dict_pos_begin;
+		if (window != NULL) {
+			memcpy(data + bytes_read,
+			       window->data + (pos + bytes_read - window->dict_pos_begin), chunk_len);
+		} else if (ext_dict->read(pos + bytes_read, data + bytes_read, chunk_len) !=
+			   chunk_len) {
+			break;
 		}
 
-		cache_copy_size = (pos + read_len > cache.dict_pos_end) ?
-				(sizeof(cache.data) - cache_pos)
-				: (read_len - bytes_read);
-		memcpy(data + bytes_read, cache.data + cache_pos, cache_copy_size);
-
-		bytes_read += cache_copy_size;
-
-		if (bytes_read != read_len) {
-			/* Last part of data is from dictionary. */
-			bytes_read += ext_dict->read(pos + bytes_read, data + bytes_read,
-								read_len - bytes_read);
-		}
-	} else {
-		/* Requested data is not cached at all. */
-		bytes_read = ext_dict->read(pos, data, read_len);
+		bytes_read += chunk_len;
 	}
+
 	return bytes_read;
 #else
 	return ext_dict->read(pos, data, read_len);
@@ -763,14 +884,13 @@ SRes LzmaDictionaryClose(DictHandle *handle)
 	}
 
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
-	if (handle->isOpened && cache.invalid) {
-		if (synchronize_cache(handle) != 0) {
-			rc = SZ_ERROR_MEM;
-		}
+	if (handle->isOpened && flush_cache(handle) != 0) {
+		rc = SZ_ERROR_MEM;
 	}
 
 	/* Clear the cache. */
-	memset(cache.data, 0, sizeof(cache.data));
+	memset(caches, 0, sizeof(caches));
+	cache = &caches[0];
 #endif
 
 	if (ext_dict->close() != 0) {
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#include "flash_benchmark.h"
+
+void flash_benchmark_image_fill(uint8_t *image, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		image[i] = (uint8_t)(i * 13);
+	}
+}
+
+void flash_benchmark_report(const char *name, bool write_behind, size_t len, int64_t start_ms)
+{
+	int64_t duration_ms = MAX(k_uptime_get() - start_ms, 1);
+
+	printk("%s %s: %zu bytes in %lld ms, %lld kbps\n",
+	       write_behind ? "Write-behind" : "Synchronous", name, len, duration_ms,
+	       ((int64_t)len * 8) / duration_ms);
+}
@@ -0,0 +1,12 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+# Helpers for benchmarks that write an image to the simulated flash of native_sim. Include this
+# file from the test CMakeLists.txt after find_package(Zephyr), and add flash_timing.conf to the
+# EXTRA_CONF_FILE of the test to model the erase and program time of an internal flash.
+
+target_sources(app PRIVATE ${CMAKE_CURRENT_LIST_DIR}/flash_benchmark.c)
+target_include_directories(app PRIVATE ${CMAKE_CURRENT_LIST_DIR})
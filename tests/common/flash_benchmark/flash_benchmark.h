@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FLASH_BENCHMARK_H_
+#define FLASH_BENCHMARK_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Fill an image with a pattern that differs between adjacent bytes and pages.
+ *
+ * @param image Image to fill.
+ * @param len Length of the image.
+ */
+void flash_benchmark_image_fill(uint8_t *image, size_t len);
+
+/**
+ * @brief Print the throughput of an image transfer that started at @p start_ms.
+ *
+ * @param name Name of the transfer, for example "download".
+ * @param write_behind Whether the data was written to flash in the background.
+ * @param len Length of the image.
+ * @param start_ms Uptime when the transfer started, in milliseconds.
+ */
+void flash_benchmark_report(const char *name, bool write_behind, size_t len, int64_t start_ms);
+
+#endif /* FLASH_BENCHMARK_H_ */
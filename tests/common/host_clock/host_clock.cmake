@@ -0,0 +1,11 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+# Host clock for benchmarks on native_sim, where simulated time does not advance while code is
+# executed. Include this file from the test CMakeLists.txt after find_package(Zephyr).
+
+target_sources(native_simulator INTERFACE ${CMAKE_CURRENT_LIST_DIR}/host_clock.c)
+target_include_directories(app PRIVATE ${CMAKE_CURRENT_LIST_DIR})
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef HOST_CLOCK_H_
+#define HOST_CLOCK_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Read the monotonic clock of the host.
+ *
+ * Implemented in the native simulator runner, so it can only be used on native_sim.
+ *
+ * @return Host time in nanoseconds.
+ */
+uint64_t host_clock_ns(void);
+
+#endif /* HOST_CLOCK_H_ */
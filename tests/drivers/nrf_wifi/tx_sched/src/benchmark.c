@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/printk.h>
+
+#include "system/fmac_api.h"
+#include "system/fmac_peer.h"
+#include "common/fmac_util.h"
+#include "emul_rpu.h"
+#include "host_clock.h"
+
+#define BENCH_PEERS		MAX_PEERS
+#define BENCH_FRAMES		20000
+#define BENCH_BURST		8
+#define FRAME_LEN		1500
+
+static const unsigned char ap_addr[NRF_WIFI_ETH_ADDR_LEN] = {0x02, 0x00, 0x00, 0x00, 0x00, 0xaa};
+
+/* IPv4 type of service selecting BK, BE, VI and VO */
+static const unsigned char tos[] = {0x20, 0x00, 0xa0, 0xe0};
+
+ZTEST(nrf71_tx_sched_benchmark, test_tx_throughput)
+{
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx;
+	unsigned char peer_addr[BENCH_PEERS][NRF_WIFI_ETH_ADDR_LEN];
+	unsigned int dropped = 0;
+	uint64_t start;
+	uint64_t elapsed_ns;
+	void *nwb;
+
+	emul_rpu_init();
+
+	fmac_dev_ctx = emul_rpu_dev_alloc();
+	zassert_not_null(fmac_dev_ctx, "Failed to allocate the device");
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	for (int i = 0; i < BENCH_PEERS; i++) {
+		memcpy(peer_addr[i], ap_addr, sizeof(ap_addr));
+		peer_addr[i][NRF_WIFI_ETH_ADDR_LEN - 1] = i + 1;
+
+		zassert_equal(nrf_wifi_fmac_peer_add(fmac_dev_ctx, EMUL_RPU_VIF_AP, peer_addr[i],
+						     0, 1), i);
+	}
+
+	start = host_clock_ns();
+
+	for (int sent = 0; sent < BENCH_FRAMES;) {
+		for (int i = 0; i < BENCH_BURST && sent < BENCH_FRAMES; i++, sent++) {
+			/* A burst goes to one peer and access category, the next burst to
+			 * the next peer, so frames of a burst can be aggregated.
+			 */
+			nwb = emul_rpu_nbuf_alloc(peer_addr[(sent / BENCH_BURST) % BENCH_PEERS],
+						  ap_addr,
+						  tos[(sent / (BENCH_BURST * BENCH_PEERS)) %
+						      ARRAY_SIZE(tos)],
+						  FRAME_LEN);
+			zassert_not_null(nwb);
+
+			if (nrf_wifi_fmac_start_xmit(fmac_dev_ctx, EMUL_RPU_VIF_AP, nwb) !=
+			    NRF_WIFI_STATUS_SUCCESS) {
+				dropped++;
+			}
+		}
+
+		/* The RPU completes the commands sent so far. Commands sent on their completion
+		 * wait for the next burst, so frames queue up while descriptors are in use.
+		 */
+		for (unsigned int n = emul_rpu_outstanding(); n > 0; n--) {
+			emul_rpu_complete(fmac_dev_ctx, NULL);
+		}
+	}
+
+	while (emul_rpu_complete(fmac_dev_ctx, NULL)) {
+	}
+
+	elapsed_ns = host_clock_ns() - start;
+
+	/* Every frame is sent once the RPU has completed all commands */
+	zassert_equal(dropped, 0, "%u frames dropped", dropped);
+	zassert_equal(emul_rpu_stats.frames, BENCH_FRAMES, "%u frames sent",
+		      emul_rpu_stats.frames);
+	zassert_equal(emul_rpu_stats.nbufs, 0, "%d frames not freed", emul_rpu_stats.nbufs);
+	zassert_equal(emul_rpu_stats.errors, 0, "Errors logged by the driver");
+
+	for (int ac = 0; ac < NRF_WIFI_FMAC_AC_MAX; ac++) {
+		zassert_equal(sys_dev_ctx->tx_config.pend_peer_bmp[ac], 0,
+			      "Pending peers left in AC %d", ac);
+	}
+
+	printk("%u peers, %u frames in %u commands: %llu ns per frame\n",
+	       BENCH_PEERS, BENCH_FRAMES, emul_rpu_stats.cmds, elapsed_ns / BENCH_FRAMES);
+
+	emul_rpu_dev_free(fmac_dev_ctx);
+}
+
+ZTEST_SUITE(nrf71_tx_sched_benchmark, NULL, NULL, NULL, NULL, NULL);
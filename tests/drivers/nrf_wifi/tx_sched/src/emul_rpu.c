@@ -0,0 +1,596 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Emulated RPU for the TX path: the OSAL operations are implemented on the Zephyr kernel like
+ * in the driver shim, and the commands sent by the TX path are recorded instead of being passed
+ * to the firmware. The test completes them with TX done events.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/ztest.h>
+
+#include "osal_ops.h"
+#include "common/fmac_cmd_common.h"
+#include "common/fmac_util.h"
+#include "common/hal_api_common.h"
+#include "system/fmac_tx.h"
+#include "emul_rpu.h"
+
+/* Same values as the driver defaults */
+#define MAX_TX_AGGREGATION		4
+#define MAX_AMPDU_LEN_PER_TOKEN		8192
+#define MAX_PKT_RAM_TX_ALIGN_OVERHEAD	6
+
+#define MAX_OUTSTANDING_CMDS		NRF71_MAX_TX_TOKENS
+
+struct emul_nbuf {
+	unsigned char *data;
+	unsigned int len;
+	unsigned char priority;
+	unsigned char chksum_done;
+	void *raw_tx_hdr;
+	unsigned char buf[] __aligned(4);
+};
+
+struct emul_llist {
+	sys_dlist_t head;
+	unsigned int len;
+};
+
+struct emul_llist_node {
+	sys_dnode_t head;
+	void *data;
+};
+
+struct emul_rpu_stats emul_rpu_stats;
+
+static struct emul_rpu_cmd cmds[MAX_OUTSTANDING_CMDS];
+static unsigned int cmd_head;
+static unsigned int cmd_count;
+
+static void *emul_mem_zalloc(size_t size)
+{
+	return k_calloc(1, size);
+}
+
+static void *emul_mem_alloc(size_t size)
+{
+	return k_malloc(size);
+}
+
+static void emul_mem_free(void *buf)
+{
+	k_free(buf);
+}
+
+static void *emul_mem_cpy(void *dest, const void *src, size_t count)
+{
+	return memcpy(dest, src, count);
+}
+
+static void *emul_mem_set(void *start, int val, size_t size)
+{
+	return memset(start, val, size);
+}
+
+static int emul_mem_cmp(const void *addr1, const void *addr2, size_t size)
+{
+	return memcmp(addr1, addr2, size);
+}
+
+/* The test is single threaded, the locks only check that they are balanced */
+static void *emul_spinlock_alloc(void)
+{
+	return k_calloc(1, sizeof(int));
+}
+
+static void emul_spinlock_free(void *lock)
+{
+	zassert_equal(*(int *)lock, 0, "Lock freed while taken");
+	k_free(lock);
+}
+
+static void emul_spinlock_init(void *lock)
+{
+	*(int *)lock = 0;
+}
+
+static void emul_spinlock_take(void *lock)
+{
+	zassert_equal(*(int *)lock, 0, "Lock taken twice");
+	*(int *)lock = 1;
+}
+
+static void emul_spinlock_rel(void *lock)
+{
+	zassert_equal(*(int *)lock, 1, "Lock released while not taken");
+	*(int *)lock = 0;
+}
+
+static int emul_log_err(const char *fmt, va_list args)
+{
+	emul_rpu_stats.errors++;
+	vprintk(fmt, args);
+	printk("\n");
+
+	return 0;
+}
+
+static void *emul_llist_node_alloc(void)
+{
+	return k_calloc(1, sizeof(struct emul_llist_node));
+}
+
+static void emul_llist_node_free(void *node)
+{
+	k_free(node);
+}
+
+static void *emul_llist_node_data_get(void *node)
+{
+	return ((struct emul_llist_node *)node)->data;
+}
+
+static void emul_llist_node_data_set(void *node, void *data)
+{
+	((struct emul_llist_node *)node)->data = data;
+}
+
+static void *emul_llist_alloc(void)
+{
+	return k_calloc(1, sizeof(struct emul_llist));
+}
+
+static void emul_llist_free(void *llist)
+{
+	k_free(llist);
+}
+
+static void emul_llist_init(void *llist)
+{
+	struct emul_llist *list = llist;
+
+	sys_dlist_init(&list->head);
+	list->len = 0;
+}
+
+static void emul_llist_add_node_tail(void *llist, void *llist_node)
+{
+	struct emul_llist *list = llist;
+	struct emul_llist_node *node = llist_node;
+
+	sys_dlist_append(&list->head, &node->head);
+	list->len++;
+}
+
+static void emul_llist_add_node_head(void *llist, void *llist_node)
+{
+	struct emul_llist *list = llist;
+	struct emul_llist_node *node = llist_node;
+
+	sys_dlist_prepend(&list->head, &node->head);
+	list->len++;
+}
+
+static void *emul_llist_get_node_head(void *llist)
+{
+	struct emul_llist *list = llist;
+
+	return list->len ? sys_dlist_peek_head(&list->head) : NULL;
+}
+
+static void *emul_llist_get_node_nxt(void *llist, void *llist_node)
+{
+	struct emul_llist *list = llist;
+	struct emul_llist_node *node = llist_node;
+
+	return sys_dlist_peek_next(&list->head, &node->head);
+}
+
+static void emul_llist_del_node(void *llist, void *llist_node)
+{
+	struct emul_llist *list = llist;
+	struct emul_llist_node *node = llist_node;
+
+	sys_dlist_remove(&node->head);
+	list->len--;
+}
+
+static unsigned int emul_llist_len(void *llist)
+{
+	return ((struct emul_llist *)llist)->len;
+}
+
+static void emul_nbuf_free(void *nbuf)
+{
+	zassert_not_null(nbuf, "Freeing a NULL network buffer");
+	emul_rpu_stats.nbufs--;
+	k_free(nbuf);
+}
+
+static unsigned int emul_nbuf_data_size(void *nbuf)
+{
+	return ((struct emul_nbuf *)nbuf)->len;
+}
+
+static void *emul_nbuf_data_get(void *nbuf)
+{
+	return ((struct emul_nbuf *)nbuf)->data;
+}
+
+static void *emul_nbuf_data_pull(void *nbuf, unsigned int size)
+{
+	struct emul_nbuf *nwb = nbuf;
+
+	nwb->data += size;
+	nwb->len -= size;
+
+	return nwb->data;
+}
+
+static unsigned char emul_nbuf_get_priority(void *nbuf)
+{
+	return ((struct emul_nbuf *)nbuf)->priority;
+}
+
+static unsigned char emul_nbuf_get_chksum_done(void *nbuf)
+{
+	return ((struct emul_nbuf *)nbuf)->chksum_done;
+}
+
+static void *emul_nbuf_set_raw_tx_hdr(void *nbuf, unsigned short raw_hdr_len)
+{
+	struct emul_nbuf *nwb = nbuf;
+
+	nwb->raw_tx_hdr = nwb->data;
+	emul_nbuf_data_pull(nwb, raw_hdr_len);
+
+	return nwb->raw_tx_hdr;
+}
+
+static void *emul_nbuf_get_raw_tx_hdr(void *nbuf)
+{
+	return ((struct emul_nbuf *)nbuf)->raw_tx_hdr;
+}
+
+static bool emul_nbuf_is_raw_tx(void *nbuf)
+{
+	return ((struct emul_nbuf *)nbuf)->raw_tx_hdr != NULL;
+}
+
+static void emul_assert(int test_val, int val, enum nrf_wifi_assert_op_type op, char *msg)
+{
+	switch (op) {
+	case NRF_WIFI_ASSERT_EQUAL_TO:
+		zassert_equal(test_val, val, "%s", msg);
+		break;
+	case NRF_WIFI_ASSERT_NOT_EQUAL_TO:
+		zassert_not_equal(test_val, val, "%s", msg);
+		break;
+	case NRF_WIFI_ASSERT_LESS_THAN:
+		zassert_true(test_val < val, "%s", msg);
+		break;
+	case NRF_WIFI_ASSERT_LESS_THAN_EQUAL_TO:
+		zassert_true(test_val <= val, "%s", msg);
+		break;
+	case NRF_WIFI_ASSERT_GREATER_THAN:
+		zassert_true(test_val > val, "%s", msg);
+		break;
+	case NRF_WIFI_ASSERT_GREATER_THAN_EQUAL_TO:
+		zassert_true(test_val >= val, "%s", msg);
+		break;
+	default:
+		zassert_unreachable("Unknown assert operation %d", op);
+	}
+}
+
+static const struct nrf_wifi_osal_ops emul_ops = {
+	.mem_alloc = emul_mem_alloc,
+	.mem_zalloc = emul_mem_zalloc,
+	.mem_free = emul_mem_free,
+	.mem_cpy = emul_mem_cpy,
+	.mem_set = emul_mem_set,
+	.mem_cmp = emul_mem_cmp,
+
+	.spinlock_alloc = emul_spinlock_alloc,
+	.spinlock_free = emul_spinlock_free,
+	.spinlock_init = emul_spinlock_init,
+	.spinlock_take = emul_spinlock_take,
+	.spinlock_rel = emul_spinlock_rel,
+
+	.log_err = emul_log_err,
+
+	.llist_node_alloc = emul_llist_node_alloc,
+	.ctrl_llist_node_alloc = emul_llist_node_alloc,
+	.llist_node_free = emul_llist_node_free,
+	.ctrl_llist_node_free = emul_llist_node_free,
+	.llist_node_data_get = emul_llist_node_data_get,
+	.llist_node_data_set = emul_llist_node_data_set,
+	.llist_alloc = emul_llist_alloc,
+	.ctrl_llist_alloc = emul_llist_alloc,
+	.llist_free = emul_llist_free,
+	.ctrl_llist_free = emul_llist_free,
+	.llist_init = emul_llist_init,
+	.llist_add_node_tail = emul_llist_add_node_tail,
+	.llist_add_node_head = emul_llist_add_node_head,
+	.llist_get_node_head = emul_llist_get_node_head,
+	.llist_get_node_nxt = emul_llist_get_node_nxt,
+	.llist_del_node = emul_llist_del_node,
+	.llist_len = emul_llist_len,
+
+	.nbuf_free = emul_nbuf_free,
+	.nbuf_data_size = emul_nbuf_data_size,
+	.nbuf_data_get = emul_nbuf_data_get,
+	.nbuf_data_pull = emul_nbuf_data_pull,
+	.nbuf_get_priority = emul_nbuf_get_priority,
+	.nbuf_get_chksum_done = emul_nbuf_get_chksum_done,
+	.nbuf_set_raw_tx_hdr = emul_nbuf_set_raw_tx_hdr,
+	.nbuf_get_raw_tx_hdr = emul_nbuf_get_raw_tx_hdr,
+	.nbuf_is_raw_tx = emul_nbuf_is_raw_tx,
+
+	.assert = emul_assert,
+};
+
+/* Replaces the command allocation of the FMAC layer, which is not linked */
+struct host_rpu_msg *umac_cmd_alloc(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				    int type,
+				    int len)
+{
+	struct host_rpu_msg *umac_cmd;
+
+	umac_cmd = nrf_wifi_osal_mem_zalloc(sizeof(*umac_cmd) + len);
+	zassert_not_null(umac_cmd, "Failed to allocate UMAC command");
+
+	umac_cmd->type = type;
+	umac_cmd->hdr.len = sizeof(*umac_cmd) + len;
+
+	return umac_cmd;
+}
+
+/* Replaces the HAL: the command is recorded, as the RPU would do it, and freed */
+enum nrf_wifi_status nrf_wifi_hal_ctrl_cmd_send(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+						void *cmd,
+						unsigned int cmd_size)
+{
+	struct host_rpu_msg *umac_cmd = cmd;
+	struct emul_rpu_cmd *rec;
+
+	zassert_true(cmd_count < MAX_OUTSTANDING_CMDS, "More commands than TX descriptors");
+
+	rec = &cmds[(cmd_head + cmd_count) % MAX_OUTSTANDING_CMDS];
+	memset(rec, 0, sizeof(*rec));
+
+	if (umac_cmd->type == NRF_WIFI_HOST_RPU_MSG_TYPE_DATA) {
+		struct nrf_wifi_tx_buff *config = (struct nrf_wifi_tx_buff *)umac_cmd->msg;
+
+		zassert_equal(config->umac_head.cmd, NRF_WIFI_CMD_TX_BUFF);
+		rec->desc = config->tx_desc_num;
+		rec->num_frames = config->num_tx_pkts;
+		rec->if_idx = config->wdev_id;
+		rec->more_data = config->mac_hdr_info.more_data;
+	} else {
+		struct nrf_wifi_cmd_raw_tx *config = (struct nrf_wifi_cmd_raw_tx *)umac_cmd->msg;
+
+		zassert_equal(config->sys_head.cmd_event, NRF_WIFI_CMD_RAW_TX_PKT);
+		rec->raw = true;
+		rec->desc = config->raw_tx_info.desc_num;
+		rec->num_frames = config->raw_tx_info.num_frames;
+		rec->if_idx = config->if_index;
+	}
+
+	zassert_true(rec->num_frames > 0 && rec->num_frames <= MAX_TX_AGGREGATION,
+		     "Invalid number of frames %d", rec->num_frames);
+
+	cmd_count++;
+	emul_rpu_stats.cmds++;
+	emul_rpu_stats.frames += rec->num_frames;
+
+	nrf_wifi_osal_mem_free(cmd);
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+
+void emul_rpu_init(void)
+{
+	nrf_wifi_osal_init(&emul_ops);
+
+	memset(&emul_rpu_stats, 0, sizeof(emul_rpu_stats));
+	cmd_head = 0;
+	cmd_count = 0;
+}
+
+struct nrf_wifi_fmac_dev_ctx *emul_rpu_dev_alloc(void)
+{
+	struct nrf_wifi_fmac_priv *fpriv;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx;
+	struct nrf_wifi_fmac_vif_ctx *vif;
+
+	fpriv = k_calloc(1, sizeof(*fpriv) + sizeof(*sys_fpriv));
+	fmac_dev_ctx = k_calloc(1, sizeof(*fmac_dev_ctx) + sizeof(*sys_dev_ctx));
+	if (!fpriv || !fmac_dev_ctx) {
+		goto err;
+	}
+
+	/* TX configuration as set up by the driver */
+	sys_fpriv = wifi_fmac_priv(fpriv);
+	sys_fpriv->num_tx_tokens = NRF71_MAX_TX_TOKENS;
+	sys_fpriv->num_tx_tokens_per_ac = (sys_fpriv->num_tx_tokens / NRF_WIFI_FMAC_AC_MAX);
+	sys_fpriv->num_tx_tokens_spare = (sys_fpriv->num_tx_tokens % NRF_WIFI_FMAC_AC_MAX);
+	sys_fpriv->data_config.max_tx_aggregation = MAX_TX_AGGREGATION;
+	sys_fpriv->max_ampdu_len_per_token = MAX_AMPDU_LEN_PER_TOKEN;
+	sys_fpriv->avail_ampdu_len_per_token = MAX_AMPDU_LEN_PER_TOKEN -
+		(MAX_PKT_RAM_TX_ALIGN_OVERHEAD * MAX_TX_AGGREGATION);
+
+	fmac_dev_ctx->fpriv = fpriv;
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	for (int i = 0; i < MAX_NUM_VIFS; i++) {
+		vif = k_calloc(1, sizeof(*vif));
+		if (!vif) {
+			goto err;
+		}
+
+		vif->fmac_dev_ctx = fmac_dev_ctx;
+		sys_dev_ctx->vif_ctx[i] = vif;
+	}
+
+	sys_dev_ctx->vif_ctx[EMUL_RPU_VIF_AP]->if_type = NRF_WIFI_IFTYPE_AP;
+	sys_dev_ctx->vif_ctx[EMUL_RPU_VIF_INJECTOR]->if_type = NRF_WIFI_STA_TX_INJECTOR;
+
+	if (tx_init(fmac_dev_ctx) != NRF_WIFI_STATUS_SUCCESS) {
+		goto err;
+	}
+
+	return fmac_dev_ctx;
+err:
+	if (fmac_dev_ctx) {
+		sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+		for (int i = 0; i < MAX_NUM_VIFS; i++) {
+			k_free(sys_dev_ctx->vif_ctx[i]);
+		}
+	}
+
+	k_free(fmac_dev_ctx);
+	k_free(fpriv);
+
+	return NULL;
+}
+
+void emul_rpu_dev_free(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (sys_dev_ctx->tx_config.tx_lock) {
+		tx_deinit(fmac_dev_ctx);
+	}
+
+	for (int i = 0; i < MAX_NUM_VIFS; i++) {
+		k_free(sys_dev_ctx->vif_ctx[i]);
+	}
+
+	k_free(fmac_dev_ctx->fpriv);
+	k_free(fmac_dev_ctx);
+}
+
+static struct emul_nbuf *nbuf_alloc(unsigned int len)
+{
+	struct emul_nbuf *nwb;
+
+	nwb = k_calloc(1, sizeof(*nwb) + len);
+	if (!nwb) {
+		return NULL;
+	}
+
+	nwb->data = nwb->buf;
+	nwb->len = len;
+	nwb->chksum_done = 1;
+	emul_rpu_stats.nbufs++;
+
+	return nwb;
+}
+
+void *emul_rpu_nbuf_alloc(const unsigned char *dest, const unsigned char *src,
+			  unsigned char tos, unsigned int len)
+{
+	struct emul_nbuf *nwb;
+
+	if (len < NRF_WIFI_FMAC_ETH_HDR_LEN + 2) {
+		return NULL;
+	}
+
+	nwb = nbuf_alloc(len);
+	if (!nwb) {
+		return NULL;
+	}
+
+	memcpy(&nwb->data[0], dest, NRF_WIFI_ETH_ADDR_LEN);
+	memcpy(&nwb->data[NRF_WIFI_ETH_ADDR_LEN], src, NRF_WIFI_ETH_ADDR_LEN);
+	nwb->data[12] = 0x08;
+	nwb->data[13] = 0x00;
+	nwb->data[NRF_WIFI_FMAC_ETH_HDR_LEN] = 0x45;
+	nwb->data[NRF_WIFI_FMAC_ETH_HDR_LEN + 1] = tos;
+
+	return nwb;
+}
+
+void *emul_rpu_raw_nbuf_alloc(unsigned char queue, unsigned int len)
+{
+	struct raw_tx_pkt_header hdr = {
+		.magic_num = NRF_WIFI_MAGIC_NUM_RAWTX,
+		.packet_length = len,
+		.queue = queue,
+	};
+	struct emul_nbuf *nwb;
+
+	nwb = nbuf_alloc(sizeof(hdr) + len);
+	if (!nwb) {
+		return NULL;
+	}
+
+	memcpy(nwb->data, &hdr, sizeof(hdr));
+
+	return nwb;
+}
+
+unsigned int emul_rpu_outstanding(void)
+{
+	return cmd_count;
+}
+
+const struct emul_rpu_cmd *emul_rpu_cmd_get(unsigned int idx)
+{
+	if (idx >= cmd_count) {
+		return NULL;
+	}
+
+	return &cmds[(cmd_head + idx) % MAX_OUTSTANDING_CMDS];
+}
+
+bool emul_rpu_complete(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx, struct emul_rpu_cmd *cmd)
+{
+	struct emul_rpu_cmd rec;
+	enum nrf_wifi_status status;
+
+	if (!cmd_count) {
+		return false;
+	}
+
+	/* Removed before the event is processed, as processing it can send a new command */
+	rec = cmds[cmd_head];
+	cmd_head = (cmd_head + 1) % MAX_OUTSTANDING_CMDS;
+	cmd_count--;
+
+	if (rec.raw) {
+		struct nrf_wifi_event_raw_tx_done event = {
+			.sys_head.cmd_event = NRF_WIFI_EVENT_RAW_TX_DONE,
+			.desc_num = rec.desc,
+			.status = NRF_WIFI_STATUS_SUCCESS,
+		};
+
+		status = nrf_wifi_fmac_rawtx_done_event_process(fmac_dev_ctx, &event);
+	} else {
+		struct nrf_wifi_tx_buff_done event = {
+			.umac_head.cmd = NRF_WIFI_CMD_TX_BUFF_DONE,
+			.tx_desc_num = rec.desc,
+		};
+
+		status = nrf_wifi_fmac_tx_done_event_process(fmac_dev_ctx, &event);
+	}
+
+	zassert_equal(status, NRF_WIFI_STATUS_SUCCESS, "TX done processing failed");
+
+	if (cmd) {
+		*cmd = rec;
+	}
+
+	return true;
+}
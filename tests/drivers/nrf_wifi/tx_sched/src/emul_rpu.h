@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef EMUL_RPU_H_
+#define EMUL_RPU_H_
+
+#include <stdbool.h>
+
+#include "system/fmac_structs.h"
+
+/* Interfaces of the emulated device */
+#define EMUL_RPU_VIF_AP		0
+#define EMUL_RPU_VIF_INJECTOR	1
+
+/* Command sent by the TX path to the emulated RPU */
+struct emul_rpu_cmd {
+	/** Raw TX command, otherwise a data TX command. */
+	bool raw;
+	/** TX descriptor of the command. */
+	unsigned char desc;
+	/** Number of frames in the command. */
+	unsigned char num_frames;
+	/** Interface of the command. */
+	unsigned char if_idx;
+	/** More data indication of a data TX command. */
+	bool more_data;
+};
+
+struct emul_rpu_stats {
+	/** Commands sent to the emulated RPU. */
+	unsigned int cmds;
+	/** Frames sent to the emulated RPU. */
+	unsigned int frames;
+	/** Network buffers that have been allocated and not freed. */
+	int nbufs;
+	/** Errors logged by the driver. */
+	unsigned int errors;
+};
+
+extern struct emul_rpu_stats emul_rpu_stats;
+
+/**
+ * @brief Install the OSAL operations of the emulation and reset the statistics.
+ */
+void emul_rpu_init(void);
+
+/**
+ * @brief Allocate a device with an AP and a TX injector interface and initialize its TX path.
+ *
+ * @return Device context, or NULL on failure.
+ */
+struct nrf_wifi_fmac_dev_ctx *emul_rpu_dev_alloc(void);
+
+/**
+ * @brief Deinitialize the TX path of a device unless already done, and free the device.
+ *
+ * @param fmac_dev_ctx Device context.
+ */
+void emul_rpu_dev_free(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+
+/**
+ * @brief Allocate an IPv4 Ethernet frame.
+ *
+ * @param dest Destination address.
+ * @param src Source address.
+ * @param tos IPv4 type of service, which selects the access category.
+ * @param len Length of the frame.
+ *
+ * @return Network buffer, or NULL on failure.
+ */
+void *emul_rpu_nbuf_alloc(const unsigned char *dest, const unsigned char *src,
+			  unsigned char tos, unsigned int len);
+
+/**
+ * @brief Allocate a raw frame, prefixed with its raw TX header.
+ *
+ * @param queue Access category of the frame.
+ * @param len Length of the frame without the raw TX header.
+ *
+ * @return Network buffer, or NULL on failure.
+ */
+void *emul_rpu_raw_nbuf_alloc(unsigned char queue, unsigned int len);
+
+/**
+ * @brief Number of commands that the emulated RPU has not completed yet.
+ */
+unsigned int emul_rpu_outstanding(void);
+
+/**
+ * @brief Get a command that the emulated RPU has not completed yet.
+ *
+ * @param idx Index of the command, 0 being the oldest.
+ *
+ * @return The command, or NULL if there is no such command.
+ */
+const struct emul_rpu_cmd *emul_rpu_cmd_get(unsigned int idx);
+
+/**
+ * @brief Complete the oldest outstanding command with a TX done event.
+ *
+ * The event is processed by the driver before returning, which can send new commands.
+ *
+ * @param fmac_dev_ctx Device context.
+ * @param[out] cmd Completed command, can be NULL.
+ *
+ * @return true if a command was completed, false if none was outstanding.
+ */
+bool emul_rpu_complete(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx, struct emul_rpu_cmd *cmd);
+
+#endif /* EMUL_RPU_H_ */
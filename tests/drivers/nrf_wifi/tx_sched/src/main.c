@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+
+/* tx.c is included to reach the scheduler internals */
+#include "tx.c"
+
+#include "emul_rpu.h"
+
+#define TEST_PEERS	3
+#define FRAME_LEN	256
+
+static const unsigned char ap_addr[NRF_WIFI_ETH_ADDR_LEN] = {0x02, 0x00, 0x00, 0x00, 0x00, 0xaa};
+static const unsigned char bcast_addr[NRF_WIFI_ETH_ADDR_LEN] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+static const unsigned char peer_addr[TEST_PEERS][NRF_WIFI_ETH_ADDR_LEN] = {
+	{0x02, 0x00, 0x00, 0x00, 0x00, 0x01},
+	{0x02, 0x00, 0x00, 0x00, 0x00, 0x02},
+	{0x02, 0x00, 0x00, 0x00, 0x00, 0x03},
+};
+
+static struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx;
+static struct tx_config *tx_cfg;
+
+/* A bit must be set exactly for the pending queues that hold frames */
+static void assert_pend_peer_bmp_in_sync(void)
+{
+	for (int ac = 0; ac < NRF_WIFI_FMAC_AC_MAX; ac++) {
+		for (int peer = 0; peer < MAX_SW_PEERS; peer++) {
+			bool pending = nrf_wifi_utils_q_len(tx_cfg->data_pending_txq[peer][ac]) > 0;
+			bool bit = tx_cfg->pend_peer_bmp[ac] & BIT(peer);
+
+			zassert_equal(pending, bit, "Bitmap out of sync for peer %d, AC %d",
+				      peer, ac);
+		}
+	}
+}
+
+static void enqueue(int peer, unsigned int ac, int count)
+{
+	for (int i = 0; i < count; i++) {
+		void *nwb = emul_rpu_nbuf_alloc(peer_addr[peer], ap_addr, 0, FRAME_LEN);
+
+		zassert_not_null(nwb);
+		zassert_equal(tx_enqueue(fmac_dev_ctx, nwb, ac, peer), NRF_WIFI_STATUS_SUCCESS);
+	}
+
+	assert_pend_peer_bmp_in_sync();
+}
+
+static void enqueue_raw(unsigned int ac)
+{
+	void *nwb = emul_rpu_raw_nbuf_alloc(ac, FRAME_LEN);
+
+	zassert_not_null(nwb);
+	zassert_not_null(nrf_wifi_osal_nbuf_set_raw_tx_hdr(nwb, sizeof(struct raw_tx_pkt_header)));
+	zassert_equal(tx_enqueue(fmac_dev_ctx, nwb, ac, MAX_PEERS), NRF_WIFI_STATUS_SUCCESS);
+
+	assert_pend_peer_bmp_in_sync();
+}
+
+/* Send the pending frames of an AC on a new descriptor, like the TX path does */
+static void pending_send(unsigned int ac)
+{
+	unsigned int desc = tx_desc_get(fmac_dev_ctx, ac);
+
+	zassert_not_equal(desc, NRF71_MAX_TX_TOKENS, "No free descriptor");
+	zassert_equal(tx_pending_process(fmac_dev_ctx, desc, ac), NRF_WIFI_STATUS_SUCCESS);
+
+	assert_pend_peer_bmp_in_sync();
+}
+
+static void complete(struct emul_rpu_cmd *cmd)
+{
+	zassert_true(emul_rpu_complete(fmac_dev_ctx, cmd), "No outstanding command");
+
+	assert_pend_peer_bmp_in_sync();
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	emul_rpu_init();
+
+	fmac_dev_ctx = emul_rpu_dev_alloc();
+	zassert_not_null(fmac_dev_ctx, "Failed to allocate the device");
+	tx_cfg = &((struct nrf_wifi_sys_fmac_dev_ctx *)wifi_dev_priv(fmac_dev_ctx))->tx_config;
+
+	for (int i = 0; i < TEST_PEERS; i++) {
+		zassert_equal(nrf_wifi_fmac_peer_add(fmac_dev_ctx, EMUL_RPU_VIF_AP, peer_addr[i],
+						     0, 1), i);
+	}
+}
+
+static void test_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	while (emul_rpu_complete(fmac_dev_ctx, NULL)) {
+	}
+
+	emul_rpu_dev_free(fmac_dev_ctx);
+
+	zassert_equal(emul_rpu_stats.nbufs, 0, "%d network buffers leaked", emul_rpu_stats.nbufs);
+	zassert_equal(emul_rpu_stats.errors, 0, "Errors logged by the driver");
+}
+
+ZTEST(nrf71_tx_sched, test_enqueue_sets_bit)
+{
+	void *nwb;
+
+	enqueue(1, NRF_WIFI_FMAC_AC_BE, 1);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_BE], BIT(1));
+
+	enqueue(2, NRF_WIFI_FMAC_AC_VO, 1);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_BE], BIT(1));
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_VO], BIT(2));
+
+	/* A frame rejected by a full queue leaves the bitmap as it is */
+	enqueue(1, NRF_WIFI_FMAC_AC_BE, NRF71_MAX_TX_PENDING_QLEN - 1);
+
+	nwb = emul_rpu_nbuf_alloc(peer_addr[1], ap_addr, 0, FRAME_LEN);
+	zassert_not_equal(tx_enqueue(fmac_dev_ctx, nwb, NRF_WIFI_FMAC_AC_BE, 1),
+			  NRF_WIFI_STATUS_SUCCESS);
+	nrf_wifi_osal_nbuf_free(nwb);
+
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_BE], BIT(1));
+	assert_pend_peer_bmp_in_sync();
+}
+
+ZTEST(nrf71_tx_sched, test_pending_process_clears_bit)
+{
+	struct emul_rpu_cmd cmd;
+	const struct emul_rpu_cmd *sent;
+
+	enqueue(0, NRF_WIFI_FMAC_AC_BE, 6);
+	enqueue(1, NRF_WIFI_FMAC_AC_BE, 1);
+
+	/* An aggregate of peer 0 leaves frames in its queue */
+	pending_send(NRF_WIFI_FMAC_AC_BE);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_BE], BIT(0) | BIT(1));
+
+	sent = emul_rpu_cmd_get(0);
+	zassert_not_null(sent);
+	zassert_equal(sent->num_frames, 4);
+	zassert_true(sent->more_data, "More data not indicated to peer 0");
+
+	/* Peer 1 gets the next opportunity and its queue is emptied */
+	pending_send(NRF_WIFI_FMAC_AC_BE);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_BE], BIT(0));
+
+	sent = emul_rpu_cmd_get(1);
+	zassert_not_null(sent);
+	zassert_equal(sent->num_frames, 1);
+	zassert_false(sent->more_data, "More data indicated to peer 1");
+
+	/* The descriptor of the first aggregate is reused for the rest of peer 0 frames */
+	complete(&cmd);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_BE], 0);
+
+	sent = emul_rpu_cmd_get(1);
+	zassert_not_null(sent);
+	zassert_equal(sent->desc, cmd.desc);
+	zassert_equal(sent->num_frames, 2);
+	zassert_false(sent->more_data, "More data indicated for the last frames of peer 0");
+
+	complete(NULL);
+	complete(NULL);
+	zassert_equal(emul_rpu_outstanding(), 0);
+	zassert_equal(emul_rpu_stats.frames, 7);
+	zassert_equal(emul_rpu_stats.nbufs, 0);
+}
+
+ZTEST(nrf71_tx_sched, test_more_data_other_ac)
+{
+	const struct emul_rpu_cmd *sent;
+
+	enqueue(0, NRF_WIFI_FMAC_AC_BE, 1);
+	enqueue(0, NRF_WIFI_FMAC_AC_VO, 1);
+
+	pending_send(NRF_WIFI_FMAC_AC_BE);
+
+	sent = emul_rpu_cmd_get(0);
+	zassert_not_null(sent);
+	zassert_true(sent->more_data, "Frames of another AC not indicated");
+
+	pending_send(NRF_WIFI_FMAC_AC_VO);
+
+	sent = emul_rpu_cmd_get(1);
+	zassert_not_null(sent);
+	zassert_false(sent->more_data, "More data indicated without pending frames");
+}
+
+ZTEST(nrf71_tx_sched, test_round_robin_skips_ps_peer)
+{
+	struct peers_info *ps_peer = &tx_cfg->peers[1];
+
+	for (int peer = 0; peer < TEST_PEERS; peer++) {
+		enqueue(peer, NRF_WIFI_FMAC_AC_VI, 1);
+	}
+
+	ps_peer->ps_state = NRF_WIFI_CLIENT_PS_MODE;
+
+	for (int i = 0; i < 2; i++) {
+		zassert_equal(tx_curr_peer_opp_get(fmac_dev_ctx, NRF_WIFI_FMAC_AC_VI), 0);
+		zassert_equal(tx_curr_peer_opp_get(fmac_dev_ctx, NRF_WIFI_FMAC_AC_VI), 2);
+	}
+
+	/* A peer that wakes up gets the opportunities it has tokens for */
+	ps_peer->ps_token_count = 1;
+	nrf_wifi_utils_q_enqueue(tx_cfg->wakeup_client_q, ps_peer);
+
+	zassert_equal(tx_curr_peer_opp_get(fmac_dev_ctx, NRF_WIFI_FMAC_AC_VI), 1);
+	zassert_equal(ps_peer->ps_token_count, 0);
+	zassert_equal(tx_curr_peer_opp_get(fmac_dev_ctx, NRF_WIFI_FMAC_AC_VI), 0);
+
+	nrf_wifi_utils_list_del_node(tx_cfg->wakeup_client_q, ps_peer);
+
+	/* Frames of the sleeping peer are kept, and so is its bit */
+	pending_send(NRF_WIFI_FMAC_AC_VI);
+	pending_send(NRF_WIFI_FMAC_AC_VI);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_VI], BIT(1));
+
+	complete(NULL);
+	complete(NULL);
+	zassert_equal(emul_rpu_outstanding(), 0);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_VI], BIT(1));
+	zassert_equal(tx_curr_peer_opp_get(fmac_dev_ctx, NRF_WIFI_FMAC_AC_VI), -1);
+}
+
+ZTEST(nrf71_tx_sched, test_raw_queue)
+{
+	struct emul_rpu_cmd cmd;
+	const struct emul_rpu_cmd *sent;
+	void *nwb;
+
+	/* As configured when the raw TX mode is set on the interface */
+	tx_cfg->peers[MAX_PEERS].peer_id = MAX_PEERS;
+	tx_cfg->peers[MAX_PEERS].if_idx = EMUL_RPU_VIF_INJECTOR;
+
+	enqueue(0, NRF_WIFI_FMAC_AC_BE, 1);
+	enqueue_raw(NRF_WIFI_FMAC_AC_BE);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_BE], BIT(0) | BIT(MAX_PEERS));
+
+	/* The raw queue is not a peer of the round robin */
+	zassert_equal(tx_curr_peer_opp_get(fmac_dev_ctx, NRF_WIFI_FMAC_AC_BE), 0);
+	zassert_equal(tx_curr_peer_opp_get(fmac_dev_ctx, NRF_WIFI_FMAC_AC_BE), 0);
+
+	/* Raw frames are sent first, and freed once sent */
+	pending_send(NRF_WIFI_FMAC_AC_BE);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_BE], BIT(0));
+	zassert_equal(emul_rpu_stats.nbufs, 1);
+
+	sent = emul_rpu_cmd_get(0);
+	zassert_not_null(sent);
+	zassert_true(sent->raw);
+	zassert_equal(sent->num_frames, 1);
+	zassert_equal(sent->if_idx, EMUL_RPU_VIF_INJECTOR);
+
+	/* The data frame is sent on the descriptor released by the raw TX done event */
+	complete(&cmd);
+	zassert_true(cmd.raw);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_BE], 0);
+
+	sent = emul_rpu_cmd_get(0);
+	zassert_not_null(sent);
+	zassert_false(sent->raw);
+	zassert_equal(sent->desc, cmd.desc);
+	zassert_equal(sent->if_idx, EMUL_RPU_VIF_AP);
+
+	complete(NULL);
+
+	/* Raw frames from the stack take the same queue */
+	nwb = emul_rpu_raw_nbuf_alloc(NRF_WIFI_FMAC_AC_VO, FRAME_LEN);
+	zassert_not_null(nwb);
+	zassert_equal(nrf_wifi_fmac_start_rawpkt_xmit(fmac_dev_ctx, EMUL_RPU_VIF_INJECTOR, nwb),
+		      NRF_WIFI_STATUS_SUCCESS);
+	assert_pend_peer_bmp_in_sync();
+
+	sent = emul_rpu_cmd_get(0);
+	zassert_not_null(sent);
+	zassert_true(sent->raw);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_VO], 0);
+
+	complete(NULL);
+	zassert_equal(emul_rpu_stats.nbufs, 0);
+}
+
+ZTEST(nrf71_tx_sched, test_multicast_queue)
+{
+	void *nwb;
+
+	zassert_equal(nrf_wifi_fmac_peer_add(fmac_dev_ctx, EMUL_RPU_VIF_AP, bcast_addr, 1, 0),
+		      MAX_PEERS);
+
+	nwb = emul_rpu_nbuf_alloc(bcast_addr, ap_addr, 0, FRAME_LEN);
+	zassert_not_null(nwb);
+	zassert_equal(tx_enqueue(fmac_dev_ctx, nwb, NRF_WIFI_FMAC_AC_MC, MAX_PEERS),
+		      NRF_WIFI_STATUS_SUCCESS);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_MC], BIT(MAX_PEERS));
+	assert_pend_peer_bmp_in_sync();
+
+	zassert_equal(tx_curr_peer_opp_get(fmac_dev_ctx, NRF_WIFI_FMAC_AC_MC), MAX_PEERS);
+
+	pending_send(NRF_WIFI_FMAC_AC_MC);
+	zassert_equal(tx_cfg->pend_peer_bmp[NRF_WIFI_FMAC_AC_MC], 0);
+	zassert_equal(emul_rpu_outstanding(), 1);
+}
+
+ZTEST(nrf71_tx_sched, test_deinit_clears_bitmap)
+{
+	tx_cfg->peers[MAX_PEERS].peer_id = MAX_PEERS;
+	tx_cfg->peers[MAX_PEERS].if_idx = EMUL_RPU_VIF_INJECTOR;
+
+	enqueue(0, NRF_WIFI_FMAC_AC_BE, 6);
+	enqueue(1, NRF_WIFI_FMAC_AC_VI, 2);
+	enqueue(2, NRF_WIFI_FMAC_AC_BK, 1);
+	enqueue_raw(NRF_WIFI_FMAC_AC_VO);
+
+	/* Frames in flight are freed as well */
+	pending_send(NRF_WIFI_FMAC_AC_BE);
+	zassert_equal(emul_rpu_outstanding(), 1);
+
+	tx_deinit(fmac_dev_ctx);
+
+	for (int ac = 0; ac < NRF_WIFI_FMAC_AC_MAX; ac++) {
+		zassert_equal(tx_cfg->pend_peer_bmp[ac], 0, "Bitmap of AC %d not cleared", ac);
+	}
+
+	zassert_equal(emul_rpu_stats.nbufs, 0, "Frames not freed");
+
+	/* A TX done event received during deinit is ignored */
+	zassert_true(emul_rpu_complete(fmac_dev_ctx, NULL));
+}
+
+ZTEST_SUITE(nrf71_tx_sched, NULL, NULL, test_before, test_after, NULL);
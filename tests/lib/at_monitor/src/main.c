@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <nrf_modem_at.h>
+#include <modem/at_monitor.h>
+
+#define DISPATCH_TIMEOUT	K_SECONDS(1)
+/* More than half of the AT monitor heap, so that a leaked copy of a notification of this
+ * length leaves no room for the next one.
+ */
+#define LARGE_NOTIF_LEN		(CONFIG_AT_MONITOR_HEAP_SIZE / 2 + 16)
+#define LARGE_NOTIF_ROUNDS	8
+
+/* Implemented in the AT monitor library */
+extern void at_monitor_dispatch(const char *notif);
+
+static const char *received_notif;
+static int refs_to_take;
+static char large_notif[LARGE_NOTIF_LEN + 1];
+
+K_SEM_DEFINE(dispatched_sem, 0, 1);
+
+AT_MONITOR(test_monitor, "%TEST", test_monitor_handler);
+
+static void test_monitor_handler(const char *notif)
+{
+	received_notif = notif;
+
+	for (; refs_to_take > 0; refs_to_take--) {
+		at_monitor_notif_ref(notif);
+	}
+
+	k_sem_give(&dispatched_sem);
+}
+
+int nrf_modem_at_notif_handler_set(nrf_modem_at_notif_handler_t callback)
+{
+	return 0;
+}
+
+static void notif_dispatch(const char *notif)
+{
+	at_monitor_dispatch(notif);
+	zassert_ok(k_sem_take(&dispatched_sem, DISPATCH_TIMEOUT), "Notification not dispatched");
+
+	/* The workqueue releases its reference when all the monitors have been dispatched */
+	k_sleep(K_MSEC(1));
+}
+
+static void large_notif_dispatch(char c)
+{
+	memset(large_notif, c, sizeof(large_notif) - 1);
+	memcpy(large_notif, "%TEST: ", strlen("%TEST: "));
+
+	notif_dispatch(large_notif);
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	received_notif = NULL;
+	refs_to_take = 0;
+	k_sem_reset(&dispatched_sem);
+}
+
+ZTEST(at_monitor, test_notif_ref_keeps_notification)
+{
+	const char *held;
+
+	refs_to_take = 1;
+	notif_dispatch("%TEST: 1\r\n");
+	held = received_notif;
+
+	/* The notification is not released by the workqueue while it is referenced */
+	notif_dispatch("%TEST: 2\r\n");
+	zassert_not_equal(received_notif, held, "Referenced notification was reused");
+	zassert_str_equal(held, "%TEST: 1\r\n", "Referenced notification was overwritten");
+
+	at_monitor_notif_unref(held);
+}
+
+ZTEST(at_monitor, test_notif_ref_multiple)
+{
+	const char *held;
+
+	refs_to_take = 2;
+	notif_dispatch("%TEST: 1\r\n");
+	held = received_notif;
+
+	/* One reference is still held */
+	at_monitor_notif_unref(held);
+	notif_dispatch("%TEST: 2\r\n");
+	zassert_not_equal(received_notif, held, "Referenced notification was reused");
+	zassert_str_equal(held, "%TEST: 1\r\n", "Referenced notification was overwritten");
+
+	at_monitor_notif_unref(held);
+
+	/* The notification has been freed with the last reference */
+	large_notif_dispatch('a');
+}
+
+ZTEST(at_monitor, test_notif_unref_frees)
+{
+	/* Each notification only fits in the heap if the previous one has been freed */
+	for (int i = 0; i < LARGE_NOTIF_ROUNDS; i++) {
+		refs_to_take = 1;
+		large_notif_dispatch('a' + i);
+		zassert_str_equal(received_notif, large_notif, "Unexpected notification");
+
+		at_monitor_notif_unref(received_notif);
+	}
+}
+
+ZTEST(at_monitor, test_notif_not_referenced)
+{
+	/* Without references, the workqueue frees the notification after the dispatch */
+	for (int i = 0; i < LARGE_NOTIF_ROUNDS; i++) {
+		large_notif_dispatch('a' + i);
+	}
+}
+
+ZTEST_SUITE(at_monitor, NULL, NULL, test_before, NULL, NULL);
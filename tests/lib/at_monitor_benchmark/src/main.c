@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <nrf_modem_at.h>
+#include <modem/at_monitor.h>
+
+#include "host_clock.h"
+
+#define REPLAY_COUNT		50
+#define DISPATCH_TIMEOUT	K_SECONDS(1)
+
+/* Implemented in the AT monitor library */
+extern void at_monitor_dispatch(const char *notif);
+
+/* Notifications recorded from an nRF91 Series device attaching to the network, moving
+ * between cells and going to sleep.
+ */
+static const char *const urc_stream[] = {
+	"%MDMEV: SEARCH STATUS 1\r\n",
+	"+CSCON: 1\r\n",
+	"+CEREG: 2,\"76C1\",\"0102DA04\",7\r\n",
+	"+CGEV: ME PDN ACT 0\r\n",
+	"+CEREG: 1,\"76C1\",\"0102DA04\",7,,,\"00001010\",\"11000001\"\r\n",
+	"%XTIME: \"40\",\"62013142315540\",\"01\"\r\n",
+	"%CESQ: 54,2,26,3\r\n",
+	"+CEDRXP: 4,\"1000\",\"0101\",\"1011\"\r\n",
+	"%RAI: \"0012BEEF\",\"310\",\"410\",\"01\",\"0001\",1,1\r\n",
+	"%NCELLMEAS: 0,\"0199F10A\",\"310410\",\"76C1\",64,5300,194,49,15,44825,"
+	"5300,6,46,18,1,5300,194,48,14,2,1500,37,39,7,3\r\n",
+	"%XMODEMSLEEP: 1,1000000\r\n",
+	"+CSCON: 0\r\n",
+	"%XT3412: 1200000\r\n",
+	"%MDMEV: ME BATTERY LOW\r\n",
+	"+CEREG: 5,\"76C2\",\"0102DA05\",9,,,\"00001010\",\"11000001\"\r\n",
+	"+CMT: \"+4712345678\",22\r\n0791448720003023240DD0\r\n",
+	"+CDS: 24\r\n06D1910DC8A8AE5B91D8AAA27F3E\r\n",
+};
+
+/* Monitors of the libraries that are typically enabled in an nRF91 Series application */
+#define MONITORS(X)						\
+	X(lte_cereg, "+CEREG")					\
+	X(lte_cscon, "+CSCON")					\
+	X(lte_cedrxp, "+CEDRXP")				\
+	X(lte_rai, "%RAI")					\
+	X(lte_mdmev, "%MDMEV")					\
+	X(lte_ncellmeas, "%NCELLMEAS")				\
+	X(lte_xmodemsleep, "%XMODEMSLEEP")			\
+	X(lte_xt3412, "%XT3412")				\
+	X(lte_enveval, "%ENVEVAL")				\
+	X(lte_cellularprfl, "%CELLULARPRFL")			\
+	X(pdn_cgev, "+CGEV")					\
+	X(pdn_cnec_esm, "+CNEC_ESM")				\
+	X(modem_info_cesq, "%CESQ")				\
+	X(date_time_xtime, "%XTIME")				\
+	X(battery_pofwarn, "%MDMEV: ME BATTERY LOW")		\
+	X(battery_xvbatlowlvl, "%XVBATLOWLVL")			\
+	X(provisioning_cgev, "CGEV")				\
+	X(app_cereg, "CEREG")					\
+	X(wildcard, ANY)
+
+#define ISR_MONITORS(X)						\
+	X(sms_cmt, "+CMT")					\
+	X(sms_cds, "+CDS")					\
+	X(sms_cms, "+CMS")
+
+#define MONITOR_ID(name, filter) MON_##name,
+#define MONITOR_FILTER(name, filter) filter,
+#define MONITOR_DEFINE(name, filter)					\
+	AT_MONITOR(name, filter, name##_handler);			\
+	static void name##_handler(const char *notif)			\
+	{								\
+		monitor_notified(MON_##name, notif);			\
+	}
+#define ISR_MONITOR_DEFINE(name, filter)				\
+	AT_MONITOR_ISR(name, filter, name##_handler);			\
+	static void name##_handler(const char *notif)			\
+	{								\
+		monitor_notified(MON_##name, notif);			\
+	}
+
+enum monitor_id {
+	MONITORS(MONITOR_ID)
+	ISR_MONITORS(MONITOR_ID)
+	MON_COUNT,
+};
+
+static const char *const filters[] = {
+	MONITORS(MONITOR_FILTER)
+	ISR_MONITORS(MONITOR_FILTER)
+};
+
+static uint32_t notified[MON_COUNT];
+static uint32_t expected[MON_COUNT];
+static const char *held_notif;
+static bool hold_next;
+
+K_SEM_DEFINE(dispatched_sem, 0, 1);
+
+static void monitor_notified(enum monitor_id id, const char *notif)
+{
+	notified[id]++;
+
+	if (id == MON_wildcard) {
+		/* Monitors are dispatched in name order, the wildcard monitor is the last one */
+		if (hold_next) {
+			at_monitor_notif_ref(notif);
+			held_notif = notif;
+			hold_next = false;
+		}
+		k_sem_give(&dispatched_sem);
+	}
+}
+
+MONITORS(MONITOR_DEFINE)
+ISR_MONITORS(ISR_MONITOR_DEFINE)
+
+AT_MONITOR(paused_cereg, "+CEREG", paused_cereg_handler, PAUSED);
+
+static void paused_cereg_handler(const char *notif)
+{
+	ztest_test_fail();
+}
+
+int nrf_modem_at_notif_handler_set(nrf_modem_at_notif_handler_t callback)
+{
+	return 0;
+}
+
+static void expected_count(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(urc_stream); i++) {
+		for (size_t m = 0; m < MON_COUNT; m++) {
+			if (filters[m] == ANY || strstr(urc_stream[i], filters[m])) {
+				expected[m]++;
+			}
+		}
+	}
+}
+
+static void urc_dispatch(const char *notif)
+{
+	at_monitor_dispatch(notif);
+	zassert_ok(k_sem_take(&dispatched_sem, DISPATCH_TIMEOUT), "Notification not dispatched");
+}
+
+static void *suite_setup(void)
+{
+	expected_count();
+
+	return NULL;
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(notified, 0, sizeof(notified));
+	k_sem_reset(&dispatched_sem);
+}
+
+ZTEST(at_monitor_benchmark, test_dispatch_matches_filters)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(urc_stream); i++) {
+		urc_dispatch(urc_stream[i]);
+	}
+
+	for (size_t m = 0; m < MON_COUNT; m++) {
+		zassert_equal(notified[m], expected[m], "Monitor %zu (%s): %u notifications, "
+			      "expected %u", m, filters[m] ? filters[m] : "ANY", notified[m],
+			      expected[m]);
+	}
+}
+
+ZTEST(at_monitor_benchmark, test_notif_ref)
+{
+	char copy[64];
+
+	hold_next = true;
+	urc_dispatch(urc_stream[2]);
+
+	zassert_not_null(held_notif, "Notification not referenced");
+	strcpy(copy, held_notif);
+
+	/* The heap space is not reused while the notification is referenced */
+	urc_dispatch(urc_stream[4]);
+	zassert_str_equal(held_notif, copy, "Referenced notification was overwritten");
+
+	at_monitor_notif_unref(held_notif);
+	held_notif = NULL;
+}
+
+/* The matching done by the AT monitor library before the prefix index */
+static void strstr_dispatch(const char *notif)
+{
+	volatile uint32_t matches = 0;
+
+	/* Once for the ISR monitors, once more in the workqueue for the deferred monitors */
+	for (int pass = 0; pass < 2; pass++) {
+		for (size_t m = 0; m < MON_COUNT; m++) {
+			if (filters[m] == ANY || strstr(notif, filters[m])) {
+				matches++;
+			}
+		}
+	}
+}
+
+ZTEST(at_monitor_benchmark, test_replay_throughput)
+{
+	uint64_t start;
+	uint64_t dispatch_ns;
+	uint64_t strstr_ns;
+	uint32_t urc_count = REPLAY_COUNT * ARRAY_SIZE(urc_stream);
+
+	start = host_clock_ns();
+	for (int r = 0; r < REPLAY_COUNT; r++) {
+		for (size_t i = 0; i < ARRAY_SIZE(urc_stream); i++) {
+			urc_dispatch(urc_stream[i]);
+		}
+	}
+	dispatch_ns = host_clock_ns() - start;
+
+	start = host_clock_ns();
+	for (int r = 0; r < REPLAY_COUNT; r++) {
+		for (size_t i = 0; i < ARRAY_SIZE(urc_stream); i++) {
+			strstr_dispatch(urc_stream[i]);
+		}
+	}
+	strstr_ns = host_clock_ns() - start;
+
+	for (size_t m = 0; m < MON_COUNT; m++) {
+		zassert_equal(notified[m], REPLAY_COUNT * expected[m],
+			      "Monitor %zu: unexpected notification count %u", m, notified[m]);
+	}
+
+	printk("%u monitors, %u notifications: %llu ns per notification dispatched, "
+	       "%llu ns per notification for strstr matching alone\n",
+	       MON_COUNT + 1, urc_count, dispatch_ns / urc_count, strstr_ns / urc_count);
+}
+
+ZTEST_SUITE(at_monitor_benchmark, NULL, suite_setup, test_before, NULL, NULL);
@@ -20,6 +20,9 @@
 #include "cmock_nrf_modem_at.h"
 #include "cmock_socket.h"
 #include "cmock_sntp.h"
+#if defined(CONFIG_DATE_TIME_DRIFT)
+#include "date_time_drift.h"
+#endif
 
 /* NOTE: These tests run for few tens of seconds because we are waiting for the
  * date-time update and retry intervals.
@@ -115,6 +118,10 @@ void setUp(void)
 	test_date_time_cb_data[0].uptime_start = k_uptime_get();
 
 	date_time_register_handler(date_time_callback);
+
+#if defined(CONFIG_DATE_TIME_DRIFT)
+	date_time_drift_reset();
+#endif
 }
 
 void tearDown(void)
@@ -1037,6 +1044,119 @@ void test_date_time_xtime_notif_fail(void)
 	k_sleep(K_MSEC(1));
 }
 
+#if defined(CONFIG_DATE_TIME_DRIFT)
+/* Local clock runs fast by 40 ppm compared to the time sources */
+#define DRIFT_TEST_SKEW_PPM 40
+/* Time sources report the time with up to 200 ms of error */
+#define DRIFT_TEST_JITTER_MS 200
+#define DRIFT_TEST_INTERVAL_MS (4 * 3600 * MSEC_PER_SEC)
+#define DRIFT_TEST_DURATION_MS (30 * 24 * 3600LL * MSEC_PER_SEC)
+
+static uint32_t drift_test_rand_state;
+
+/* Time obtained from a time source at the given uptime */
+static int64_t drift_test_time_source(int64_t uptime_ms)
+{
+	int32_t jitter_ms;
+
+	drift_test_rand_state = drift_test_rand_state * 1103515245 + 12345;
+	jitter_ms = (int32_t)((drift_test_rand_state >> 8) % (2 * DRIFT_TEST_JITTER_MS + 1)) -
+		    DRIFT_TEST_JITTER_MS;
+
+	return date_time_global_unix + uptime_ms - uptime_ms * DRIFT_TEST_SKEW_PPM / 1000000 +
+	       jitter_ms;
+}
+#endif
+
+/**
+ * Test that the skew of the local clock is estimated from the time updates, and that the update
+ * interval is backed off while the error of the compensated time stays within the bound.
+ */
+void test_date_time_drift_compensation(void)
+{
+#if !defined(CONFIG_DATE_TIME_DRIFT)
+	TEST_IGNORE();
+#else
+	int64_t uptime_ms = MSEC_PER_SEC;
+	int64_t sample_uptime_ms;
+	int64_t sample_time_ms;
+	int64_t error_ms;
+	int64_t max_error_ms = 0;
+	int updates = 0;
+
+	drift_test_rand_state = 1;
+
+	/* Time updates at a fixed interval */
+	for (int i = 0; i < CONFIG_DATE_TIME_DRIFT_SAMPLES; i++) {
+		sample_uptime_ms = uptime_ms;
+		sample_time_ms = drift_test_time_source(uptime_ms);
+		date_time_drift_sample(sample_uptime_ms, sample_time_ms);
+		uptime_ms += DRIFT_TEST_INTERVAL_MS;
+	}
+
+	TEST_ASSERT_INT32_WITHIN(5000, -DRIFT_TEST_SKEW_PPM * 1000, date_time_drift_skew_ppb());
+	TEST_ASSERT_GREATER_THAN(CONFIG_DATE_TIME_UPDATE_INTERVAL_SECONDS,
+				 date_time_drift_interval());
+
+	/* Time updates at the interval given by the library. Just before each update, compare
+	 * the compensated time to the time from the time source.
+	 */
+	while (sample_uptime_ms < DRIFT_TEST_DURATION_MS) {
+		int64_t time_ms;
+
+		uptime_ms = sample_uptime_ms + date_time_drift_interval() * MSEC_PER_SEC;
+		time_ms = drift_test_time_source(uptime_ms);
+
+		error_ms = time_ms - (sample_time_ms + (uptime_ms - sample_uptime_ms) +
+				      date_time_drift_correction(uptime_ms));
+		max_error_ms = MAX(max_error_ms, llabs(error_ms));
+
+		date_time_drift_sample(uptime_ms, time_ms);
+		sample_uptime_ms = uptime_ms;
+		sample_time_ms = time_ms;
+		updates++;
+	}
+
+	printk("%d time updates in %lld days, maximum error %lld ms\n",
+	       updates, DRIFT_TEST_DURATION_MS / (24 * 3600 * MSEC_PER_SEC), max_error_ms);
+
+	TEST_ASSERT_LESS_THAN(CONFIG_DATE_TIME_DRIFT_MAX_ERROR_MS, max_error_ms);
+	TEST_ASSERT_EQUAL(CONFIG_DATE_TIME_DRIFT_MAX_INTERVAL_SECONDS, date_time_drift_interval());
+	TEST_ASSERT_LESS_THAN(DRIFT_TEST_DURATION_MS / DRIFT_TEST_INTERVAL_MS, updates);
+#endif
+}
+
+/**
+ * Test that a time update far from the compensated time restarts the estimation, but the skew
+ * estimate is still used.
+ */
+void test_date_time_drift_time_changed(void)
+{
+#if !defined(CONFIG_DATE_TIME_DRIFT)
+	TEST_IGNORE();
+#else
+	int64_t uptime_ms = MSEC_PER_SEC;
+
+	drift_test_rand_state = 1;
+
+	for (int i = 0; i < CONFIG_DATE_TIME_DRIFT_SAMPLES; i++) {
+		date_time_drift_sample(uptime_ms, drift_test_time_source(uptime_ms));
+		uptime_ms += DRIFT_TEST_INTERVAL_MS;
+	}
+
+	TEST_ASSERT_GREATER_THAN(CONFIG_DATE_TIME_UPDATE_INTERVAL_SECONDS,
+				 date_time_drift_interval());
+
+	/* Time is set an hour ahead */
+	date_time_drift_sample(uptime_ms, drift_test_time_source(uptime_ms) + 3600 * MSEC_PER_SEC);
+
+	TEST_ASSERT_EQUAL(CONFIG_DATE_TIME_UPDATE_INTERVAL_SECONDS, date_time_drift_interval());
+	TEST_ASSERT_EQUAL(0, date_time_drift_correction(uptime_ms));
+	TEST_ASSERT_INT64_WITHIN(20, -DRIFT_TEST_SKEW_PPM * 3600 / 1000,
+				 date_time_drift_correction(uptime_ms + 3600 * MSEC_PER_SEC));
+#endif
+}
+
 /* This is needed because AT Monitor library is initialized in SYS_INIT. */
 static int date_time_test_sys_init(void)
 {
@@ -1992,6 +1992,156 @@ void test_location_request_mode_all_cellular_error_gnss_timeout(void)
 	k_sleep(K_MSEC(1));
 }
 
+/* Test location request with LOCATION_REQ_MODE_CONCURRENT:
+ * - Wi-Fi scan is started at the same time as GNSS
+ * - GNSS times out and fallback to Wi-Fi occurs
+ * - Cloud location request is sent without a new Wi-Fi scan
+ */
+void test_location_request_mode_concurrent_gnss_timeout_wifi(void)
+{
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+#if defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	int err;
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_GNSS, LOCATION_METHOD_WIFI};
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+	config.methods[0].gnss.timeout = 100;
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_STARTED;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_GNSS;
+	location_cb_expected++;
+
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_FALLBACK;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_GNSS;
+	location_cb_expected++;
+#endif
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_WIFI;
+	location_cb_expected++;
+
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_LOCATION;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_WIFI;
+	test_location_event_data[location_cb_expected].location.latitude = 51.98765;
+	test_location_event_data[location_cb_expected].location.longitude = 13.12345;
+	test_location_event_data[location_cb_expected].location.accuracy = 50.0;
+	test_location_event_data[location_cb_expected].location.datetime.valid = false;
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].location.details.wifi.ap_count = 2;
+#endif
+	location_cb_expected++;
+
+	/* Only one Wi-Fi scan is expected, the mock fails if scanning is requested again */
+	net_mgmt_NET_REQUEST_WIFI_SCAN_expected = true;
+	__cmock_net_mgmt_NET_REQUEST_WIFI_SCAN_ExpectAndReturn(0);
+
+	__cmock_nrf_modem_gnss_event_handler_set_ExpectAndReturn(&method_gnss_event_handler, 0);
+
+#if defined(CONFIG_LOCATION_TEST_AGNSS)
+	/* Setting values which doesn't require new A-GNSS request */
+	struct nrf_modem_gnss_agnss_expiry agnss_expiry = {
+		.data_flags = 0,
+		.utc_expiry = 0xffff,
+		.klob_expiry = 0xffff,
+		.neq_expiry = 0xffff,
+		.integrity_expiry = 0xffff,
+		.position_expiry = 0xffff };
+
+	__cmock_nrf_modem_gnss_agnss_expiry_get_ExpectAndReturn(NULL, 0);
+	__cmock_nrf_modem_gnss_agnss_expiry_get_IgnoreArg_agnss_expiry();
+	__cmock_nrf_modem_gnss_agnss_expiry_get_ReturnMemThruPtr_agnss_expiry(
+		&agnss_expiry, sizeof(agnss_expiry));
+#endif
+	__cmock_nrf_modem_gnss_fix_interval_set_ExpectAndReturn(1, 0);
+	__cmock_nrf_modem_gnss_use_case_set_ExpectAndReturn(
+		NRF_MODEM_GNSS_USE_CASE_MULTIPLE_HOT_START, 0);
+	__cmock_nrf_modem_gnss_start_ExpectAndReturn(0);
+
+	__mock_nrf_modem_at_scanf_ExpectAndReturn(
+		"AT%XSYSTEMMODE?", "%%XSYSTEMMODE: %d,%d,%d,%d,%d", 4);
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* LTE-M support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* NB-IoT support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* GNSS support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(0); /* LTE preference */
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	/* Wait for LOCATION_EVT_STARTED */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+#endif
+
+#if !defined(CONFIG_LOCATION_TEST_AGNSS)
+	__cmock_nrf_modem_at_cmd_ExpectAndReturn(NULL, 0, "AT%%XMONITOR", 0);
+	__cmock_nrf_modem_at_cmd_IgnoreArg_buf();
+	__cmock_nrf_modem_at_cmd_IgnoreArg_len();
+	__cmock_nrf_modem_at_cmd_ReturnArrayThruPtr_buf(
+		(char *)xmonitor_resp, sizeof(xmonitor_resp));
+#endif
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+
+	at_monitor_dispatch("+CSCON: 0");
+	k_sleep(K_MSEC(1));
+
+	/* Wi-Fi scan has been started while GNSS is running */
+	TEST_ASSERT_TRUE(net_mgmt_NET_REQUEST_WIFI_SCAN_occurred);
+
+	struct net_mgmt_event_callback cb;
+	const struct wifi_status status = {
+		.status = WIFI_STATUS_CONN_SUCCESS
+	};
+	const struct wifi_scan_result scan_result1 = {
+		.ssid = "TestAP1",
+		.ssid_length = 7,
+		.channel = 36,
+		.mac = {0x12, 0x34, 0x56, 0x78, 0x90, 0xAB},
+		.mac_length = 6
+	};
+	const struct wifi_scan_result scan_result2 = {
+		.ssid = "TestAP2",
+		.ssid_length = 7,
+		.channel = 36,
+		.mac = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66},
+		.mac_length = 6
+	};
+
+	/* Wi-Fi scan completes before GNSS times out */
+	cb.info = &scan_result1;
+	scan_wifi_net_mgmt_event_handler(&cb, NET_EVENT_WIFI_SCAN_RESULT, NULL);
+	cb.info = &scan_result2;
+	scan_wifi_net_mgmt_event_handler(&cb, NET_EVENT_WIFI_SCAN_RESULT, NULL);
+	cb.info = &status;
+	scan_wifi_net_mgmt_event_handler(&cb, NET_EVENT_WIFI_SCAN_DONE, NULL);
+	k_sleep(K_MSEC(1));
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	/* Wait for LOCATION_EVT_FALLBACK */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+#endif
+	/***** Fallback to Wi-Fi uses the earlier scan results *****/
+
+	/* Wait for LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+
+	struct location_data location_data = {
+		.latitude = 51.98765,
+		.longitude = 13.12345,
+		.accuracy = 50.0,
+		.datetime.valid = false
+	};
+
+	location_cloud_location_ext_result_set(LOCATION_EXT_RESULT_SUCCESS, &location_data);
+	k_sleep(K_MSEC(1));
+#endif
+#endif
+}
+
 /********* TESTS PERIODIC POSITIONING REQUESTS ***********************/
 
 /* Test periodic location request and cancel it once some iterations are done. */
@@ -9,6 +9,8 @@
 #include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/sys_heap.h>
 #include <modem/lte_lc.h>
 #include <nrf_errno.h>
 #include <mock_nrf_modem_at.h>
@@ -16,6 +18,7 @@
 #include "cmock_nrf_modem_at.h"
 #include "cmock_nrf_modem.h"
 #include "cmock_nrf_socket.h"
+#include "host_clock.h"
 
 #define TEST_EVENT_MAX_COUNT 20
 #define IGNORE NULL
@@ -39,6 +42,8 @@ K_SEM_DEFINE(event_handler_called_sem, 0, TEST_EVENT_MAX_COUNT);
  */
 extern void at_monitor_dispatch(const char *at_notif);
 
+extern struct sys_heap _system_heap;
+
 /* lte_lc_edrx_on_modem_cfun() is implemented in lte_lc library and
  * we'll call it directly to fake nrf_modem_lib call to this function
  */
@@ -4390,6 +4395,206 @@ void test_lte_lc_neighbor_cell_measurement_no_event_handler(void)
 	lte_lc_register_handler(lte_lc_event_handler);
 }
 
+/* Test that the results are written to the storage given by the application. */
+void test_lte_lc_neighbor_cell_measurement_storage(void)
+{
+	int ret;
+	static struct lte_lc_ncell neighbor_cells[1];
+	static struct lte_lc_cell gci_cells[2];
+	struct lte_lc_ncellmeas_storage storage = {
+		.neighbor_cells = neighbor_cells,
+		.neighbor_cells_len = ARRAY_SIZE(neighbor_cells),
+		.gci_cells = gci_cells,
+		.gci_cells_len = ARRAY_SIZE(gci_cells),
+	};
+	struct lte_lc_ncellmeas_params params = {
+		.search_type = LTE_LC_NEIGHBOR_SEARCH_TYPE_DEFAULT,
+		.storage = &storage,
+	};
+
+	memset(neighbor_cells, 0, sizeof(neighbor_cells));
+
+	strcpy(at_notif,
+	       "%NCELLMEAS:0,\"00112233\",\"98712\",\"0AB9\",4800,7,63,31,"
+	       "456,4800,8,60,29,4,3500,9,99,18,5,5300,11\r\n");
+
+	lte_lc_callback_count_expected = 1;
+
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%NCELLMEAS", EXIT_SUCCESS);
+
+	ret = lte_lc_neighbor_cell_measurement(&params);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+	/* The second neighbor cell does not fit in the storage and is ignored. */
+	test_event_data[0].type = LTE_LC_EVT_NEIGHBOR_CELL_MEAS;
+	test_event_data[0].cells_info.current_cell.mcc = 987;
+	test_event_data[0].cells_info.current_cell.mnc = 12;
+	test_event_data[0].cells_info.current_cell.id = 0x00112233;
+	test_event_data[0].cells_info.current_cell.tac = 0x0AB9;
+	test_event_data[0].cells_info.current_cell.earfcn = 7;
+	test_event_data[0].cells_info.current_cell.timing_advance = 4800;
+	test_event_data[0].cells_info.current_cell.timing_advance_meas_time = 11;
+	test_event_data[0].cells_info.current_cell.measurement_time = 4800;
+	test_event_data[0].cells_info.current_cell.phys_cell_id = 63;
+	test_event_data[0].cells_info.current_cell.rsrp = 31;
+	test_event_data[0].cells_info.current_cell.rsrq = 456;
+	test_event_data[0].cells_info.ncells_count = 1;
+	test_event_data[0].cells_info.gci_cells_count = 0;
+	test_neighbor_cells[0].earfcn = 8;
+	test_neighbor_cells[0].time_diff = 3500;
+	test_neighbor_cells[0].phys_cell_id = 60;
+	test_neighbor_cells[0].rsrp = 29;
+	test_neighbor_cells[0].rsrq = 4;
+
+	at_monitor_dispatch(at_notif);
+
+	TEST_ASSERT_EQUAL(8, neighbor_cells[0].earfcn);
+	TEST_ASSERT_EQUAL(60, neighbor_cells[0].phys_cell_id);
+}
+
+void test_lte_lc_neighbor_cell_measurement_invalid_storage_fail(void)
+{
+	int ret;
+	static struct lte_lc_cell gci_cells[2];
+	struct lte_lc_ncellmeas_storage storage = {
+		.gci_cells = gci_cells,
+		.gci_cells_len = ARRAY_SIZE(gci_cells),
+	};
+	struct lte_lc_ncellmeas_params params = {
+		.search_type = LTE_LC_NEIGHBOR_SEARCH_TYPE_GCI_DEFAULT,
+		.gci_count = 3,
+		.storage = &storage,
+	};
+
+	ret = lte_lc_neighbor_cell_measurement(&params);
+	TEST_ASSERT_EQUAL(-EINVAL, ret);
+
+	storage.gci_cells = NULL;
+	params.gci_count = 2;
+
+	ret = lte_lc_neighbor_cell_measurement(&params);
+	TEST_ASSERT_EQUAL(-EINVAL, ret);
+}
+
+#define NCELLMEAS_BENCHMARK_ROUNDS 1000
+
+static const char ncellmeas_benchmark_notif[] =
+	"%NCELLMEAS: 0,"
+	"\"00112233\",\"98712\",\"0AB9\",4800,7,63,31,456,4800,"
+	"333333,100,101,102,0,333333,103,104,105,0,333333,106,107,108,0,333333,109,110,111,0,"
+	"444444,112,113,114,0,444444,115,116,117,0,444444,118,119,120,0,444444,121,122,123,0,"
+	"555555,124,125,126,0,555555,127,128,129,0,555555,130,131,132,0,555555,133,134,135,0,"
+	"666666,136,137,138,0,666666,139,140,141,0,666666,142,143,144,0,666666,145,146,147,0,"
+	"777777,148,149,150,0,777777,151,152,153,0,888888,154,155,156,0,888888,157,158,159,0,"
+	"11\r\n";
+
+static const char ncellmeas_gci_benchmark_notif[] =
+	"%NCELLMEAS: 0,"
+	"\"00123456\",\"555555\",\"0102\",65534,18446744073709551614,"
+	"999999,123,127,-127,18446744073709551614,1,17,"
+	"333333,100,101,102,0,333333,103,104,105,0,333333,106,107,108,0,333333,109,110,111,0,"
+	"444444,112,113,114,0,444444,115,116,117,0,444444,118,119,120,0,444444,121,122,123,0,"
+	"555555,124,125,126,0,555555,127,128,129,0,555555,130,131,132,0,555555,133,134,135,0,"
+	"666666,136,137,138,0,666666,139,140,141,0,666666,142,143,144,0,666666,145,146,147,0,"
+	"777777,148,149,150,0,"
+	"\"01234567\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"02345678\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"03456789\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"0456789A\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"056789AB\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"06789ABC\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"0789ABCD\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"089ABCDE\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"09ABCDEF\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"0ABCDEF0\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"0BCDEF01\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"0CDEF012\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"0DEF0123\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0,"
+	"\"0EF01234\",\"555555\",\"0102\",65534,5,999999,123,127,-127,189241,0,0\r\n";
+
+static size_t ncellmeas_benchmark_cells;
+static size_t ncellmeas_benchmark_events;
+
+static void lte_lc_event_handler_benchmark(const struct lte_lc_evt *const evt)
+{
+	TEST_ASSERT_EQUAL(LTE_LC_EVT_NEIGHBOR_CELL_MEAS, evt->type);
+
+	ncellmeas_benchmark_cells += evt->cells_info.ncells_count +
+				     evt->cells_info.gci_cells_count;
+	ncellmeas_benchmark_events++;
+}
+
+static uint64_t ncellmeas_benchmark_run(struct lte_lc_ncellmeas_params *params,
+					const char *at_cmd, const char *notif)
+{
+	int ret;
+	uint64_t start;
+	uint64_t ns = 0;
+
+	for (int i = 0; i < NCELLMEAS_BENCHMARK_ROUNDS; i++) {
+		__mock_nrf_modem_at_printf_ExpectAndReturn(at_cmd, EXIT_SUCCESS);
+
+		ret = lte_lc_neighbor_cell_measurement(params);
+		TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+		start = host_clock_ns();
+		at_monitor_dispatch(notif);
+		ns += host_clock_ns() - start;
+	}
+
+	return ns;
+}
+
+/* Periodic cell positioning measures the neighbor cells every few minutes. Measure the time from
+ * a maximum length %NCELLMEAS notification to the event, and check that the system heap is not
+ * used for the results.
+ */
+void test_lte_lc_neighbor_cell_measurement_benchmark(void)
+{
+	int ret;
+	uint64_t ns, gci_ns;
+	struct sys_memory_stats before;
+	struct sys_memory_stats after;
+	struct lte_lc_ncellmeas_params params = {
+		.search_type = LTE_LC_NEIGHBOR_SEARCH_TYPE_EXTENDED_COMPLETE,
+	};
+	struct lte_lc_ncellmeas_params gci_params = {
+		.search_type = LTE_LC_NEIGHBOR_SEARCH_TYPE_GCI_EXTENDED_COMPLETE,
+		.gci_count = 15,
+	};
+
+	ret = lte_lc_deregister_handler(lte_lc_event_handler);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	lte_lc_register_handler(lte_lc_event_handler_benchmark);
+
+	ncellmeas_benchmark_cells = 0;
+	ncellmeas_benchmark_events = 0;
+
+	ret = sys_heap_runtime_stats_get(&_system_heap, &before);
+	TEST_ASSERT_EQUAL(0, ret);
+	ret = sys_heap_runtime_stats_reset_max(&_system_heap);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	ns = ncellmeas_benchmark_run(&params, "AT%NCELLMEAS=2", ncellmeas_benchmark_notif);
+	gci_ns = ncellmeas_benchmark_run(&gci_params, "AT%NCELLMEAS=5,15",
+					 ncellmeas_gci_benchmark_notif);
+
+	ret = sys_heap_runtime_stats_get(&_system_heap, &after);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	printk("%%NCELLMEAS notification to event: %llu ns, GCI: %llu ns\n",
+	       ns / NCELLMEAS_BENCHMARK_ROUNDS, gci_ns / NCELLMEAS_BENCHMARK_ROUNDS);
+
+	TEST_ASSERT_EQUAL(2 * NCELLMEAS_BENCHMARK_ROUNDS, ncellmeas_benchmark_events);
+	TEST_ASSERT_EQUAL(NCELLMEAS_BENCHMARK_ROUNDS * (17 + 17 + 14),
+			  ncellmeas_benchmark_cells);
+	TEST_ASSERT_EQUAL(before.allocated_bytes, after.max_allocated_bytes);
+
+	ret = lte_lc_deregister_handler(lte_lc_event_handler_benchmark);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	lte_lc_register_handler(lte_lc_event_handler);
+}
+
 void test_lte_lc_modem_sleep_event(void)
 {
 	lte_lc_callback_count_expected = 6;
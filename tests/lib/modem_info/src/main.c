@@ -12,6 +12,7 @@
 #include <zephyr/device.h>
 
 #include "modem_info.h"
+#include "modem_info_internal.h"
 
 #include <zephyr/fff.h>
 
@@ -40,6 +41,9 @@ FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_cmd, void *, size_t, const char *, ...)
 #define EXAMPLE_SHORT_OPERATOR_NAME "OP"
 #define EXAMPLE_SNR 47
 
+#define EXAMPLE_CEREG "+CEREG: 5,1,\"0A0B\",\"01020304\",7\r\nOK\r\n"
+#define EXAMPLE_CEREG_NOTIF "+CEREG: 1,\"0A0C\",\"01020305\",7\r\n"
+
 #define SHORT_OP_NAME_SIZE_WITHOUT_NULL_TERM 64
 BUILD_ASSERT(SHORT_OP_NAME_SIZE_WITHOUT_NULL_TERM == (MODEM_INFO_SHORT_OP_NAME_SIZE - 1),
 	     "Short operator size macros must match");
@@ -258,10 +262,71 @@ static int nrf_modem_at_scanf_custom_snr(const char *cmd, const char *fmt, va_li
 	return 1;
 }
 
+/* Implemented in the AT monitor library */
+extern void at_monitor_dispatch(const char *notif);
+
+/* Modem library initialization hook of the cache */
+extern void cache_on_modem_init(int ret, void *ctx);
+
+static const struct {
+	const char *cmd;
+	const char *rsp;
+} at_cmd_responses[] = {
+	{ "AT%XCBAND", "%XCBAND: 20\r\nOK\r\n" },
+	{ "AT%XCBAND=?", "%XCBAND: (1,2,3,4,5,8,12,13,20)\r\nOK\r\n" },
+	{ "AT+CGMR", "mfw_nrf9160_1.3.2\r\nOK\r\n" },
+	{ "AT+CGSN", "352656100367872\r\nOK\r\n" },
+	{ "AT+CGDCONT?", "+CGDCONT: 0,\"IP\",\"internet\",\"10.0.0.1\",0,0\r\nOK\r\n" },
+	{ "AT+COPS?", "+COPS: 0,2,\"24201\",7\r\nOK\r\n" },
+	{ "AT+CEREG?", EXAMPLE_CEREG },
+	{ "AT%XSYSTEMMODE?", "%XSYSTEMMODE: 1,0,1,0\r\nOK\r\n" },
+	{ "AT+CESQ", "+CESQ: 99,99,255,255,31,62\r\nOK\r\n" },
+	{ "AT+CCLK?", "+CCLK: \"24/02/01,12:00:00+08\"\r\nOK\r\n" },
+};
+
+static int at_cmd_count[ARRAY_SIZE(at_cmd_responses)];
+
+static int nrf_modem_at_cmd_custom(void *buf, size_t len, const char *fmt, va_list args)
+{
+	const char *cmd;
+
+	TEST_ASSERT_EQUAL_STRING("%s", fmt);
+	cmd = va_arg(args, const char *);
+
+	for (size_t i = 0; i < ARRAY_SIZE(at_cmd_responses); i++) {
+		if (strcmp(cmd, at_cmd_responses[i].cmd) == 0) {
+			TEST_ASSERT_LESS_THAN(len, strlen(at_cmd_responses[i].rsp));
+			strcpy(buf, at_cmd_responses[i].rsp);
+			at_cmd_count[i]++;
+			return 0;
+		}
+	}
+
+	TEST_FAIL_MESSAGE("Unexpected AT command");
+
+	return -NRF_EINVAL;
+}
+
+static int at_cmd_count_get(const char *cmd)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(at_cmd_responses); i++) {
+		if (strcmp(cmd, at_cmd_responses[i].cmd) == 0) {
+			return at_cmd_count[i];
+		}
+	}
+
+	return 0;
+}
+
 void setUp(void)
 {
 	RESET_FAKE(nrf_modem_at_notif_handler_set);
 	RESET_FAKE(nrf_modem_at_scanf);
+	RESET_FAKE(nrf_modem_at_cmd);
+
+	memset(at_cmd_count, 0, sizeof(at_cmd_count));
+	nrf_modem_at_cmd_fake.custom_fake = nrf_modem_at_cmd_custom;
+	modem_info_cache_clear();
 }
 
 void tearDown(void)
@@ -796,6 +861,179 @@ void test_modem_info_get_snr_success(void)
 	TEST_ASSERT_EQUAL(EXAMPLE_SNR - SNR_OFFSET_VAL, snr);
 }
 
+void test_modem_info_lte_params_get_one_cmd_per_response(void)
+{
+	struct lte_param cellid = { .type = MODEM_INFO_CELLID };
+	struct lte_param area_code = { .type = MODEM_INFO_AREA_CODE };
+	struct lte_param ip_address = { .type = MODEM_INFO_IP_ADDRESS };
+	struct lte_param apn = { .type = MODEM_INFO_APN };
+	struct lte_param lte_mode = { .type = MODEM_INFO_LTE_MODE };
+	struct lte_param nbiot_mode = { .type = MODEM_INFO_NBIOT_MODE };
+	struct lte_param gps_mode = { .type = MODEM_INFO_GPS_MODE };
+	struct lte_param operator = { .type = MODEM_INFO_OPERATOR };
+	struct lte_param band = { .type = MODEM_INFO_CUR_BAND };
+	struct lte_param *params[] = {
+		&band, &ip_address, &operator, &cellid, &area_code,
+		&lte_mode, &nbiot_mode, &gps_mode, &apn,
+	};
+
+	int ret = modem_info_lte_params_get(params, ARRAY_SIZE(params));
+
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(5, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL(1, at_cmd_count_get("AT+CEREG?"));
+	TEST_ASSERT_EQUAL(1, at_cmd_count_get("AT+CGDCONT?"));
+	TEST_ASSERT_EQUAL(1, at_cmd_count_get("AT%XSYSTEMMODE?"));
+
+	TEST_ASSERT_EQUAL_STRING("01020304", cellid.value_string);
+	TEST_ASSERT_EQUAL_STRING("0A0B", area_code.value_string);
+	TEST_ASSERT_EQUAL_STRING("10.0.0.1", ip_address.value_string);
+	TEST_ASSERT_EQUAL_STRING("internet", apn.value_string);
+	TEST_ASSERT_EQUAL_STRING("24201", operator.value_string);
+	TEST_ASSERT_EQUAL(1, lte_mode.value);
+	TEST_ASSERT_EQUAL(0, nbiot_mode.value);
+	TEST_ASSERT_EQUAL(1, gps_mode.value);
+	TEST_ASSERT_EQUAL(20, band.value);
+}
+
+void test_modem_info_lte_params_get_invalid_type(void)
+{
+	struct lte_param cellid = { .type = MODEM_INFO_CELLID };
+	struct lte_param invalid = { .type = MODEM_INFO_COUNT };
+	struct lte_param *params[] = { &cellid, &invalid };
+
+	int ret = modem_info_lte_params_get(params, ARRAY_SIZE(params));
+
+	TEST_ASSERT_EQUAL(-EINVAL, ret);
+	TEST_ASSERT_EQUAL(0, nrf_modem_at_cmd_fake.call_count);
+}
+
+void test_modem_info_lte_params_get_at_cmd_error(void)
+{
+	struct lte_param cellid = { .type = MODEM_INFO_CELLID };
+	struct lte_param *params[] = { &cellid };
+
+	nrf_modem_at_cmd_fake.custom_fake = NULL;
+	nrf_modem_at_cmd_fake.return_val = -NRF_EFAULT;
+
+	int ret = modem_info_lte_params_get(params, ARRAY_SIZE(params));
+
+	TEST_ASSERT_EQUAL(-EIO, ret);
+
+	/* Errors are not cached */
+	nrf_modem_at_cmd_fake.custom_fake = nrf_modem_at_cmd_custom;
+
+	ret = modem_info_lte_params_get(params, ARRAY_SIZE(params));
+
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_cmd_fake.call_count);
+}
+
+void test_modem_info_cache_hit(void)
+{
+	char cellid[MODEM_INFO_MAX_RESPONSE_SIZE];
+	char area_code[MODEM_INFO_MAX_RESPONSE_SIZE];
+	int ret;
+
+	ret = modem_info_string_get(MODEM_INFO_CELLID, cellid, sizeof(cellid));
+	TEST_ASSERT_EQUAL(strlen("01020304"), ret);
+
+	ret = modem_info_string_get(MODEM_INFO_AREA_CODE, area_code, sizeof(area_code));
+	TEST_ASSERT_EQUAL(strlen("0A0B"), ret);
+
+	TEST_ASSERT_EQUAL_STRING("01020304", cellid);
+	TEST_ASSERT_EQUAL_STRING("0A0B", area_code);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+}
+
+void test_modem_info_cache_clear(void)
+{
+	uint16_t band;
+
+	TEST_ASSERT_EQUAL(sizeof(uint16_t), modem_info_short_get(MODEM_INFO_CUR_BAND, &band));
+	modem_info_cache_clear();
+	TEST_ASSERT_EQUAL(sizeof(uint16_t), modem_info_short_get(MODEM_INFO_CUR_BAND, &band));
+
+	TEST_ASSERT_EQUAL(2, at_cmd_count_get("AT%XCBAND"));
+}
+
+void test_modem_info_cache_cleared_on_modem_init(void)
+{
+	char fw_version[MODEM_INFO_MAX_RESPONSE_SIZE];
+	char imei[MODEM_INFO_MAX_RESPONSE_SIZE];
+	char bands[MODEM_INFO_MAX_RESPONSE_SIZE];
+
+	for (int i = 0; i < 2; i++) {
+		TEST_ASSERT_GREATER_THAN(0, modem_info_string_get(MODEM_INFO_FW_VERSION,
+								   fw_version,
+								   sizeof(fw_version)));
+		TEST_ASSERT_GREATER_THAN(0, modem_info_string_get(MODEM_INFO_IMEI, imei,
+								   sizeof(imei)));
+		TEST_ASSERT_GREATER_THAN(0, modem_info_string_get(MODEM_INFO_SUP_BAND, bands,
+								   sizeof(bands)));
+	}
+
+	/* The modem firmware may have been updated */
+	cache_on_modem_init(0, NULL);
+
+	TEST_ASSERT_GREATER_THAN(0, modem_info_string_get(MODEM_INFO_FW_VERSION, fw_version,
+							   sizeof(fw_version)));
+	TEST_ASSERT_GREATER_THAN(0, modem_info_string_get(MODEM_INFO_IMEI, imei, sizeof(imei)));
+	TEST_ASSERT_GREATER_THAN(0, modem_info_string_get(MODEM_INFO_SUP_BAND, bands,
+							   sizeof(bands)));
+
+	TEST_ASSERT_EQUAL(2, at_cmd_count_get("AT+CGMR"));
+	TEST_ASSERT_EQUAL(2, at_cmd_count_get("AT+CGSN"));
+	TEST_ASSERT_EQUAL(2, at_cmd_count_get("AT%XCBAND=?"));
+}
+
+void test_modem_info_cache_invalidated_by_notification(void)
+{
+	char cellid[MODEM_INFO_MAX_RESPONSE_SIZE];
+	uint16_t lte_mode;
+
+	TEST_ASSERT_GREATER_THAN(0, modem_info_string_get(MODEM_INFO_CELLID, cellid,
+							   sizeof(cellid)));
+	TEST_ASSERT_EQUAL(sizeof(uint16_t), modem_info_short_get(MODEM_INFO_LTE_MODE, &lte_mode));
+
+	at_monitor_dispatch(EXAMPLE_CEREG_NOTIF);
+
+	TEST_ASSERT_GREATER_THAN(0, modem_info_string_get(MODEM_INFO_CELLID, cellid,
+							   sizeof(cellid)));
+	TEST_ASSERT_EQUAL(sizeof(uint16_t), modem_info_short_get(MODEM_INFO_LTE_MODE, &lte_mode));
+
+	/* The system mode is not changed by the registration status */
+	TEST_ASSERT_EQUAL(2, at_cmd_count_get("AT+CEREG?"));
+	TEST_ASSERT_EQUAL(1, at_cmd_count_get("AT%XSYSTEMMODE?"));
+}
+
+void test_modem_info_cache_ttl(void)
+{
+	uint16_t rsrp;
+
+	TEST_ASSERT_EQUAL(sizeof(uint16_t), modem_info_short_get(MODEM_INFO_RSRP, &rsrp));
+	TEST_ASSERT_EQUAL(sizeof(uint16_t), modem_info_short_get(MODEM_INFO_RSRP, &rsrp));
+	TEST_ASSERT_EQUAL(1, at_cmd_count_get("AT+CESQ"));
+
+	k_sleep(K_MSEC(1100));
+
+	TEST_ASSERT_EQUAL(sizeof(uint16_t), modem_info_short_get(MODEM_INFO_RSRP, &rsrp));
+	TEST_ASSERT_EQUAL(2, at_cmd_count_get("AT+CESQ"));
+	TEST_ASSERT_EQUAL(62, rsrp);
+}
+
+void test_modem_info_date_time_not_cached(void)
+{
+	char date_time[MODEM_INFO_MAX_RESPONSE_SIZE];
+
+	TEST_ASSERT_GREATER_THAN(0, modem_info_string_get(MODEM_INFO_DATE_TIME, date_time,
+							   sizeof(date_time)));
+	TEST_ASSERT_GREATER_THAN(0, modem_info_string_get(MODEM_INFO_DATE_TIME, date_time,
+							   sizeof(date_time)));
+
+	TEST_ASSERT_EQUAL(2, at_cmd_count_get("AT+CCLK?"));
+}
+
 /* It is required to be added to each test. That is because unity's
  * main may return nonzero, while zephyr's main currently must
  * return 0 in all cases (other values are reserved).
@@ -1602,18 +1602,19 @@ void test_nrf9x_socket_offload_sendmsg_not_fits_buf(void)
 	msg.msg_iov = chunks;
 	msg.msg_iovlen = 3;
 
-	/* First send doesn't send all data of the first chunk */
-	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, &chunk_1, sizeof(int),
+	/* Data is repacked into buffer-sized parts. First send doesn't send all data
+	 * of the first part.
+	 */
+	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, NULL, 2 * sizeof(int),
 					   NRF_MSG_DONTWAIT,
-					   NULL, 0, sizeof(int) - 1);
-	/* Second send will send the remaining part of the first chunk */
-	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, ((uint8_t *)&chunk_1) + sizeof(int) - 1, 1,
+					   NULL, 0, 2 * sizeof(int) - 1);
+	__cmock_nrf_sendto_IgnoreArg_message();
+	/* Second send will send the remaining part of the first part */
+	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, NULL, 1,
 					   NRF_MSG_DONTWAIT,
 					   NULL, 0, 1);
-	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, &chunk_2, sizeof(int),
-					   NRF_MSG_DONTWAIT,
-					   NULL, 0, sizeof(int));
-	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, &chunk_3, sizeof(int),
+	__cmock_nrf_sendto_IgnoreArg_message();
+	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, NULL, sizeof(int),
 					   NRF_MSG_DONTWAIT,
 					   NULL, 0, sizeof(int));
 	__cmock_nrf_sendto_IgnoreArg_message();
@@ -1629,6 +1630,48 @@ void test_nrf9x_socket_offload_sendmsg_not_fits_buf(void)
 	TEST_ASSERT_EQUAL(ret, 0);
 }
 
+static int sendmsg_dgram_chunks[3] = { 42, 43, 44 };
+
+void test_nrf9x_socket_offload_sendmsg_dgram_not_fits_buf(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int family = NET_AF_INET;
+	int type = NET_SOCK_DGRAM;
+	int proto = NET_IPPROTO_UDP;
+	int flags = ZSOCK_MSG_DONTWAIT;
+	struct net_msghdr msg = { 0 };
+	struct net_iovec chunks[3] = { 0 };
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_DGRAM, NRF_IPPROTO_UDP, nrf_fd);
+
+	fd = zsock_socket(family, type, proto);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	for (int i = 0; i < ARRAY_SIZE(chunks); i++) {
+		chunks[i].iov_base = &sendmsg_dgram_chunks[i];
+		chunks[i].iov_len = sizeof(int);
+	}
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = ARRAY_SIZE(chunks);
+
+	/* The message does not fit the intermediate buffer, and a datagram cannot be
+	 * split, so nothing is sent.
+	 */
+	ret = zsock_sendmsg(fd, &msg, flags);
+
+	TEST_ASSERT_EQUAL(ret, -1);
+	TEST_ASSERT_EQUAL(errno, EMSGSIZE);
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
 void test_nrf9x_socket_offload_fcntl_einval(void)
 {
 	int ret;
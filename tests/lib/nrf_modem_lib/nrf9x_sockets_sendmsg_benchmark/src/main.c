@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/net/socket.h>
+#include <nrf_socket.h>
+
+#include "cmock_nrf_socket.h"
+#include "cmock_nrf_modem_os.h"
+
+#define SOCKET_COUNT		4
+#define MSG_COUNT		64
+#define MSG_PARTS		3
+#define PART_LEN_MAX		64
+#define NRF_FD_BASE		10
+#define STACK_SIZE		2048
+#define THREAD_PRIO		K_PRIO_PREEMPT(1)
+
+/* Time the modem takes to accept data: fixed IPC overhead and one microsecond per byte. */
+#define SENDTO_LATENCY_US(len)	(500 + (len))
+
+/* With two intermediate buffers, concurrent sockets must send at least this many times
+ * faster than a single socket.
+ */
+#define MIN_CONCURRENT_SPEEDUP_PERCENT 150
+
+/* The unity_main is not declared in any header file. It is only defined in the generated test
+ * runner because of ncs' unity configuration. It is therefore declared here to avoid a compiler
+ * warning.
+ */
+extern int unity_main(void);
+
+struct sock_state {
+	int fd;
+	uint8_t idx;
+	size_t tx_offset;
+	size_t rx_offset;
+	uint32_t sendto_cnt;
+	bool error;
+	uint8_t parts[MSG_PARTS][PART_LEN_MAX];
+};
+
+static struct sock_state sock_state[SOCKET_COUNT];
+static struct k_thread threads[SOCKET_COUNT];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, SOCKET_COUNT, STACK_SIZE);
+
+static int next_nrf_fd;
+static size_t part_len;
+static bool dgram;
+
+void setUp(void)
+{
+	memset(sock_state, 0, sizeof(sock_state));
+	next_nrf_fd = NRF_FD_BASE;
+}
+
+void tearDown(void)
+{
+}
+
+static uint8_t pattern(uint8_t idx, size_t offset)
+{
+	/* Differs between sockets, so data sent on a wrong socket is detected. */
+	return (uint8_t)((offset * 31) + idx);
+}
+
+static int nrf_socket_stub(int family, int type, int protocol, int cmock_num_calls)
+{
+	return next_nrf_fd++;
+}
+
+static int nrf_close_stub(int fd, int cmock_num_calls)
+{
+	return 0;
+}
+
+static ssize_t nrf_sendto_stub(int socket, const void *message, size_t length, int flags,
+			       const struct nrf_sockaddr *dest_addr, nrf_socklen_t dest_len,
+			       int cmock_num_calls)
+{
+	struct sock_state *s = &sock_state[socket - NRF_FD_BASE];
+	const uint8_t *data = message;
+
+	/* Each message must be received as a single datagram. */
+	if (dgram && (length != (MSG_PARTS * part_len))) {
+		s->error = true;
+	}
+
+	for (size_t i = 0; i < length; i++) {
+		if (data[i] != pattern(s->idx, s->rx_offset + i)) {
+			s->error = true;
+		}
+	}
+
+	s->rx_offset += length;
+	s->sendto_cnt++;
+
+	/* Model the modem IPC. The thread does not use the CPU while it waits. */
+	k_sleep(K_USEC(SENDTO_LATENCY_US(length)));
+
+	return length;
+}
+
+static void sender_thread(void *p1, void *p2, void *p3)
+{
+	struct sock_state *s = p1;
+	struct net_iovec iov[MSG_PARTS];
+	struct net_msghdr msg = {
+		.msg_iov = iov,
+		.msg_iovlen = MSG_PARTS,
+	};
+	ssize_t ret;
+
+	for (size_t m = 0; m < MSG_COUNT; m++) {
+		for (size_t p = 0; p < MSG_PARTS; p++) {
+			for (size_t i = 0; i < part_len; i++) {
+				s->parts[p][i] = pattern(s->idx, s->tx_offset++);
+			}
+
+			iov[p].iov_base = s->parts[p];
+			iov[p].iov_len = part_len;
+		}
+
+		ret = zsock_sendmsg(s->fd, &msg, 0);
+		if (ret != (ssize_t)(MSG_PARTS * part_len)) {
+			s->error = true;
+		}
+	}
+}
+
+static uint32_t run_benchmark(int type, int proto, size_t socket_count)
+{
+	uint32_t sendto_cnt = 0;
+	uint64_t duration_us;
+	uint64_t bytes;
+	int64_t start;
+
+	for (size_t n = 0; n < socket_count; n++) {
+		sock_state[n].idx = n;
+		sock_state[n].fd = zsock_socket(NET_AF_INET, type, proto);
+		TEST_ASSERT_TRUE(sock_state[n].fd >= 0);
+	}
+
+	start = k_uptime_ticks();
+
+	for (size_t n = 0; n < socket_count; n++) {
+		k_thread_create(&threads[n], stacks[n], K_THREAD_STACK_SIZEOF(stacks[n]),
+				sender_thread, &sock_state[n], NULL, NULL, THREAD_PRIO, 0, K_NO_WAIT);
+	}
+
+	for (size_t n = 0; n < socket_count; n++) {
+		TEST_ASSERT_EQUAL(0, k_thread_join(&threads[n], K_FOREVER));
+	}
+
+	duration_us = MAX(k_ticks_to_us_floor64(k_uptime_ticks() - start), 1);
+
+	for (size_t n = 0; n < socket_count; n++) {
+		TEST_ASSERT_FALSE(sock_state[n].error);
+		TEST_ASSERT_EQUAL(MSG_COUNT * MSG_PARTS * part_len, sock_state[n].rx_offset);
+		TEST_ASSERT_EQUAL(0, zsock_close(sock_state[n].fd));
+
+		sendto_cnt += sock_state[n].sendto_cnt;
+		memset(&sock_state[n], 0, sizeof(sock_state[n]));
+	}
+
+	bytes = (uint64_t)socket_count * MSG_COUNT * MSG_PARTS * part_len;
+
+	printk("%s, %u sockets: %llu kbps, %u sendto calls per message\n",
+	       dgram ? "Datagram" : "Stream", (uint32_t)socket_count, (bytes * 8000) / duration_us,
+	       sendto_cnt / (socket_count * MSG_COUNT));
+
+	return (bytes * 8000) / duration_us;
+}
+
+static void run_concurrency_benchmark(int type, int proto)
+{
+	__cmock_nrf_socket_Stub(nrf_socket_stub);
+	__cmock_nrf_close_Stub(nrf_close_stub);
+	__cmock_nrf_sendto_Stub(nrf_sendto_stub);
+
+	uint32_t single_kbps = run_benchmark(type, proto, 1);
+	uint32_t concurrent_kbps = run_benchmark(type, proto, SOCKET_COUNT);
+
+	TEST_ASSERT_TRUE((concurrent_kbps * 100) >= (single_kbps * MIN_CONCURRENT_SPEEDUP_PERCENT));
+}
+
+void test_sendmsg_dgram_concurrent_throughput(void)
+{
+	/* Message fits into the intermediate buffer. */
+	dgram = true;
+	part_len = CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE / MSG_PARTS;
+
+	run_concurrency_benchmark(NET_SOCK_DGRAM, NET_IPPROTO_UDP);
+}
+
+void test_sendmsg_stream_concurrent_throughput(void)
+{
+	/* Data is repacked into buffer-sized chunks. */
+	dgram = false;
+	part_len = PART_LEN_MAX;
+
+	run_concurrency_benchmark(NET_SOCK_STREAM, NET_IPPROTO_TCP);
+}
+
+/* Main test entry point */
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
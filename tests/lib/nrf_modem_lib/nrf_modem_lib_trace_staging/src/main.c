@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <unity.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fff.h>
+#include <modem/nrf_modem_lib.h>
+#include <modem/trace_backend.h>
+#include <nrf_errno.h>
+
+#include "nrf_modem_lib_trace.h"
+
+#include "cmock_trace_backend_mock.h"
+#include "cmock_nrf_modem.h"
+#include "cmock_nrf_modem_trace.h"
+#include "cmock_nrf_modem_os.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_printf, const char *, ...);
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+extern void nrf_modem_lib_trace_init(void);
+
+#define STAGING_BUF_SIZE CONFIG_NRF_MODEM_LIB_TRACE_STAGING_BUF_SIZE
+#define TRACE_DATA_SIZE (4 * STAGING_BUF_SIZE)
+#define MAX_N_FRAGS 8
+#define WAIT_TIMEOUT_MS 1000
+#define BITRATE_PERIOD_MS CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE_PERIOD_MS
+
+struct trace_get_result {
+	int err;
+	size_t n_frags;
+};
+
+K_MSGQ_DEFINE(trace_get_msgq, sizeof(struct trace_get_result), 4, 4);
+K_SEM_DEFINE(backend_release_sem, 0, 1);
+K_SEM_DEFINE(backend_deinit_sem, 0, 1);
+
+static struct nrf_modem_trace_data get_frags[MAX_N_FRAGS];
+static uint8_t trace_data[TRACE_DATA_SIZE];
+static uint8_t captured[TRACE_DATA_SIZE];
+static size_t captured_len;
+static atomic_t processed_len;
+static int backend_write_calls;
+static bool backend_blocked;
+static trace_backend_processed_cb backend_processed_cb;
+
+void setUp(void)
+{
+	RESET_FAKE(nrf_modem_at_printf);
+
+	for (size_t i = 0; i < sizeof(trace_data); i++) {
+		trace_data[i] = (uint8_t)(i * 7);
+	}
+
+	memset(captured, 0, sizeof(captured));
+	captured_len = 0;
+	atomic_set(&processed_len, 0);
+	backend_write_calls = 0;
+	backend_blocked = false;
+	k_sem_reset(&backend_release_sem);
+	k_msgq_purge(&trace_get_msgq);
+}
+
+static int nrf_modem_trace_get_stub(struct nrf_modem_trace_data **frags, size_t *n_frags,
+				    int timeout, int cmock_num_calls)
+{
+	struct trace_get_result result;
+
+	(void)k_msgq_get(&trace_get_msgq, &result, K_FOREVER);
+
+	if (result.err) {
+		return result.err;
+	}
+
+	*frags = get_frags;
+	*n_frags = result.n_frags;
+
+	return 0;
+}
+
+static int nrf_modem_trace_processed_stub(size_t len, int cmock_num_calls)
+{
+	atomic_add(&processed_len, len);
+
+	return 0;
+}
+
+static int trace_backend_init_stub(trace_backend_processed_cb trace_processed_cb,
+				   int cmock_num_calls)
+{
+	backend_processed_cb = trace_processed_cb;
+
+	return 0;
+}
+
+static int trace_backend_write_stub(const void *data, size_t len, int cmock_num_calls)
+{
+	if (backend_blocked) {
+		k_sem_take(&backend_release_sem, K_FOREVER);
+	}
+
+	len = MIN(len, sizeof(captured) - captured_len);
+	memcpy(&captured[captured_len], data, len);
+	captured_len += len;
+	backend_write_calls = cmock_num_calls + 1;
+
+	/* The trace memory is released by the trace module, not by the backend. */
+	(void)backend_processed_cb(len);
+
+	return (int)len;
+}
+
+static int trace_backend_deinit_stub(int cmock_num_calls)
+{
+	k_sem_give(&backend_deinit_sem);
+
+	return 0;
+}
+
+static void trace_start(void)
+{
+	__cmock_trace_backend_init_Stub(trace_backend_init_stub);
+	__cmock_nrf_modem_trace_get_Stub(nrf_modem_trace_get_stub);
+	__cmock_nrf_modem_trace_processed_Stub(nrf_modem_trace_processed_stub);
+	__cmock_trace_backend_write_Stub(trace_backend_write_stub);
+	__cmock_trace_backend_deinit_Stub(trace_backend_deinit_stub);
+
+	nrf_modem_lib_trace_init();
+
+	/* Trace data is released to the modem when it is staged. */
+	TEST_ASSERT_TRUE(backend_processed_cb != nrf_modem_trace_processed);
+}
+
+/* Split the trace data into fragments of the given length and pass them to the trace thread. */
+static void trace_frags_put(size_t frag_len, size_t n_frags)
+{
+	struct trace_get_result result = {
+		.n_frags = n_frags,
+	};
+
+	TEST_ASSERT_TRUE(n_frags <= MAX_N_FRAGS);
+	TEST_ASSERT_TRUE(frag_len * n_frags <= sizeof(trace_data));
+
+	for (size_t i = 0; i < n_frags; i++) {
+		get_frags[i].data = &trace_data[i * frag_len];
+		get_frags[i].len = frag_len;
+	}
+
+	TEST_ASSERT_EQUAL(0, k_msgq_put(&trace_get_msgq, &result, K_NO_WAIT));
+}
+
+static void trace_shutdown(void)
+{
+	struct trace_get_result result = {
+		.err = -NRF_ESHUTDOWN,
+	};
+
+	TEST_ASSERT_EQUAL(0, k_msgq_put(&trace_get_msgq, &result, K_NO_WAIT));
+}
+
+static void backend_release(void)
+{
+	backend_blocked = false;
+	k_sem_give(&backend_release_sem);
+}
+
+static void wait_processed(size_t len)
+{
+	for (int i = 0; i < WAIT_TIMEOUT_MS; i++) {
+		if (atomic_get(&processed_len) >= len) {
+			break;
+		}
+
+		k_sleep(K_MSEC(1));
+	}
+
+	TEST_ASSERT_EQUAL(len, atomic_get(&processed_len));
+}
+
+static void verify_captured(size_t len)
+{
+	TEST_ASSERT_EQUAL(len, captured_len);
+	TEST_ASSERT_EQUAL_MEMORY(trace_data, captured, len);
+}
+
+void test_trace_staging_releases_modem_memory(void)
+{
+	const size_t frag_len = STAGING_BUF_SIZE / 8;
+	const size_t n_frags = 4;
+
+	trace_start();
+
+	backend_blocked = true;
+	trace_frags_put(frag_len, n_frags);
+
+	/* Modem trace memory is released while the backend is busy. */
+	wait_processed(frag_len * n_frags);
+
+	backend_release();
+	trace_shutdown();
+	k_sem_take(&backend_deinit_sem, K_FOREVER);
+
+	verify_captured(frag_len * n_frags);
+
+	/* Fragments staged while the backend was busy are written together. */
+	TEST_ASSERT_TRUE(backend_write_calls < n_frags);
+}
+
+void test_trace_staging_buffer_full(void)
+{
+	const size_t frag_len = 2 * STAGING_BUF_SIZE;
+	const size_t n_frags = 2;
+
+	trace_start();
+
+	backend_blocked = true;
+	trace_frags_put(frag_len, n_frags);
+
+	/* Only the data that fits into the staging buffer is released to the modem. */
+	k_sleep(K_MSEC(50));
+	TEST_ASSERT_EQUAL(STAGING_BUF_SIZE, atomic_get(&processed_len));
+
+	backend_release();
+	wait_processed(frag_len * n_frags);
+
+	trace_shutdown();
+	k_sem_take(&backend_deinit_sem, K_FOREVER);
+
+	verify_captured(frag_len * n_frags);
+}
+
+void test_trace_staging_processing_done_wait(void)
+{
+	const size_t frag_len = STAGING_BUF_SIZE / 2;
+
+	trace_start();
+
+	backend_blocked = true;
+	trace_frags_put(frag_len, 1);
+	wait_processed(frag_len);
+
+	trace_shutdown();
+
+	/* Processing is not done until the staged data is written to the backend. */
+	TEST_ASSERT_EQUAL(-EAGAIN, nrf_modem_lib_trace_processing_done_wait(K_MSEC(50)));
+
+	backend_release();
+
+	TEST_ASSERT_EQUAL(0, nrf_modem_lib_trace_processing_done_wait(K_FOREVER));
+	k_sem_take(&backend_deinit_sem, K_FOREVER);
+
+	verify_captured(frag_len);
+}
+
+void test_trace_staging_bitrate(void)
+{
+	const size_t frag_len = STAGING_BUF_SIZE / 4;
+	const size_t n_frags = 4;
+	uint32_t bitrate = 0;
+
+	trace_start();
+
+	/* Let a period elapse so that data staged by the previous tests is not counted. */
+	k_sleep(K_MSEC(BITRATE_PERIOD_MS + 10));
+
+	trace_frags_put(frag_len, n_frags);
+	wait_processed(frag_len * n_frags);
+
+	for (int i = 0; i < 3 * BITRATE_PERIOD_MS; i++) {
+		bitrate = nrf_modem_lib_trace_staging_bitrate_get();
+		if (bitrate) {
+			break;
+		}
+
+		k_sleep(K_MSEC(1));
+	}
+
+	/* The fragments are staged within one or two periods. */
+	TEST_ASSERT_NOT_EQUAL(0, bitrate);
+	TEST_ASSERT_TRUE(bitrate <= frag_len * n_frags * 8 * MSEC_PER_SEC / BITRATE_PERIOD_MS);
+
+	trace_shutdown();
+	k_sem_take(&backend_deinit_sem, K_FOREVER);
+
+	verify_captured(frag_len * n_frags);
+}
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
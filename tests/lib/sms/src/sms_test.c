@@ -16,6 +16,7 @@
 #include <nrf_errno.h>
 
 #include "cmock_nrf_modem_at.h"
+#include "host_clock.h"
 
 
 static struct sms_data test_sms_data = {0};
@@ -47,6 +48,11 @@ extern void sms_on_cfun(int mode, void *ctx);
  */
 extern void sms_ack_resp_handler(const char *resp);
 
+/* 7 bit packing functions are implemented in SMS library and benchmarked directly */
+extern uint8_t string_conversion_7bit_sms_packing(uint8_t *data, uint8_t data_len);
+extern uint8_t string_conversion_7bit_sms_unpacking(const uint8_t *packed, uint8_t *unpacked,
+						    uint8_t num_char);
+
 static void helper_sms_data_clear(void)
 {
 	memset(&test_sms_data, 0, sizeof(test_sms_data));
@@ -1222,6 +1228,13 @@ static void sms_callback(struct sms_data *const data, void *context)
 	TEST_ASSERT_EQUAL_STRING(test_sms_data.payload, data->payload);
 	TEST_ASSERT_EQUAL(test_sms_data.payload_len, data->payload_len);
 
+	if (test_sms_data.concat_payload != NULL) {
+		TEST_ASSERT_EQUAL_STRING(test_sms_data.concat_payload, data->concat_payload);
+		TEST_ASSERT_EQUAL(test_sms_data.concat_payload_len, data->concat_payload_len);
+	} else {
+		TEST_ASSERT_NULL(data->concat_payload);
+	}
+
 	struct sms_deliver_header *sms_header = &data->header.deliver;
 
 	if (!test_sms_header_exists) {
@@ -1395,6 +1408,9 @@ void test_recv_len8_number20(void)
 /** Receive concatenated SMS with 291 characters that are split into 2 messages. */
 void test_recv_concat_len291_msgs2(void)
 {
+#if defined(CONFIG_SMS_REASSEMBLY)
+	TEST_IGNORE();
+#endif
 	sms_reg_helper();
 
 	strcpy(test_sms_header.originating_address.address_str, "1234567890");
@@ -1448,6 +1464,9 @@ void test_recv_concat_len291_msgs2(void)
  */
 void test_recv_concat_len755_msgs5(void)
 {
+#if defined(CONFIG_SMS_REASSEMBLY)
+	TEST_IGNORE();
+#endif
 	sms_reg_helper();
 
 	strcpy(test_sms_header.originating_address.address_str, "1234567890");
@@ -1592,6 +1611,9 @@ void test_recv_special_characters(void)
  */
 void test_recv_concat_escape_character_last(void)
 {
+#if defined(CONFIG_SMS_REASSEMBLY)
+	TEST_IGNORE();
+#endif
 	sms_reg_helper();
 
 	strcpy(test_sms_header.originating_address.address_str, "1234567890");
@@ -1638,6 +1660,197 @@ void test_recv_concat_escape_character_last(void)
 	sms_unreg_helper();
 }
 
+/* Parts of the concatenated SMS with 291 characters received in test_recv_concat_len291_msgs2 */
+static const char concat_len291_part1[] = "+CMT: \"+1234567890\",22\r\n"
+	"0791534874894310440A912143658709000012201232054480A00500037E020162B219AD66BBE172B0986C46ABD96EB81C2C269BD16AB61B2E078BC966B49AED86CBC162B219AD66BBE172B0986C46ABD96EB81C2C269BD16AB61B2E078BC966B49AED86CBC162B219AD66BBE172B0986C46ABD96EB81C2C269BD16AB61B2E078BC966B49AED86CBC162B219AD66BBE172B0986C46ABD96EB81C2C269BD16AB61B2E078BC966\r\n";
+static const char concat_len291_part2[] = "+CMT: \"+1234567890\",22\r\n"
+	"0791534874894320440A912143658709000012201232054480910500037E02026835DB0D9783C564335ACD76C3E56031D98C56B3DD7039584C36A3D56C375C0E1693CD6835DB0D9783C564335ACD76C3E56031D98C56B3DD7039584C36A3D56C375C0E1693CD6835DB0D9783C564335ACD76C3E56031D98C56B3DD7039584C36A3D56C375C0E1693CD6835DB0D9783C564335ACD76C3E56031\r\n";
+static const char concat_len291_text[] =
+	"123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123"
+	"456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901";
+
+static void helper_concat_len291_header(void)
+{
+	strcpy(test_sms_header.originating_address.address_str, "1234567890");
+	test_sms_header.originating_address.length = 10;
+	test_sms_header.originating_address.type = 0x91;
+	test_sms_header.time.year = 21;
+	test_sms_header.time.month = 2;
+	test_sms_header.time.day = 21;
+	test_sms_header.time.hour = 23;
+	test_sms_header.time.minute = 50;
+	test_sms_header.time.second = 44;
+	test_sms_header.time.timezone = 8;
+
+	test_sms_header.concatenated.present = true;
+	test_sms_header.concatenated.total_msgs = 2;
+	test_sms_header.concatenated.ref_number = 126;
+	test_sms_header.concatenated.seq_number = 1;
+
+	/* The first part and the whole message are notified when the last part is received */
+	test_sms_data.payload_len = 153;
+	memcpy(test_sms_data.payload, concat_len291_text, 153);
+	test_sms_data.concat_payload = (const uint8_t *)concat_len291_text;
+	test_sms_data.concat_payload_len = 291;
+}
+
+/** Receive a part of a concatenated SMS and check whether the listener is notified. */
+static void helper_concat_part_recv(const char *at_notif, bool notified)
+{
+	__cmock_nrf_modem_at_cmd_async_ExpectAndReturn(sms_ack_resp_handler, "AT+CNMA=1", 0);
+	sms_callback_called_expected = notified;
+	sms_callback_called_occurred = false;
+	at_monitor_dispatch(at_notif);
+	k_sleep(K_MSEC(1));
+	TEST_ASSERT_EQUAL(sms_callback_called_expected, sms_callback_called_occurred);
+}
+
+/** Reassemble concatenated SMS with 291 characters that are split into 2 messages. */
+void test_recv_reassembly_len291_msgs2(void)
+{
+#if !defined(CONFIG_SMS_REASSEMBLY)
+	TEST_IGNORE();
+#endif
+	sms_reg_helper();
+	helper_concat_len291_header();
+
+	helper_concat_part_recv(concat_len291_part1, false);
+	helper_concat_part_recv(concat_len291_part2, true);
+
+	sms_unreg_helper();
+}
+
+/**
+ * Reassemble concatenated SMS with 755 characters that are split into 5 messages,
+ * which are received in the same order as in test_recv_concat_len755_msgs5.
+ */
+void test_recv_reassembly_len755_msgs5_out_of_order(void)
+{
+#if !defined(CONFIG_SMS_REASSEMBLY)
+	TEST_IGNORE();
+#endif
+	static const char text[] =
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz";
+
+	sms_reg_helper();
+
+	strcpy(test_sms_header.originating_address.address_str, "1234567890");
+	test_sms_header.originating_address.length = 10;
+	test_sms_header.originating_address.type = 0x91;
+	/* Header of the first part */
+	test_sms_header.time.year = 21;
+	test_sms_header.time.month = 2;
+	test_sms_header.time.day = 22;
+	test_sms_header.time.hour = 8;
+	test_sms_header.time.minute = 56;
+	test_sms_header.time.second = 5;
+	test_sms_header.time.timezone = 8;
+
+	test_sms_header.concatenated.present = true;
+	test_sms_header.concatenated.total_msgs = 5;
+	test_sms_header.concatenated.ref_number = 128;
+	test_sms_header.concatenated.seq_number = 1;
+
+	test_sms_data.payload_len = 153;
+	memcpy(test_sms_data.payload, text, 153);
+	test_sms_data.concat_payload = (const uint8_t *)text;
+	test_sms_data.concat_payload_len = 755;
+
+	/* Part 1 */
+	helper_concat_part_recv("+CMT: \"1234567890\",159\r\n"
+		"0791534874894310440A912143658709000012202280655080A0050003800501C2E231B96C3EA3D3EA35BBED7EC3E3F239BD6EBFE3F37A50583C2697CD67745ABD66B7DD6F785C3EA7D7ED777C5E0F0A8BC7E4B2F98C4EABD7ECB6FB0D8FCBE7F4BAFD8ECFEB4161F1985C369FD169F59ADD76BFE171F99C5EB7DFF1793D282C1E93CBE6333AAD5EB3DBEE373C2E9FD3EBF63B3EAF0785C56372D97C46A7D56B76DBFD86C7E5\r\n",
+		false);
+	/* Part 4 */
+	helper_concat_part_recv("+CMT: \"1234567890\",159\r\n"
+		"0791534874894370440A912143658709000012202280656080A0050003800504C2E231B96C3EA3D3EA35BBED7EC3E3F239BD6EBFE3F37A50583C2697CD67745ABD66B7DD6F785C3EA7D7ED777C5E0F0A8BC7E4B2F98C4EABD7ECB6FB0D8FCBE7F4BAFD8ECFEB4161F1985C369FD169F59ADD76BFE171F99C5EB7DFF1793D282C1E93CBE6333AAD5EB3DBEE373C2E9FD3EBF63B3EAF0785C56372D97C46A7D56B76DBFD86C7E5\r\n",
+		false);
+	/* Part 2 */
+	helper_concat_part_recv("+CMT: \"1234567890\",159\r\n"
+		"0791534874894370440A912143658709000012202280656080A0050003800502E6F4BAFD8ECFEB4161F1985C369FD169F59ADD76BFE171F99C5EB7DFF1793D282C1E93CBE6333AAD5EB3DBEE373C2E9FD3EBF63B3EAF0785C56372D97C46A7D56B76DBFD86C7E5737ADD7EC7E7F5A0B0784C2E9BCFE8B47ACD6EBBDFF0B87C4EAFDBEFF8BC1E14168FC965F3199D56AFD96DF71B1E97CFE975FB1D9FD783C2E231B96C3EA3D3\r\n",
+		false);
+	/* Part 3 */
+	helper_concat_part_recv("+CMT: \"1234567890\",159\r\n"
+		"0791534874894310440A912143658709000012202280656080A0050003800503D46B76DBFD86C7E5737ADD7EC7E7F5A0B0784C2E9BCFE8B47ACD6EBBDFF0B87C4EAFDBEFF8BC1E14168FC965F3199D56AFD96DF71B1E97CFE975FB1D9FD783C2E231B96C3EA3D3EA35BBED7EC3E3F239BD6EBFE3F37A50583C2697CD67745ABD66B7DD6F785C3EA7D7ED777C5E0F0A8BC7E4B2F98C4EABD7ECB6FB0D8FCBE7F4BAFD8ECFEB41\r\n",
+		false);
+	/* Part 5 */
+	helper_concat_part_recv("+CMT: \"1234567890\",151\r\n"
+		"0791534874894310440A91214365870900001220228065608096050003800505E6F4BAFD8ECFEB4161F1985C369FD169F59ADD76BFE171F99C5EB7DFF1793D282C1E93CBE6333AAD5EB3DBEE373C2E9FD3EBF63B3EAF0785C56372D97C46A7D56B76DBFD86C7E5737ADD7EC7E7F5A0B0784C2E9BCFE8B47ACD6EBBDFF0B87C4EAFDBEFF8BC1E14168FC965F3199D56AFD96DF71B1E97CFE975FB1D9FD703\r\n",
+		true);
+
+	sms_unreg_helper();
+}
+
+/** Receive a part of a concatenated SMS twice. The message is notified once. */
+void test_recv_reassembly_duplicate_part(void)
+{
+#if !defined(CONFIG_SMS_REASSEMBLY)
+	TEST_IGNORE();
+#endif
+	sms_reg_helper();
+	helper_concat_len291_header();
+
+	helper_concat_part_recv(concat_len291_part1, false);
+	helper_concat_part_recv(concat_len291_part1, false);
+	helper_concat_part_recv(concat_len291_part2, true);
+	helper_concat_part_recv(concat_len291_part2, false);
+
+	sms_unreg_helper();
+}
+
+/** Partially received concatenated SMS is dropped when the next part is not received in time. */
+void test_recv_reassembly_timeout(void)
+{
+#if !defined(CONFIG_SMS_REASSEMBLY)
+	TEST_IGNORE();
+#else
+	sms_reg_helper();
+	helper_concat_len291_header();
+
+	helper_concat_part_recv(concat_len291_part1, false);
+	k_sleep(K_SECONDS(CONFIG_SMS_REASSEMBLY_TIMEOUT));
+
+	/* The first part has been dropped, so the message is complete when it is received again */
+	helper_concat_part_recv(concat_len291_part2, false);
+	helper_concat_part_recv(concat_len291_part1, true);
+
+	sms_unreg_helper();
+#endif
+}
+
+/** Parts of a concatenated SMS that does not fit into the reassembly memory are notified as is. */
+void test_recv_reassembly_too_large(void)
+{
+#if !defined(CONFIG_SMS_REASSEMBLY)
+	TEST_IGNORE();
+#endif
+	sms_reg_helper();
+	helper_concat_len291_header();
+
+	/* The first part of the 291 character message, with the number of parts set to 20 */
+	test_sms_header.concatenated.total_msgs = 20;
+	test_sms_data.concat_payload = NULL;
+	test_sms_data.concat_payload_len = 0;
+
+	helper_concat_part_recv("+CMT: \"+1234567890\",22\r\n"
+		"0791534874894310440A912143658709000012201232054480A00500037E140162B219AD66BBE172B0986C46ABD96EB81C2C269BD16AB61B2E078BC966B49AED86CBC162B219AD66BBE172B0986C46ABD96EB81C2C269BD16AB61B2E078BC966B49AED86CBC162B219AD66BBE172B0986C46ABD96EB81C2C269BD16AB61B2E078BC966B49AED86CBC162B219AD66BBE172B0986C46ABD96EB81C2C269BD16AB61B2E078BC966\r\n",
+		true);
+
+	sms_unreg_helper();
+}
+
 /**
  * Tests:
  * - Data Coding Scheme with Coding Group Bits 7..4 set to 1111 while normally
@@ -2534,6 +2747,90 @@ void test_recv_loop(void)
 	sms_unreg_helper();
 }
 
+#define PACKING_BENCHMARK_ROUNDS 10000
+
+/* Reference packing, one character at a time as specified in 3GPP TS 23.038 chapter 6.1.2.1 */
+static uint8_t reference_7bit_packing(const uint8_t *data, uint8_t data_len, uint8_t *packed)
+{
+	uint8_t len = 0;
+
+	memset(packed, 0, SMS_MAX_PAYLOAD_LEN_CHARS);
+
+	for (int i = 0; i < data_len; i++) {
+		int bit = 7 * i;
+
+		packed[bit / 8] |= data[i] << (bit % 8);
+		if (bit % 8 > 1) {
+			packed[bit / 8 + 1] |= data[i] >> (8 - bit % 8);
+		}
+		len = (bit + 7 + 7) / 8;
+	}
+
+	return len;
+}
+
+/* Pack and unpack all message lengths, and compare with the reference packing */
+void test_7bit_packing(void)
+{
+	uint8_t data[SMS_MAX_PAYLOAD_LEN_CHARS];
+	uint8_t packed[SMS_MAX_PAYLOAD_LEN_CHARS];
+	uint8_t expected[SMS_MAX_PAYLOAD_LEN_CHARS];
+	uint8_t unpacked[SMS_MAX_PAYLOAD_LEN_CHARS];
+	uint8_t len;
+
+	for (int i = 0; i < SMS_MAX_PAYLOAD_LEN_CHARS; i++) {
+		data[i] = (i * 37 + 11) & 0x7F;
+	}
+
+	for (int data_len = 1; data_len <= SMS_MAX_PAYLOAD_LEN_CHARS; data_len++) {
+		memcpy(packed, data, data_len);
+		len = string_conversion_7bit_sms_packing(packed, data_len);
+		TEST_ASSERT_EQUAL(reference_7bit_packing(data, data_len, expected), len);
+		TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, packed, len);
+
+		len = string_conversion_7bit_sms_unpacking(packed, unpacked, data_len);
+		TEST_ASSERT_EQUAL(data_len, len);
+		TEST_ASSERT_EQUAL_HEX8_ARRAY(data, unpacked, data_len);
+	}
+}
+
+/* Incoming messages are unpacked and outgoing messages are packed. Measure both for a message of
+ * maximum length.
+ */
+void test_7bit_packing_benchmark(void)
+{
+	uint8_t data[SMS_MAX_PAYLOAD_LEN_CHARS];
+	uint8_t packed[SMS_MAX_PAYLOAD_LEN_CHARS];
+	uint8_t unpacked[SMS_MAX_PAYLOAD_LEN_CHARS];
+	uint64_t start;
+	uint64_t pack_ns = 0;
+	uint64_t unpack_ns = 0;
+	uint8_t len = 0;
+
+	for (int i = 0; i < SMS_MAX_PAYLOAD_LEN_CHARS; i++) {
+		data[i] = (i * 37 + 11) & 0x7F;
+	}
+
+	for (int i = 0; i < PACKING_BENCHMARK_ROUNDS; i++) {
+		memcpy(packed, data, sizeof(data));
+
+		start = host_clock_ns();
+		len = string_conversion_7bit_sms_packing(packed, SMS_MAX_PAYLOAD_LEN_CHARS);
+		pack_ns += host_clock_ns() - start;
+
+		start = host_clock_ns();
+		string_conversion_7bit_sms_unpacking(packed, unpacked, SMS_MAX_PAYLOAD_LEN_CHARS);
+		unpack_ns += host_clock_ns() - start;
+	}
+
+	printk("%d character 7 bit packing: %llu ns, unpacking: %llu ns\n",
+	       SMS_MAX_PAYLOAD_LEN_CHARS, pack_ns / PACKING_BENCHMARK_ROUNDS,
+	       unpack_ns / PACKING_BENCHMARK_ROUNDS);
+
+	TEST_ASSERT_EQUAL(140, len);
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(data, unpacked, SMS_MAX_PAYLOAD_LEN_CHARS);
+}
+
 /* This is needed because AT Monitor library is initialized in SYS_INIT. */
 static int sms_test_sys_init(void)
 {
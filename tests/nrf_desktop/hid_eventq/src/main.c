@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+
+#include "hid_eventq.h"
+#if defined(CONFIG_BOARD_NATIVE_SIM)
+#include "host_clock.h"
+#endif
+
+#define QUEUE_SIZE		12
+#define BENCH_QUEUE_SIZE	256
+#define BENCH_KEY_GROUP		8
+#define BENCH_ROUNDS		32
+#define STALE_DELAY_MS		10
+
+static struct hid_eventq q;
+static struct hid_eventq_event q_buf[QUEUE_SIZE];
+
+static struct hid_eventq bench_q;
+static struct hid_eventq_event bench_q_buf[BENCH_QUEUE_SIZE];
+
+/* Simulated time does not advance while code is executed. Use the host clock on native_sim. */
+static uint64_t bench_timestamp(void)
+{
+#if defined(CONFIG_BOARD_NATIVE_SIM)
+	return host_clock_ns();
+#else
+	return k_cycle_get_32();
+#endif
+}
+
+static uint64_t bench_elapsed_ns(uint64_t start)
+{
+#if defined(CONFIG_BOARD_NATIVE_SIM)
+	return host_clock_ns() - start;
+#else
+	return k_cyc_to_ns_floor64((uint32_t)(k_cycle_get_32() - (uint32_t)start));
+#endif
+}
+
+static void enqueue(uint16_t id, bool pressed)
+{
+	zassert_ok(hid_eventq_keypress_enqueue(&q, id, pressed, false));
+}
+
+static void verify_dequeue(uint16_t id, bool pressed)
+{
+	uint16_t id_out;
+	bool pressed_out;
+
+	zassert_ok(hid_eventq_keypress_dequeue(&q, &id_out, &pressed_out));
+	zassert_equal(id_out, id, "Unexpected key ID");
+	zassert_equal(pressed_out, pressed, "Unexpected key state");
+}
+
+static void verify_empty(void)
+{
+	uint16_t id_out;
+	bool pressed_out;
+
+	zassert_true(hid_eventq_is_empty(&q));
+	zassert_equal(hid_eventq_keypress_dequeue(&q, &id_out, &pressed_out), -ENOENT);
+}
+
+static int64_t stale_timestamp(void)
+{
+	k_sleep(K_MSEC(STALE_DELAY_MS));
+
+	return k_uptime_get();
+}
+
+static void before_each(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(&q, 0, sizeof(q));
+	hid_eventq_init(&q, q_buf, ARRAY_SIZE(q_buf));
+}
+
+ZTEST(hid_eventq, test_fifo)
+{
+	for (size_t i = 0; i < (3 * QUEUE_SIZE); i++) {
+		/* Move the head of the ring buffer to verify wrap around. */
+		enqueue(i, true);
+		enqueue(i, false);
+		verify_dequeue(i, true);
+		verify_dequeue(i, false);
+	}
+
+	verify_empty();
+}
+
+ZTEST(hid_eventq, test_full)
+{
+	for (size_t i = 0; i < QUEUE_SIZE; i++) {
+		enqueue(i, true);
+	}
+
+	zassert_true(hid_eventq_is_full(&q));
+	zassert_equal(hid_eventq_keypress_enqueue(&q, 0, false, false), -ENOBUFS);
+
+	/* Oldest key presses cannot be dropped without a matching key release. */
+	zassert_equal(hid_eventq_keypress_enqueue(&q, 0, false, true), -ENOBUFS);
+}
+
+ZTEST(hid_eventq, test_drop_oldest)
+{
+	enqueue(1, true);
+	enqueue(2, true);
+	enqueue(2, false);
+	enqueue(1, false);
+
+	/* Make sure the subsequent events have a newer timestamp. */
+	(void)stale_timestamp();
+
+	for (size_t i = 4; i < QUEUE_SIZE; i++) {
+		enqueue(3, (i % 2) == 0);
+	}
+
+	zassert_true(hid_eventq_is_full(&q));
+
+	/* Key 1 press and release and all the events in between must be dropped together. */
+	zassert_ok(hid_eventq_keypress_enqueue(&q, 4, true, true));
+
+	for (size_t i = 4; i < QUEUE_SIZE; i++) {
+		verify_dequeue(3, (i % 2) == 0);
+	}
+
+	verify_dequeue(4, true);
+	verify_empty();
+}
+
+ZTEST(hid_eventq, test_cleanup_pairs)
+{
+	enqueue(1, true);
+	enqueue(1, true);
+	enqueue(1, false);
+	enqueue(2, false);
+	enqueue(1, false);
+	enqueue(3, true);
+	enqueue(4, true);
+	enqueue(4, false);
+
+	int64_t min_ts = stale_timestamp();
+
+	enqueue(3, false);
+
+	/* Key 3 press is stale, but the matching key release is not. */
+	hid_eventq_cleanup(&q, min_ts);
+
+	verify_dequeue(3, true);
+	verify_dequeue(4, true);
+	verify_dequeue(4, false);
+	verify_dequeue(3, false);
+	verify_empty();
+}
+
+ZTEST(hid_eventq, test_cleanup_resume)
+{
+	enqueue(1, true);
+	enqueue(2, true);
+	enqueue(2, false);
+
+	int64_t min_ts = stale_timestamp();
+
+	/* Key 1 is not released. */
+	hid_eventq_cleanup(&q, min_ts);
+	zassert_false(hid_eventq_is_empty(&q));
+
+	enqueue(1, false);
+	enqueue(5, true);
+
+	min_ts = stale_timestamp();
+
+	hid_eventq_cleanup(&q, min_ts);
+
+	verify_dequeue(5, true);
+	verify_empty();
+}
+
+ZTEST(hid_eventq, test_cleanup_after_dequeue)
+{
+	enqueue(1, true);
+	enqueue(2, true);
+	enqueue(1, false);
+	enqueue(2, false);
+
+	verify_dequeue(1, true);
+
+	int64_t min_ts = stale_timestamp();
+
+	/* Key release of the dequeued key press can be dropped. */
+	hid_eventq_cleanup(&q, min_ts);
+	verify_empty();
+}
+
+ZTEST(hid_eventq, test_reset)
+{
+	enqueue(1, true);
+	enqueue(2, true);
+	enqueue(2, false);
+
+	hid_eventq_reset(&q);
+	verify_empty();
+
+	/* Key release must not be matched with a key press dropped by the reset. */
+	enqueue(1, false);
+
+	int64_t min_ts = stale_timestamp();
+
+	hid_eventq_cleanup(&q, min_ts);
+	verify_empty();
+}
+
+ZTEST(hid_eventq, test_benchmark)
+{
+	uint64_t enqueue_ns = 0;
+	uint64_t cleanup_ns = 0;
+
+	memset(&bench_q, 0, sizeof(bench_q));
+	hid_eventq_init(&bench_q, bench_q_buf, ARRAY_SIZE(bench_q_buf));
+
+	for (size_t round = 0; round < BENCH_ROUNDS; round++) {
+		uint64_t start = bench_timestamp();
+
+		/* Key mash: press a group of keys and release them in the same order. */
+		for (size_t i = 0; i < BENCH_QUEUE_SIZE; i++) {
+			uint16_t id = i % BENCH_KEY_GROUP;
+			bool pressed = ((i / BENCH_KEY_GROUP) % 2) == 0;
+			int err = hid_eventq_keypress_enqueue(&bench_q, id, pressed, false);
+
+			zassert_ok(err, "Enqueue failed (err: %d)", err);
+		}
+
+		enqueue_ns += bench_elapsed_ns(start);
+		zassert_true(hid_eventq_is_full(&bench_q));
+
+		int64_t min_ts = stale_timestamp();
+
+		start = bench_timestamp();
+		hid_eventq_cleanup(&bench_q, min_ts);
+		cleanup_ns += bench_elapsed_ns(start);
+
+		zassert_true(hid_eventq_is_empty(&bench_q));
+	}
+
+	TC_PRINT("Enqueue: %llu ns per keypress\n",
+		 enqueue_ns / (BENCH_ROUNDS * BENCH_QUEUE_SIZE));
+	TC_PRINT("Cleanup of %u keypresses: %llu ns\n",
+		 BENCH_QUEUE_SIZE, cleanup_ns / BENCH_ROUNDS);
+}
+
+ZTEST_SUITE(hid_eventq, NULL, NULL, before_each, NULL, NULL);
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include <zephyr/sys/printk.h>
+#include <bluetooth/cs_de.h>
+
+#include "host_clock.h"
+
+#define NUM_CHANNELS (75)
+#define CHANNEL_SPACING_HZ  (1e6f)
+#define PI (3.14159265358979f)
+#define SPEED_OF_LIGHT_M_PER_S (299792458.0f)
+
+#define IQ_SET_COUNT		32
+#define BENCHMARK_ROUNDS	8
+#define MAX_REFLECTIONS		3
+#define TONE_AMPLITUDE		100.0f
+#define NOISE_AMPLITUDE		2.0f
+#define MIN_DISTANCE_M		0.5f
+#define MAX_DISTANCE_M		40.0f
+
+/* Mean absolute error allowed for the line-of-sight IQ sets. */
+#define LOS_MAX_MEAN_ERROR_M	0.1f
+
+/* The unity_main is not declared in any header file. It is only defined in the generated test
+ * runner because of ncs' unity configuration. It is therefore declared here to avoid a compiler
+ * warning.
+ */
+extern int unity_main(void);
+
+struct iq_set {
+	float distance;
+	cs_de_report_t report;
+};
+
+static struct iq_set iq_sets[IQ_SET_COUNT];
+static uint32_t rand_state;
+
+static uint32_t rand_next(void)
+{
+	/* xorshift32 keeps the IQ sets identical between runs. */
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+static float rand_range(float min, float max)
+{
+	return min + (max - min) * ((float)rand_next() / (float)UINT32_MAX);
+}
+
+/* Generate tones of a channel with a direct path and reflections. Both devices measure the
+ * same channel, so the same tones are used for the local and remote device.
+ */
+static void generate_iq_tones(float distance, uint8_t reflections, cs_de_iq_tones_t *iq_tones)
+{
+	float path_distance[MAX_REFLECTIONS + 1];
+	float path_amplitude[MAX_REFLECTIONS + 1];
+
+	path_distance[0] = distance;
+	path_amplitude[0] = TONE_AMPLITUDE;
+
+	for (uint8_t k = 1; k <= reflections; k++) {
+		path_distance[k] = distance + rand_range(1.0f, 10.0f);
+		path_amplitude[k] = TONE_AMPLITUDE * rand_range(0.2f, 0.7f);
+	}
+
+	for (int i = 0; i < NUM_CHANNELS; i++) {
+		float re = rand_range(-NOISE_AMPLITUDE, NOISE_AMPLITUDE);
+		float im = rand_range(-NOISE_AMPLITUDE, NOISE_AMPLITUDE);
+
+		for (uint8_t k = 0; k <= reflections; k++) {
+			float rotation = 2 * PI * CHANNEL_SPACING_HZ * path_distance[k] /
+					 SPEED_OF_LIGHT_M_PER_S;
+
+			re += path_amplitude[k] * cosf(-rotation * i);
+			im += path_amplitude[k] * sinf(-rotation * i);
+		}
+
+		iq_tones->i_local[i] = re;
+		iq_tones->q_local[i] = im;
+		iq_tones->i_remote[i] = re;
+		iq_tones->q_remote[i] = im;
+	}
+}
+
+static void generate_iq_sets(uint8_t max_reflections)
+{
+	rand_state = 0x2545F491;
+
+	for (size_t n = 0; n < IQ_SET_COUNT; n++) {
+		struct iq_set *set = &iq_sets[n];
+
+		set->distance = rand_range(MIN_DISTANCE_M, MAX_DISTANCE_M);
+		set->report.n_ap = CONFIG_BT_CS_DE_MAX_NUM_ANTENNA_PATHS;
+		set->report.rtt_accumulated_half_ns = 0;
+		set->report.rtt_count = 0;
+
+		for (uint8_t ap = 0; ap < set->report.n_ap; ap++) {
+			uint8_t reflections = (max_reflections > 0) ?
+					      (rand_next() % (max_reflections + 1)) : 0;
+
+			set->report.tone_quality[ap] = CS_DE_TONE_QUALITY_OK;
+			generate_iq_tones(set->distance, reflections, &set->report.iq_tones[ap]);
+		}
+	}
+}
+
+static float run_benchmark(const char *name)
+{
+	static cs_de_report_t report;
+	uint64_t duration_ns = 0;
+	uint32_t estimate_cnt = 0;
+	float ifft_error = 0.0f;
+	float phase_slope_error = 0.0f;
+
+	for (size_t round = 0; round < BENCHMARK_ROUNDS; round++) {
+		for (size_t n = 0; n < IQ_SET_COUNT; n++) {
+			/* Distance estimation overwrites the report. */
+			memcpy(&report, &iq_sets[n].report, sizeof(report));
+
+			uint64_t start = host_clock_ns();
+
+			(void)cs_de_calc(&report);
+			duration_ns += host_clock_ns() - start;
+
+			if (round > 0) {
+				continue;
+			}
+
+			for (uint8_t ap = 0; ap < report.n_ap; ap++) {
+				const cs_de_dist_estimates_t *est = &report.distance_estimates[ap];
+
+				/* Invalid estimates are counted as the maximum error. */
+				ifft_error += isfinite(est->ifft) ?
+					      fabsf(est->ifft - iq_sets[n].distance) :
+					      MAX_DISTANCE_M;
+				phase_slope_error += isfinite(est->phase_slope) ?
+						     fabsf(est->phase_slope - iq_sets[n].distance) :
+						     MAX_DISTANCE_M;
+				estimate_cnt++;
+			}
+		}
+	}
+
+	uint32_t ap_cnt = BENCHMARK_ROUNDS * IQ_SET_COUNT * CONFIG_BT_CS_DE_MAX_NUM_ANTENNA_PATHS;
+
+	ifft_error /= estimate_cnt;
+	phase_slope_error /= estimate_cnt;
+
+	printk("%s (%s): %u procedures, %u antenna paths each\n", name,
+	       IS_ENABLED(CONFIG_BT_CS_DE_IFFT_Q31) ? "Q31" : "F32",
+	       BENCHMARK_ROUNDS * IQ_SET_COUNT, CONFIG_BT_CS_DE_MAX_NUM_ANTENNA_PATHS);
+	printk("  %llu antenna path estimates per second\n",
+	       (ap_cnt * 1000000000ULL) / MAX(duration_ns, 1));
+	printk("  mean absolute error: IFFT %.3f m, phase slope %.3f m\n",
+	       (double)ifft_error, (double)phase_slope_error);
+
+	return ifft_error;
+}
+
+void test_cs_de_benchmark_line_of_sight(void)
+{
+	generate_iq_sets(0);
+
+	float ifft_error = run_benchmark("Line of sight");
+
+	TEST_ASSERT_TRUE(ifft_error < LOS_MAX_MEAN_ERROR_M);
+}
+
+void test_cs_de_benchmark_multipath(void)
+{
+	generate_iq_sets(MAX_REFLECTIONS);
+
+	/* Only report accuracy, the estimation is not expected to resolve every reflection. */
+	(void)run_benchmark("Multipath");
+}
+
+/* Main test entry point */
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
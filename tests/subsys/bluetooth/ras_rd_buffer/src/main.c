@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/conn.h>
+
+/* The connection callbacks are called directly by the test. */
+#undef BT_CONN_CB_DEFINE
+#define BT_CONN_CB_DEFINE(_name) static const struct bt_conn_cb _name
+
+#include "ras_rd_buffer.c"
+
+#define TEST_CONN_COUNT 2
+#define OVERWRITTEN_MAX 8
+
+/** Mocks ******************************************/
+
+static uint8_t conn_storage[TEST_CONN_COUNT];
+static int conn_refs[TEST_CONN_COUNT];
+
+struct bt_conn *bt_conn_ref(struct bt_conn *conn)
+{
+	conn_refs[bt_conn_index(conn)]++;
+	return conn;
+}
+
+void bt_conn_unref(struct bt_conn *conn)
+{
+	zassert_true(conn_refs[bt_conn_index(conn)] > 0, "Connection not referenced");
+	conn_refs[bt_conn_index(conn)]--;
+}
+
+uint8_t bt_conn_index(const struct bt_conn *conn)
+{
+	return (const uint8_t *)conn - conn_storage;
+}
+
+void bt_le_cs_step_data_parse(struct net_buf_simple *step_data_buf,
+			      bool (*func)(struct bt_le_cs_subevent_step *step, void *user_data),
+			      void *user_data)
+{
+	/* The test procedures have no step data */
+}
+
+/** End of mocks ***********************************/
+
+static uint16_t overwritten[OVERWRITTEN_MAX];
+static size_t overwritten_count;
+
+static void ranging_data_overwritten(struct bt_conn *conn, uint16_t ranging_counter)
+{
+	zassert_true(overwritten_count < OVERWRITTEN_MAX);
+	overwritten[overwritten_count++] = ranging_counter;
+}
+
+static struct bt_ras_rd_buffer_cb rd_buffer_cb = {
+	.ranging_data_overwritten = ranging_data_overwritten,
+};
+
+static struct bt_conn *test_conn(uint8_t index)
+{
+	return (struct bt_conn *)&conn_storage[index];
+}
+
+static void procedure_subevent(struct bt_conn *conn, uint16_t procedure_counter,
+			       enum bt_conn_le_cs_procedure_done_status status)
+{
+	struct bt_conn_le_cs_subevent_result result = {
+		.header.procedure_counter = procedure_counter,
+		.header.procedure_done_status = status,
+		.header.num_antenna_paths = 1,
+	};
+
+	conn_callbacks.le_cs_subevent_data_available(conn, &result);
+}
+
+static void procedure_store(struct bt_conn *conn, uint16_t procedure_counter)
+{
+	procedure_subevent(conn, procedure_counter, BT_CONN_LE_CS_PROCEDURE_COMPLETE);
+}
+
+static void overwritten_check(const uint16_t *expected, size_t count)
+{
+	zassert_equal(overwritten_count, count, "%zu buffers overwritten, expected %zu",
+		      overwritten_count, count);
+
+	for (size_t i = 0; i < count; i++) {
+		zassert_equal(overwritten[i], expected[i], "Overwritten %u, expected %u",
+			      overwritten[i], expected[i]);
+	}
+
+	overwritten_count = 0;
+}
+
+static void *suite_setup(void)
+{
+	bt_ras_rd_buffer_cb_register(&rd_buffer_cb);
+
+	return NULL;
+}
+
+static void test_before(void *fixture)
+{
+	struct bt_conn_le_cs_procedure_enable_complete params = {0};
+
+	ARG_UNUSED(fixture);
+
+	for (uint8_t i = 0; i < TEST_CONN_COUNT; i++) {
+		conn_callbacks.le_cs_procedure_enable_complete(test_conn(i), BT_HCI_ERR_SUCCESS,
+							       &params);
+	}
+
+	overwritten_count = 0;
+}
+
+static void test_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (uint8_t i = 0; i < TEST_CONN_COUNT; i++) {
+		conn_callbacks.disconnected(test_conn(i), 0);
+		zassert_equal(conn_refs[i], 0, "Connection %u references leaked", i);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(rd_buffer_pool); i++) {
+		zassert_is_null(rd_buffer_pool[i].conn, "Buffer %zu not freed", i);
+		zassert_equal(atomic_get(&rd_buffer_pool[i].refcount), 0,
+			      "Buffer %zu reference counter not cleared", i);
+	}
+}
+
+ZTEST(ras_rd_buffer, test_alloc_wrap_around)
+{
+	struct bt_conn *conn = test_conn(0);
+	/* Ranging counter is the 12 least significant bits of the procedure counter */
+	const uint16_t expected[] = {0x0FFE, 0x0FFF};
+
+	procedure_store(conn, 0x0FFE);
+	procedure_store(conn, 0x0FFF);
+	zassert_equal(conn_refs[0], 2);
+	overwritten_check(NULL, 0);
+
+	/* The oldest buffer is overwritten across the wrap around of the ranging counter */
+	procedure_store(conn, 0x1000);
+	procedure_store(conn, 0x1001);
+	overwritten_check(expected, ARRAY_SIZE(expected));
+
+	zassert_false(bt_ras_rd_buffer_ready_check(conn, 0x0FFE));
+	zassert_false(bt_ras_rd_buffer_ready_check(conn, 0x0FFF));
+	zassert_true(bt_ras_rd_buffer_ready_check(conn, 0x000));
+	zassert_true(bt_ras_rd_buffer_ready_check(conn, 0x001));
+	zassert_equal(conn_refs[0], 2, "Overwritten buffers must release the connection");
+}
+
+ZTEST(ras_rd_buffer, test_alloc_per_conn)
+{
+	const uint16_t expected[] = {1};
+
+	procedure_store(test_conn(0), 1);
+	procedure_store(test_conn(1), 1);
+	procedure_store(test_conn(0), 2);
+	procedure_store(test_conn(1), 2);
+	overwritten_check(NULL, 0);
+
+	/* Buffers of the other connection are not overwritten */
+	procedure_store(test_conn(0), 3);
+	overwritten_check(expected, ARRAY_SIZE(expected));
+	zassert_true(bt_ras_rd_buffer_ready_check(test_conn(1), 1));
+	zassert_true(bt_ras_rd_buffer_ready_check(test_conn(1), 2));
+}
+
+ZTEST(ras_rd_buffer, test_free)
+{
+	struct bt_conn *conn = test_conn(0);
+
+	/* The buffer of an aborted procedure is freed */
+	procedure_subevent(conn, 1, BT_CONN_LE_CS_PROCEDURE_INCOMPLETE);
+	zassert_equal(conn_refs[0], 1);
+	procedure_subevent(conn, 1, BT_CONN_LE_CS_PROCEDURE_ABORTED);
+	zassert_false(bt_ras_rd_buffer_ready_check(conn, 1));
+	zassert_equal(conn_refs[0], 0);
+
+	/* Freed buffers are allocated before stored ones are overwritten */
+	procedure_store(conn, 2);
+	procedure_store(conn, 3);
+	overwritten_check(NULL, 0);
+
+	/* Disconnection frees the buffers of the connection, checked after the test */
+}
+
+ZTEST(ras_rd_buffer, test_ack)
+{
+	struct bt_conn *conn = test_conn(0);
+	struct ras_rd_buffer *buf;
+	const uint16_t expected[] = {2};
+
+	procedure_store(conn, 1);
+	procedure_store(conn, 2);
+
+	buf = bt_ras_rd_buffer_claim(conn, 1);
+	zassert_not_null(buf);
+	buf->acked = true;
+	zassert_ok(bt_ras_rd_buffer_release(buf));
+	zassert_equal(bt_ras_rd_buffer_release(buf), -EINVAL, "Released without reference");
+
+	/* The peer has read the buffer, so overwriting it is not notified */
+	procedure_store(conn, 3);
+	overwritten_check(NULL, 0);
+
+	/* The flag does not carry over to the new ranging data */
+	procedure_store(conn, 4);
+	overwritten_check(expected, ARRAY_SIZE(expected));
+	procedure_store(conn, 5);
+	zassert_equal(overwritten_count, 1);
+	zassert_equal(overwritten[0], 3);
+}
+
+ZTEST(ras_rd_buffer, test_claimed_not_reclaimed)
+{
+	struct bt_conn *conn = test_conn(0);
+	struct ras_rd_buffer *buf_1;
+	struct ras_rd_buffer *buf_3;
+	const uint16_t expected_2[] = {2};
+	const uint16_t expected_1[] = {1};
+
+	procedure_store(conn, 1);
+	procedure_store(conn, 2);
+
+	buf_1 = bt_ras_rd_buffer_claim(conn, 1);
+	zassert_not_null(buf_1);
+
+	/* The older buffer is claimed, so the newer one is overwritten */
+	procedure_store(conn, 3);
+	overwritten_check(expected_2, ARRAY_SIZE(expected_2));
+	zassert_equal(buf_1->ranging_counter, 1);
+	zassert_true(buf_1->ready);
+
+	/* No buffer can be reclaimed while all of them are claimed */
+	buf_3 = bt_ras_rd_buffer_claim(conn, 3);
+	zassert_not_null(buf_3);
+	procedure_store(conn, 4);
+	overwritten_check(NULL, 0);
+	zassert_false(bt_ras_rd_buffer_ready_check(conn, 4));
+	zassert_equal(buf_1->ranging_counter, 1);
+	zassert_equal(buf_3->ranging_counter, 3);
+
+	/* The buffer is reclaimed once the reader has released it */
+	zassert_ok(bt_ras_rd_buffer_release(buf_1));
+	procedure_store(conn, 5);
+	overwritten_check(expected_1, ARRAY_SIZE(expected_1));
+	zassert_is_null(bt_ras_rd_buffer_claim(conn, 1), "Overwritten buffer claimed");
+
+	zassert_ok(bt_ras_rd_buffer_release(buf_3));
+}
+
+ZTEST(ras_rd_buffer, test_reader_and_writer)
+{
+	struct bt_conn *conn = test_conn(0);
+	struct ras_rd_buffer *buf;
+
+	/* A buffer that is being written cannot be claimed */
+	procedure_subevent(conn, 1, BT_CONN_LE_CS_PROCEDURE_INCOMPLETE);
+	zassert_false(bt_ras_rd_buffer_ready_check(conn, 1));
+	zassert_is_null(bt_ras_rd_buffer_claim(conn, 1));
+
+	procedure_subevent(conn, 1, BT_CONN_LE_CS_PROCEDURE_COMPLETE);
+	buf = bt_ras_rd_buffer_claim(conn, 1);
+	zassert_not_null(buf);
+
+	/* The writer cannot lock a buffer with an active reader */
+	zassert_false(rd_buffer_writer_lock(buf));
+	zassert_ok(bt_ras_rd_buffer_release(buf));
+
+	/* A reader cannot reference a buffer locked by the writer */
+	zassert_true(rd_buffer_writer_lock(buf));
+	zassert_is_null(bt_ras_rd_buffer_claim(conn, 1));
+	zassert_false(rd_buffer_reader_ref(buf));
+	rd_buffer_publish(buf);
+
+	/* Multiple readers can hold the buffer */
+	zassert_equal_ptr(bt_ras_rd_buffer_claim(conn, 1), buf);
+	zassert_equal_ptr(bt_ras_rd_buffer_claim(conn, 1), buf);
+	zassert_equal(atomic_get(&buf->refcount), 2);
+	zassert_ok(bt_ras_rd_buffer_release(buf));
+	zassert_false(rd_buffer_writer_lock(buf));
+	zassert_ok(bt_ras_rd_buffer_release(buf));
+}
+
+ZTEST_SUITE(ras_rd_buffer, NULL, suite_setup, test_before, test_after, NULL);
@@ -7,6 +7,11 @@
 #include <zephyr/ztest.h>
 #include <../subsys/bootloader/bl_validation/bl_validation_internal.h>
 
+#define TEST_MAGIC_LEN 12
+#define TEST_SEARCH_DISTANCE 4
+
+static const uint32_t test_magic[] = {0x281ee6de, 0x86518483, 0x79d0a005};
+
 ZTEST(bl_validation_unittest, test_within)
 {
 	zassert_false(within(10, 10, 10), NULL);
@@ -30,4 +35,47 @@ ZTEST(bl_validation_unittest, test_region_within)
 	zassert_false(region_within(0xFFFF, 0x20000, 0x10000, 0x100000), NULL);
 }
 
+/* Place validation data (magic followed by the firmware address) at offset in
+ * an erased flash image, and search for it from the end of the firmware.
+ */
+static const void *validation_data_find(uint8_t *image, size_t image_size,
+					uint32_t fw_size, uint32_t offset)
+{
+	const uint32_t address = 0x8000;
+
+	memset(image, 0xFF, image_size);
+	memcpy(&image[offset], test_magic, TEST_MAGIC_LEN);
+	memcpy(&image[offset + TEST_MAGIC_LEN], &address, sizeof(address));
+
+	return magic_find((uintptr_t)&image[fw_size], TEST_SEARCH_DISTANCE,
+			  test_magic, TEST_MAGIC_LEN);
+}
+
+ZTEST(bl_validation_unittest, test_magic_find)
+{
+	uint8_t image[64] __aligned(4);
+
+	for (uint32_t fw_size = 16; fw_size < 24; fw_size++) {
+		/* Default placement by validation_data.py, word aligned after the firmware */
+		uint32_t aligned = ((fw_size / 4) + 1) * 4;
+
+		zassert_equal_ptr(validation_data_find(image, sizeof(image), fw_size, aligned),
+				  &image[aligned], "Aligned data not found, fw_size %u", fw_size);
+
+		/* Placement with --offset, which does not need to be word aligned */
+		for (uint32_t offset = fw_size; offset <= fw_size + TEST_SEARCH_DISTANCE;
+		     offset++) {
+			zassert_equal_ptr(validation_data_find(image, sizeof(image), fw_size,
+							       offset),
+					  &image[offset], "Data not found, fw_size %u offset %u",
+					  fw_size, offset);
+		}
+
+		/* Beyond the search distance */
+		zassert_is_null(validation_data_find(image, sizeof(image), fw_size,
+						     fw_size + TEST_SEARCH_DISTANCE + 1),
+				"Data found beyond the search distance, fw_size %u", fw_size);
+	}
+}
+
 ZTEST_SUITE(bl_validation_unittest, NULL, NULL, NULL, NULL, NULL);
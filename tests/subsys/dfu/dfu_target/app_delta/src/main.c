@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <psa/crypto.h>
+#include <dfu/dfu_target.h>
+#include <dfu/dfu_target_app_delta.h>
+#include <dfu/dfu_multi_image.h>
+
+#define MULTI_IMAGE_HEADER_BUF_SIZE 64
+#define MULTI_IMAGE_CHUNK_SIZE 100
+
+/* Images and patch generated by scripts/bootloader/app_delta_tool.py at build time */
+static const uint8_t source[] = {
+#include "app_delta_source.inc"
+};
+
+static const uint8_t target[] = {
+#include "app_delta_target.inc"
+};
+
+static const uint8_t patch[] = {
+#include "app_delta_patch.inc"
+};
+
+/* DFU Multi Image package with the patch as image 0 */
+static const uint8_t dfu_package[] = {
+#include "dfu_package.inc"
+};
+
+#define TARGET_SIZE sizeof(target)
+
+/* Patch as received, modified by some of the tests */
+static uint8_t patch_buf[sizeof(patch)];
+static const size_t patch_len = sizeof(patch);
+
+static uint8_t multi_image_buf[MULTI_IMAGE_HEADER_BUF_SIZE];
+
+static uint8_t written[TARGET_SIZE];
+static size_t written_len;
+static bool done_called;
+static bool done_successful;
+
+int dfu_target_mcuboot_init(size_t file_size, int img_num, dfu_target_callback_t cb)
+{
+	written_len = 0;
+
+	return 0;
+}
+
+int dfu_target_mcuboot_offset_get(size_t *offset)
+{
+	*offset = written_len;
+
+	return 0;
+}
+
+int dfu_target_mcuboot_write(const void *const buf, size_t len)
+{
+	if (len > sizeof(written) - written_len) {
+		return -EFBIG;
+	}
+
+	memcpy(&written[written_len], buf, len);
+	written_len += len;
+
+	return 0;
+}
+
+int dfu_target_mcuboot_done(bool successful)
+{
+	done_called = true;
+	done_successful = successful;
+
+	return 0;
+}
+
+int dfu_target_mcuboot_schedule_update(int img_num)
+{
+	return 0;
+}
+
+int dfu_target_mcuboot_reset(void)
+{
+	written_len = 0;
+
+	return 0;
+}
+
+static void *suite_setup(void)
+{
+	const struct flash_area *fa;
+	int err;
+
+	zassert_equal(psa_crypto_init(), PSA_SUCCESS, "Failed to init PSA crypto");
+
+	err = flash_area_open(FIXED_PARTITION_ID(slot0_partition), &fa);
+	zassert_equal(err, 0, "Failed to open active slot: %d", err);
+
+	err = flash_area_erase(fa, 0, fa->fa_size);
+	zassert_equal(err, 0, "Failed to erase active slot: %d", err);
+
+	err = flash_area_write(fa, 0, source, sizeof(source));
+	zassert_equal(err, 0, "Failed to write active slot: %d", err);
+
+	flash_area_close(fa);
+
+	return NULL;
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(written, 0, sizeof(written));
+	written_len = 0;
+	done_called = false;
+	done_successful = false;
+
+	memcpy(patch_buf, patch, sizeof(patch_buf));
+
+	zassert_equal(dfu_target_app_delta_init(patch_len, 0, NULL), 0, "Init failed");
+}
+
+static void target_verify(void)
+{
+	zassert_equal(written_len, TARGET_SIZE, "Unexpected image size %zu", written_len);
+	zassert_mem_equal(written, target, TARGET_SIZE, "Patched image mismatch");
+}
+
+ZTEST(dfu_target_app_delta, test_identify)
+{
+	zassert_true(dfu_target_app_delta_identify(patch_buf), "Patch not identified");
+	zassert_false(dfu_target_app_delta_identify(source), "Source identified as patch");
+	zassert_equal(dfu_target_img_type(patch_buf, patch_len), DFU_TARGET_IMAGE_TYPE_APP_DELTA,
+		      "Unexpected image type");
+}
+
+ZTEST(dfu_target_app_delta, test_apply)
+{
+	size_t offset;
+
+	zassert_equal(dfu_target_app_delta_write(patch_buf, patch_len), 0, "Write failed");
+	zassert_equal(dfu_target_app_delta_offset_get(&offset), 0, "Offset get failed");
+	zassert_equal(offset, patch_len, "Unexpected offset %zu", offset);
+
+	target_verify();
+
+	zassert_equal(dfu_target_app_delta_done(true), 0, "Done failed");
+	zassert_true(done_called && done_successful, "Image not accepted");
+}
+
+ZTEST(dfu_target_app_delta, test_apply_fragmented)
+{
+	for (size_t i = 0; i < patch_len; i++) {
+		zassert_equal(dfu_target_app_delta_write(&patch_buf[i], 1), 0,
+			      "Write failed at offset %zu", i);
+	}
+
+	target_verify();
+
+	zassert_equal(dfu_target_app_delta_done(true), 0, "Done failed");
+	zassert_true(done_called && done_successful, "Image not accepted");
+}
+
+ZTEST(dfu_target_app_delta, test_incomplete)
+{
+	zassert_equal(dfu_target_app_delta_write(patch_buf, patch_len - 1), 0, "Write failed");
+
+	zassert_equal(dfu_target_app_delta_done(true), -EINVAL, "Incomplete image accepted");
+	zassert_true(done_called && !done_successful, "Image not rejected");
+}
+
+ZTEST(dfu_target_app_delta, test_target_hash_mismatch)
+{
+	struct dfu_target_app_delta_header *header = (void *)patch_buf;
+
+	header->target_hash[0] ^= 0xff;
+
+	zassert_equal(dfu_target_app_delta_write(patch_buf, patch_len), 0, "Write failed");
+	zassert_equal(dfu_target_app_delta_done(true), -EINVAL, "Hash mismatch not detected");
+	zassert_true(done_called && !done_successful, "Image not rejected");
+}
+
+ZTEST(dfu_target_app_delta, test_source_mismatch)
+{
+	struct dfu_target_app_delta_header *header = (void *)patch_buf;
+
+	header->source_hash[0] ^= 0xff;
+
+	zassert_equal(dfu_target_app_delta_write(patch_buf, patch_len), -ENOENT,
+		      "Source mismatch not detected");
+	zassert_equal(written_len, 0, "Data written for wrong source");
+	zassert_equal(dfu_target_app_delta_reset(), 0, "Reset failed");
+}
+
+ZTEST(dfu_target_app_delta, test_malformed_record)
+{
+	/* Copy more data than the target image holds */
+	sys_put_le32(TARGET_SIZE + 1, &patch_buf[sizeof(struct dfu_target_app_delta_header)]);
+
+	zassert_equal(dfu_target_app_delta_write(patch_buf, patch_len), -EINVAL,
+		      "Malformed record not detected");
+	zassert_equal(dfu_target_app_delta_write(patch_buf, 1), -EINVAL,
+		      "Write accepted after error");
+	zassert_equal(dfu_target_app_delta_reset(), 0, "Reset failed");
+}
+
+static int writer_open(int image_id, size_t image_size)
+{
+	return dfu_target_init(DFU_TARGET_IMAGE_TYPE_APP_DELTA, image_id, image_size, NULL);
+}
+
+static int writer_write(const uint8_t *chunk, size_t chunk_size)
+{
+	return dfu_target_write(chunk, chunk_size);
+}
+
+static int writer_close(bool success)
+{
+	return dfu_target_done(success);
+}
+
+static int writer_reset(void)
+{
+	return dfu_target_reset();
+}
+
+ZTEST(dfu_target_app_delta, test_multi_image)
+{
+	const struct dfu_image_writer writer = {
+		.image_id = 0,
+		.open = writer_open,
+		.write = writer_write,
+		.close = writer_close,
+		.reset = writer_reset,
+	};
+	size_t chunk_size;
+
+	zassert_ok(dfu_multi_image_init(multi_image_buf, sizeof(multi_image_buf)),
+		   "Multi image init failed");
+	zassert_ok(dfu_multi_image_register_writer(&writer), "Writer not registered");
+
+	for (size_t offset = 0; offset < sizeof(dfu_package); offset += chunk_size) {
+		chunk_size = MIN(MULTI_IMAGE_CHUNK_SIZE, sizeof(dfu_package) - offset);
+
+		zassert_ok(dfu_multi_image_write(offset, &dfu_package[offset], chunk_size),
+			   "Write failed at offset %zu", offset);
+	}
+
+	zassert_ok(dfu_multi_image_done(true), "Multi image done failed");
+
+	target_verify();
+	zassert_true(done_called && done_successful, "Image not accepted");
+}
+
+ZTEST_SUITE(dfu_target_app_delta, NULL, suite_setup, test_before, NULL, NULL);
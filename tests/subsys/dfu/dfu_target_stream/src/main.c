@@ -11,6 +11,11 @@
 #include <zephyr/ztest.h>
 #include <dfu/dfu_target_stream.h>
 
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
+#include <stdio.h>
+#include <zephyr/settings/settings.h>
+#endif
+
 #define FLASH_BASE (64*1024)
 #define FLASH_AVAILABLE (16*1024)
 
@@ -19,6 +24,8 @@
 
 #define BUF_LEN 14000 /* Note, not page aligned */
 
+#define PROGRESS_CHUNK_LEN 1024
+
 static const struct device *fdev = DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
 static uint8_t sbuf[128];
 static uint8_t read_buf[BUF_LEN];
@@ -33,6 +40,31 @@ static int page_size;
 		.fdev = fdev_, .buf = buf_, .len = len_, .offset = offset_,  \
 		.size = size_, .cb = cb_})
 
+#if defined(CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS) || \
+	defined(CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND)
+/* Start a stream with no stored progress on erased flash, completing the stream
+ * left by the previous test.
+ */
+static void stream_restart(const char *id, size_t size)
+{
+	int err;
+
+	(void)dfu_target_stream_done(true);
+
+	err = flash_erase(fdev, FLASH_BASE, FLASH_AVAILABLE);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = DFU_TARGET_STREAM_INIT(id, fdev, sbuf, sizeof(sbuf), FLASH_BASE, size, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_reset();
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = DFU_TARGET_STREAM_INIT(id, fdev, sbuf, sizeof(sbuf), FLASH_BASE, size, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+}
+#endif
+
 ZTEST(dfu_target_stream_test, test_dfu_target_stream)
 {
 	int err;
@@ -242,6 +274,62 @@ ZTEST(dfu_target_stream_test, test_dfu_target_stream_save_progress)
 	zassert_equal(err, 0, "Unexpected failure: %d", err);
 }
 
+static int progress_load_cb(const char *key, size_t len, settings_read_cb read_cb,
+			    void *cb_arg, void *param)
+{
+	size_t *progress = param;
+
+	if (read_cb(cb_arg, progress, sizeof(*progress)) != sizeof(*progress)) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static size_t progress_stored_get(const char *id)
+{
+	int err;
+	char key[32];
+	size_t progress = 0;
+
+	snprintf(key, sizeof(key), "dfu/%s", id);
+
+	err = settings_load_subtree_direct(key, progress_load_cb, &progress);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	return progress;
+}
+
+ZTEST(dfu_target_stream_test, test_save_progress_interval)
+{
+	int err;
+	size_t offset;
+	size_t expected = 0;
+
+	stream_restart(TEST_ID_1, FLASH_AVAILABLE);
+
+	for (size_t i = 0; i < FLASH_AVAILABLE / PROGRESS_CHUNK_LEN; i++) {
+		err = dfu_target_stream_write(write_buf, PROGRESS_CHUNK_LEN);
+		zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+		err = dfu_target_stream_offset_get(&offset);
+		zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+		/* The progress is stored once the interval has been written
+		 * since the last stored record.
+		 */
+		if (offset - expected >= CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_INTERVAL) {
+			expected = offset;
+		}
+
+		zassert_equal(progress_stored_get(TEST_ID_1), expected,
+			      "Unexpected progress stored at offset %zu", offset);
+	}
+
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+}
+
 static size_t get_flash_page_size(const struct device *dev)
 {
 	struct flash_driver_api *api = (struct flash_driver_api *) dev->api;
@@ -288,6 +376,134 @@ ZTEST(dfu_target_stream_test, test_dfu_target_stream_save_progress)
 	ztest_test_skip();
 }
 
+ZTEST(dfu_target_stream_test, test_save_progress_interval)
+{
+	ztest_test_skip();
+}
+
+#endif
+
+#ifdef CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND
+#define WB_BUF_SIZE CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND_BUF_SIZE
+
+ZTEST(dfu_target_stream_test, test_write_behind_done)
+{
+	int err;
+	struct stream_flash_ctx *ctx;
+
+	stream_restart(TEST_ID_1, FLASH_AVAILABLE);
+
+	err = dfu_target_stream_write(write_buf, BUF_LEN);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	/* All data is in flash when the stream is completed */
+	ctx = dfu_target_stream_get_stream();
+	zassert_equal(stream_flash_bytes_written(ctx), BUF_LEN, "Data not written");
+
+	err = flash_read(fdev, FLASH_BASE, read_buf, BUF_LEN);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_mem_equal(read_buf, write_buf, BUF_LEN, "Incorrect value");
+}
+
+ZTEST(dfu_target_stream_test, test_write_behind_error)
+{
+	int err;
+	size_t offset;
+
+	/* Only the first staging buffer fits in the stream, so the flash
+	 * thread fails to write the second one.
+	 */
+	stream_restart(TEST_ID_1, WB_BUF_SIZE);
+
+	err = dfu_target_stream_write(write_buf, 2 * WB_BUF_SIZE);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_offset_get(&offset);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal(offset, WB_BUF_SIZE, "Invalid offset");
+
+	/* The error is returned by every call until the stream is completed */
+	err = dfu_target_stream_write(write_buf, 1);
+	zassert_equal(err, -ENOMEM, "Unexpected result: %d", err);
+
+	err = dfu_target_stream_write(write_buf, 1);
+	zassert_equal(err, -ENOMEM, "Unexpected result: %d", err);
+
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, -ENOMEM, "Unexpected result: %d", err);
+
+	/* The next stream starts without the error */
+	stream_restart(TEST_ID_1, FLASH_AVAILABLE);
+
+	err = dfu_target_stream_write(write_buf, WB_BUF_SIZE);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+}
+
+ZTEST(dfu_target_stream_test, test_write_behind_reset)
+{
+	int err;
+	size_t offset;
+	size_t buffered;
+	struct stream_flash_ctx *ctx;
+
+	stream_restart(TEST_ID_1, FLASH_AVAILABLE);
+
+	/* Two staging buffers are queued, and a third one is being filled */
+	err = dfu_target_stream_write(write_buf, 2 * WB_BUF_SIZE + 100);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_reset();
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = DFU_TARGET_STREAM_INIT(TEST_ID_1, fdev, sbuf, sizeof(sbuf),
+				     FLASH_BASE, FLASH_AVAILABLE, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_offset_get(&offset);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal(offset, 0, "Invalid offset");
+
+	err = dfu_target_stream_bytes_buffered_get(&buffered);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal(buffered, 0, "Data of the reset stream buffered");
+
+	/* No data of the reset stream is written after the new one */
+	err = dfu_target_stream_write(write_buf, PROGRESS_CHUNK_LEN);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	ctx = dfu_target_stream_get_stream();
+	zassert_equal(stream_flash_bytes_written(ctx), PROGRESS_CHUNK_LEN, "Invalid offset");
+
+	err = flash_read(fdev, FLASH_BASE, read_buf, PROGRESS_CHUNK_LEN);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_mem_equal(read_buf, write_buf, PROGRESS_CHUNK_LEN, "Incorrect value");
+}
+#else
+
+ZTEST(dfu_target_stream_test, test_write_behind_done)
+{
+	ztest_test_skip();
+}
+
+ZTEST(dfu_target_stream_test, test_write_behind_error)
+{
+	ztest_test_skip();
+}
+
+ZTEST(dfu_target_stream_test, test_write_behind_reset)
+{
+	ztest_test_skip();
+}
+
 #endif
 
 static void *setup(void)
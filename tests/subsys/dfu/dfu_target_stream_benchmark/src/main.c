@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+#include <dfu/dfu_target_stream.h>
+
+#include "flash_benchmark.h"
+
+#define FLASH_BASE		(64 * 1024)
+#define IMAGE_SIZE		(32 * 1024)
+#define CHUNK_SIZE		1024
+#define STREAM_BUF_SIZE		1024
+
+/* Time to receive one chunk from the network, for example one LTE-M round trip per
+ * HTTP fragment.
+ */
+#define RECV_LATENCY		K_MSEC(5)
+
+static const struct device *fdev = DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
+static uint8_t stream_buf[STREAM_BUF_SIZE];
+static uint8_t image[IMAGE_SIZE];
+static uint8_t read_buf[CHUNK_SIZE];
+
+static void flash_verify(void)
+{
+	int err;
+
+	for (size_t off = 0; off < IMAGE_SIZE; off += sizeof(read_buf)) {
+		err = flash_read(fdev, FLASH_BASE + off, read_buf, sizeof(read_buf));
+		zassert_equal(err, 0, "Failed to read flash: %d", err);
+		zassert_mem_equal(read_buf, &image[off], sizeof(read_buf),
+				  "Image data mismatch at offset %zu", off);
+	}
+}
+
+ZTEST(dfu_target_stream_benchmark, test_download_flash_throughput)
+{
+	struct dfu_target_stream_init init = {
+		.id = "benchmark",
+		.fdev = fdev,
+		.buf = stream_buf,
+		.len = sizeof(stream_buf),
+		.offset = FLASH_BASE,
+		.size = IMAGE_SIZE,
+	};
+	size_t offset;
+	int64_t start;
+	int err;
+
+	flash_benchmark_image_fill(image, sizeof(image));
+
+	err = dfu_target_stream_init(&init);
+	zassert_equal(err, 0, "Failed to initialize stream: %d", err);
+
+	start = k_uptime_get();
+
+	for (size_t off = 0; off < IMAGE_SIZE; off += CHUNK_SIZE) {
+		/* The next chunk is received while the previous one is written. */
+		k_sleep(RECV_LATENCY);
+
+		err = dfu_target_stream_write(&image[off], CHUNK_SIZE);
+		zassert_equal(err, 0, "Failed to write chunk at %zu: %d", off, err);
+	}
+
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Failed to complete stream: %d", err);
+
+	flash_benchmark_report("download", IS_ENABLED(CONFIG_DFU_TARGET_STREAM_WRITE_BEHIND),
+			       IMAGE_SIZE, start);
+
+	err = dfu_target_stream_offset_get(&offset);
+	zassert_equal(err, 0, "Failed to get offset: %d", err);
+	zassert_equal(offset, IMAGE_SIZE, "Unexpected final offset %zu", offset);
+
+	flash_verify();
+}
+
+ZTEST_SUITE(dfu_target_stream_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include "bs_tracing.h"
+#include "bs_types.h"
+#include "bstests.h"
+#include "time_machine.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/types.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/logging/log.h>
+
+#include <esb.h>
+
+#include "babblekit/testcase.h"
+
+LOG_MODULE_REGISTER(main, LOG_LEVEL_INF);
+
+#define PACKET_COUNT		2000
+#define PAYLOAD_LENGTH		CONFIG_ESB_MAX_PAYLOAD_LENGTH
+#define RX_BURST_SIZE		CONFIG_ESB_RX_FIFO_SIZE
+#define TEST_TIMEOUT		K_SECONDS(10)
+#define PRX_START_DELAY		K_MSEC(10)
+
+/* Minimum payload throughput at 2 Mbps with acknowledgments and fast ramp-up. */
+#define MIN_THROUGHPUT_KBPS	200
+
+static K_SEM_DEFINE(tx_done_sem, 0, 1);
+static K_SEM_DEFINE(rx_done_sem, 0, 1);
+
+static uint32_t tx_success_cnt;
+static uint32_t tx_failed_cnt;
+
+static struct esb_payload rx_burst[RX_BURST_SIZE];
+static uint32_t rx_cnt;
+static uint32_t rx_burst_max;
+static int64_t rx_start_time;
+static int64_t rx_end_time;
+static bool rx_sequence_error;
+
+static void ptx_event_handler(struct esb_evt const *event)
+{
+	switch (event->evt_id) {
+	case ESB_EVENT_TX_SUCCESS:
+		tx_success_cnt++;
+		break;
+	case ESB_EVENT_TX_FAILED:
+		tx_failed_cnt++;
+		break;
+	default:
+		break;
+	}
+
+	k_sem_give(&tx_done_sem);
+}
+
+static void prx_event_handler(struct esb_evt const *event)
+{
+	int ret;
+
+	if (event->evt_id != ESB_EVENT_RX_RECEIVED) {
+		return;
+	}
+
+	while ((ret = esb_read_rx_payloads(rx_burst, ARRAY_SIZE(rx_burst))) > 0) {
+		rx_burst_max = MAX(rx_burst_max, ret);
+
+		for (size_t i = 0; i < ret; i++) {
+			if ((rx_burst[i].length != PAYLOAD_LENGTH) ||
+			    (sys_get_le32(rx_burst[i].data) != rx_cnt)) {
+				rx_sequence_error = true;
+			}
+
+			if (rx_cnt == 0) {
+				rx_start_time = k_uptime_get();
+			}
+
+			rx_cnt++;
+		}
+
+		if (rx_cnt >= PACKET_COUNT) {
+			rx_end_time = k_uptime_get();
+			k_sem_give(&rx_done_sem);
+		}
+	}
+
+	TEST_ASSERT(ret == -ENODATA, "esb_read_rx_payloads failed (%d)", ret);
+}
+
+static void esb_setup(enum esb_mode mode, esb_event_handler handler)
+{
+	int err;
+	struct esb_config config = ESB_DEFAULT_CONFIG;
+
+	config.protocol = ESB_PROTOCOL_ESB_DPL;
+	config.bitrate = ESB_BITRATE_2MBPS;
+	config.mode = mode;
+	config.event_handler = handler;
+	config.selective_auto_ack = true;
+	config.use_fast_ramp_up = true;
+	config.retransmit_count = 10;
+
+	err = esb_init(&config);
+	TEST_ASSERT(!err, "esb_init failed (%d)", err);
+}
+
+static void ptx_throughput_test(void)
+{
+	int err;
+	uint32_t seq = 0;
+	struct esb_payload payload = {
+		.pipe = 0,
+		.length = PAYLOAD_LENGTH,
+		.noack = false,
+	};
+
+	esb_setup(ESB_MODE_PTX, ptx_event_handler);
+
+	/* Make sure the PRX is listening before the first packet is sent. */
+	k_sleep(PRX_START_DELAY);
+
+	while (seq < PACKET_COUNT) {
+		/* Keep the TX FIFO filled to send packets back to back. */
+		while ((seq < PACKET_COUNT) && !esb_tx_full()) {
+			memset(payload.data, (uint8_t)seq, sizeof(payload.data));
+			sys_put_le32(seq, payload.data);
+
+			err = esb_write_payload(&payload);
+			TEST_ASSERT(!err, "esb_write_payload failed (%d)", err);
+			seq++;
+		}
+
+		err = k_sem_take(&tx_done_sem, TEST_TIMEOUT);
+		TEST_ASSERT(!err, "TX timed out");
+		TEST_ASSERT(tx_failed_cnt == 0, "TX failed");
+	}
+
+	while (tx_success_cnt < PACKET_COUNT) {
+		err = k_sem_take(&tx_done_sem, TEST_TIMEOUT);
+		TEST_ASSERT(!err, "TX timed out");
+		TEST_ASSERT(tx_failed_cnt == 0, "TX failed");
+	}
+
+	TEST_PASS("PASS");
+}
+
+static void prx_throughput_test(void)
+{
+	int err;
+
+	esb_setup(ESB_MODE_PRX, prx_event_handler);
+
+	err = esb_start_rx();
+	TEST_ASSERT(!err, "esb_start_rx failed (%d)", err);
+
+	err = k_sem_take(&rx_done_sem, TEST_TIMEOUT);
+	TEST_ASSERT(!err, "RX timed out after %u packets", rx_cnt);
+	TEST_ASSERT(!rx_sequence_error, "Received packets are lost, repeated or corrupted");
+
+	int64_t duration_ms = MAX(rx_end_time - rx_start_time, 1);
+	uint32_t kbps = ((uint64_t)(rx_cnt - 1) * PAYLOAD_LENGTH * 8) / duration_ms;
+
+	LOG_INF("Received %u packets in %lld ms: %u kbps, up to %u packets per read",
+		rx_cnt, duration_ms, kbps, rx_burst_max);
+
+	TEST_ASSERT(kbps >= MIN_THROUGHPUT_KBPS, "Throughput too low (%u kbps)", kbps);
+
+	err = esb_stop_rx();
+	TEST_ASSERT(!err, "esb_stop_rx failed (%d)", err);
+
+	TEST_PASS("PASS");
+}
+
+static const struct bst_test_instance test_to_add[] = {
+	{
+		.test_id = "ptx_throughput_test",
+		.test_main_f = ptx_throughput_test,
+	},
+	{
+		.test_id = "prx_throughput_test",
+		.test_main_f = prx_throughput_test,
+	},
+	BSTEST_END_MARKER,
+};
+
+static struct bst_test_list *install(struct bst_test_list *tests)
+{
+	return bst_add_tests(tests, test_to_add);
+}
+
+bst_test_install_t test_installers[] = {install, NULL};
+
+int main(void)
+{
+	bst_main();
+	return 0;
+}
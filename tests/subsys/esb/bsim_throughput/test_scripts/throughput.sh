@@ -0,0 +1,23 @@
+#!/usr/bin/env bash
+# Copyright 2026 Nordic Semiconductor ASA
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+set -eu
+source ${ZEPHYR_BASE}/tests/bsim/sh_common.source
+
+verbosity_level=2
+simulation_id="esb_throughput"
+exe_name=./bs_${BOARD_TS}_tests_subsys_esb_bsim_throughput_prj_conf
+
+cd ${BSIM_OUT_PATH}/bin
+
+# Test sustained ESB throughput at 2 Mbps
+Execute "$exe_name" -v=${verbosity_level} \
+    -s="${simulation_id}" -d=0 -testid=ptx_throughput_test
+
+Execute "$exe_name" -v=${verbosity_level} \
+    -s="${simulation_id}" -d=1 -testid=prx_throughput_test
+
+Execute ./bs_2G4_phy_v1 -v=${verbosity_level} -s="${simulation_id}" -D=2 -sim_length=20e6 $@
+
+wait_for_background_jobs
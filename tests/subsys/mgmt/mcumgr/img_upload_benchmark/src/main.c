@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
+#include <zephyr/mgmt/mcumgr/smp/smp.h>
+#include <zephyr/mgmt/mcumgr/transport/smp_dummy.h>
+#include <zephyr/mgmt/mcumgr/grp/img_mgmt/img_mgmt.h>
+#include <zcbor_common.h>
+#include <zcbor_decode.h>
+#include <zcbor_encode.h>
+#include <mgmt/mcumgr/util/zcbor_bulk.h>
+
+#include "flash_benchmark.h"
+
+#define IMAGE_SIZE		(64 * 1024)
+#define IMAGE_HEADER_SIZE	0x200
+#define IMAGE_MAGIC		0x96f3b83d
+#define CHUNK_SIZE		256
+#define REQ_BUF_SIZE		(CHUNK_SIZE + 64)
+#define RESPONSE_TIMEOUT_S	5
+
+/* Time between the response to a request and the next request, for example one BLE
+ * connection interval.
+ */
+#define LINK_LATENCY		K_MSEC(5)
+
+#define SLOT_PARTITION_ID	FIXED_PARTITION_ID(slot1_partition)
+
+static uint8_t image[IMAGE_SIZE];
+static uint8_t req_buf[REQ_BUF_SIZE];
+static uint8_t read_buf[CHUNK_SIZE];
+
+static void image_generate(void)
+{
+	flash_benchmark_image_fill(image, sizeof(image));
+
+	/* Only the header fields checked by the image management group are valid. */
+	memset(image, 0, IMAGE_HEADER_SIZE);
+	sys_put_le32(IMAGE_MAGIC, &image[0]);
+	sys_put_le16(IMAGE_HEADER_SIZE, &image[8]);
+	sys_put_le32(IMAGE_SIZE - IMAGE_HEADER_SIZE, &image[12]);
+}
+
+static size_t upload_req_encode(size_t off, size_t len)
+{
+	struct smp_hdr *hdr = (struct smp_hdr *)req_buf;
+	uint8_t *payload = &req_buf[sizeof(*hdr)];
+	zcbor_state_t zse[2];
+	size_t payload_len;
+	bool ok;
+
+	zcbor_new_encode_state(zse, ARRAY_SIZE(zse), payload, sizeof(req_buf) - sizeof(*hdr), 0);
+
+	ok = zcbor_map_start_encode(zse, 4) &&
+	     zcbor_tstr_put_lit(zse, "image") && zcbor_uint32_put(zse, 0) &&
+	     zcbor_tstr_put_lit(zse, "off") && zcbor_size_put(zse, off);
+
+	if (off == 0) {
+		/* Image size is only sent with the first chunk. */
+		ok = ok && zcbor_tstr_put_lit(zse, "len") && zcbor_size_put(zse, IMAGE_SIZE);
+	}
+
+	ok = ok && zcbor_tstr_put_lit(zse, "data") &&
+	     zcbor_bstr_encode_ptr(zse, &image[off], len) &&
+	     zcbor_map_end_encode(zse, 4);
+
+	zassert_true(ok, "Failed to encode upload request");
+
+	payload_len = zse->payload - payload;
+
+	*hdr = (struct smp_hdr) {
+		.nh_op = MGMT_OP_WRITE,
+		.nh_version = 1,
+		.nh_len = sys_cpu_to_be16(payload_len),
+		.nh_group = sys_cpu_to_be16(MGMT_GROUP_ID_IMAGE),
+		.nh_id = IMG_MGMT_ID_UPLOAD,
+	};
+
+	return sizeof(*hdr) + payload_len;
+}
+
+static size_t upload_rsp_off_get(void)
+{
+	struct net_buf *nb;
+	zcbor_state_t zsd[4];
+	size_t decoded = 0;
+	size_t off = SIZE_MAX;
+	int rc;
+
+	struct zcbor_map_decode_key_val upload_rsp_decode[] = {
+		ZCBOR_MAP_DECODE_KEY_DECODER("off", zcbor_size_decode, &off),
+	};
+
+	zassert_true(smp_dummy_wait_for_data(RESPONSE_TIMEOUT_S), "No response to upload");
+
+	nb = smp_dummy_get_outgoing();
+	zassert_not_null(nb, "No response buffer");
+
+	zcbor_new_decode_state(zsd, ARRAY_SIZE(zsd), nb->data + sizeof(struct smp_hdr),
+			       nb->len - sizeof(struct smp_hdr), 1, NULL, 0);
+
+	rc = zcbor_map_decode_bulk(zsd, upload_rsp_decode, ARRAY_SIZE(upload_rsp_decode),
+				   &decoded);
+	zassert_equal(rc, 0, "Failed to decode upload response: %d", rc);
+	zassert_equal(decoded, 1, "Upload failed, no offset in response");
+
+	return off;
+}
+
+static void slot_verify(void)
+{
+	const struct flash_area *fa;
+	int rc;
+
+	rc = flash_area_open(SLOT_PARTITION_ID, &fa);
+	zassert_equal(rc, 0, "Failed to open image slot: %d", rc);
+
+	for (size_t off = 0; off < IMAGE_SIZE; off += sizeof(read_buf)) {
+		rc = flash_area_read(fa, off, read_buf, sizeof(read_buf));
+		zassert_equal(rc, 0, "Failed to read image slot: %d", rc);
+		zassert_mem_equal(read_buf, &image[off], sizeof(read_buf),
+				  "Image data mismatch at offset %zu", off);
+	}
+
+	flash_area_close(fa);
+}
+
+ZTEST(img_upload_benchmark, test_upload_throughput)
+{
+	size_t off = 0;
+	size_t len;
+	uint32_t req_cnt = 0;
+	int64_t start;
+
+	image_generate();
+	smp_dummy_enable();
+
+	start = k_uptime_get();
+
+	while (off < IMAGE_SIZE) {
+		len = MIN(CHUNK_SIZE, IMAGE_SIZE - off);
+
+		smp_dummy_clear_state();
+		(void)smp_dummy_tx_pkt(req_buf, upload_req_encode(off, len));
+		smp_dummy_add_data();
+
+		off = upload_rsp_off_get();
+		req_cnt++;
+
+		if (off < IMAGE_SIZE) {
+			/* The client sends the next chunk once the response has been received. */
+			k_sleep(LINK_LATENCY);
+		}
+	}
+
+	flash_benchmark_report("upload", IS_ENABLED(CONFIG_MCUMGR_GRP_IMG_NRF_WRITE_BEHIND),
+			       IMAGE_SIZE, start);
+	printk("Upload requests: %u\n", req_cnt);
+
+	smp_dummy_disable();
+
+	zassert_equal(off, IMAGE_SIZE, "Unexpected final offset %zu", off);
+	slot_verify();
+}
+
+ZTEST_SUITE(img_upload_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -2890,6 +2890,266 @@ void test_downloader_http_redirect_bad_location(void)
 	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
 }
 
+#if defined(CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL)
+/* Stand-in HTTP server for concurrent range requests. Each socket serves the ranges requested
+ * on it, a limited number of bytes per receive call.
+ */
+#define PAR_FILE_SIZE 4096
+#define PAR_RANGE 512
+#define PAR_CONNS 3
+#define PAR_FD_BASE 10
+#define PAR_RECV_CHUNK 256
+/* Each reorder buffer slot holds the response header and the range */
+#define PAR_SLOT_SIZE (CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL_HDR_SIZE + PAR_RANGE)
+
+#define HTTP_HDR_PARTIAL_CONTENT_FMT \
+"HTTP/1.1 206 Partial Content\r\n" \
+"Content-Type: application/octet-stream\r\n" \
+"Content-Length: %u\r\n" \
+"Connection: keep-alive\r\n" \
+"Content-Range: bytes %u-%u/%u\r\n\r\n"
+
+struct http_server_conn {
+	char rsp[PAR_RANGE + 256];
+	size_t rsp_len;
+	size_t rsp_off;
+};
+
+static struct http_server_conn http_server_conn[PAR_CONNS];
+static uint8_t par_file[PAR_FILE_SIZE];
+static uint8_t par_received[PAR_FILE_SIZE];
+static size_t par_received_len;
+static size_t par_range_requests;
+static size_t par_in_flight_max;
+static char reorder_buf[PAR_CONNS * PAR_SLOT_SIZE];
+
+static struct downloader_host_cfg dl_host_cfg_range_override = {
+	.pdn_id = 1,
+	.range_override = PAR_RANGE,
+};
+
+static int dl_callback_par(const struct downloader_evt *event)
+{
+	TEST_ASSERT(event != NULL);
+
+	if (event->id == DOWNLOADER_EVT_FRAGMENT) {
+		TEST_ASSERT(par_received_len + event->fragment.len <= sizeof(par_received));
+		memcpy(&par_received[par_received_len], event->fragment.buf, event->fragment.len);
+		par_received_len += event->fragment.len;
+		return 0;
+	}
+
+	return dl_callback(event);
+}
+
+struct downloader_cfg dl_cfg_par = {
+	.callback = dl_callback_par,
+	.buf = dl_buf,
+	.buf_size = sizeof(dl_buf),
+};
+
+static void http_server_reset(void)
+{
+	memset(http_server_conn, 0, sizeof(http_server_conn));
+
+	for (size_t i = 0; i < sizeof(par_file); i++) {
+		par_file[i] = (uint8_t)(i * 7);
+	}
+
+	memset(par_received, 0, sizeof(par_received));
+	par_received_len = 0;
+	par_range_requests = 0;
+	par_in_flight_max = 0;
+}
+
+int z_impl_zsock_socket_http_par(int family, int type, int proto)
+{
+	TEST_ASSERT_EQUAL(NET_SOCK_STREAM, type);
+	TEST_ASSERT_EQUAL(NET_IPPROTO_TCP, proto);
+	TEST_ASSERT(z_impl_zsock_socket_fake.call_count <= PAR_CONNS);
+
+	return PAR_FD_BASE + z_impl_zsock_socket_fake.call_count - 1;
+}
+
+int z_impl_zsock_connect_http_par(int sock, const struct net_sockaddr *addr,
+				  net_socklen_t addrlen)
+{
+	TEST_ASSERT(sock >= PAR_FD_BASE && sock < PAR_FD_BASE + PAR_CONNS);
+	return 0;
+}
+
+ssize_t z_impl_zsock_sendto_http_server(int sock, const void *buf, size_t len, int flags,
+					const struct net_sockaddr *dest_addr,
+					net_socklen_t addrlen)
+{
+	struct http_server_conn *conn = &http_server_conn[sock - PAR_FD_BASE];
+	char req[256];
+	char *p;
+	unsigned int start, end;
+	size_t in_flight = 0;
+	int hdr_len;
+
+	TEST_ASSERT(sock >= PAR_FD_BASE && sock < PAR_FD_BASE + PAR_CONNS);
+	TEST_ASSERT(len < sizeof(req));
+	/* A new request is only sent once the previous response has been read */
+	TEST_ASSERT_EQUAL(conn->rsp_len, conn->rsp_off);
+
+	memcpy(req, buf, len);
+	req[len] = '\0';
+
+	p = strstr(req, "Range: bytes=");
+	TEST_ASSERT_NOT_NULL(p);
+	TEST_ASSERT_EQUAL(2, sscanf(p, "Range: bytes=%u-%u", &start, &end));
+	TEST_ASSERT(start <= end && end < PAR_FILE_SIZE);
+	TEST_ASSERT(end - start < PAR_RANGE);
+
+	hdr_len = snprintf(conn->rsp, sizeof(conn->rsp), HTTP_HDR_PARTIAL_CONTENT_FMT,
+			   end - start + 1, start, end, PAR_FILE_SIZE);
+	memcpy(&conn->rsp[hdr_len], &par_file[start], end - start + 1);
+	conn->rsp_len = hdr_len + end - start + 1;
+	conn->rsp_off = 0;
+
+	par_range_requests++;
+
+	for (size_t i = 0; i < PAR_CONNS; i++) {
+		if (http_server_conn[i].rsp_off < http_server_conn[i].rsp_len) {
+			in_flight++;
+		}
+	}
+
+	par_in_flight_max = MAX(par_in_flight_max, in_flight);
+
+	return len;
+}
+
+static ssize_t z_impl_zsock_recvfrom_http_server(
+	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
+	net_socklen_t *addrlen)
+{
+	struct http_server_conn *conn = &http_server_conn[sock - PAR_FD_BASE];
+	size_t len;
+
+	TEST_ASSERT(sock >= PAR_FD_BASE && sock < PAR_FD_BASE + PAR_CONNS);
+
+	if (conn->rsp_off == conn->rsp_len) {
+		/* Only ranges ahead of the progress are polled */
+		TEST_ASSERT(flags & ZSOCK_MSG_DONTWAIT);
+		errno = EAGAIN;
+		return -1;
+	}
+
+	len = MIN(MIN(max_len, PAR_RECV_CHUNK), conn->rsp_len - conn->rsp_off);
+	memcpy(buf, &conn->rsp[conn->rsp_off], len);
+	conn->rsp_off += len;
+
+	return len;
+}
+#endif /* CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL */
+
+void test_downloader_transport_http_set_config_range_conns_enotsup(void)
+{
+#if defined(CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL)
+	TEST_IGNORE_MESSAGE("CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL set");
+#else
+	int err;
+	char buf[16];
+	struct downloader_transport_http_cfg cfg = {
+		.range_conns = 2,
+		.reorder_buf = buf,
+		.reorder_buf_size = sizeof(buf),
+	};
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	err = downloader_transport_http_set_config(&dl, &cfg);
+	TEST_ASSERT_EQUAL(-ENOTSUP, err);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+#endif
+}
+
+void test_downloader_transport_http_set_config_range_conns_einval(void)
+{
+#if !defined(CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL)
+	TEST_IGNORE_MESSAGE("CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL not set");
+#else
+	int err;
+	struct downloader_transport_http_cfg cfg = {
+		.range_conns = PAR_CONNS,
+	};
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* No reorder buffer */
+	err = downloader_transport_http_set_config(&dl, &cfg);
+	TEST_ASSERT_EQUAL(-EINVAL, err);
+
+	cfg.reorder_buf = reorder_buf;
+	cfg.reorder_buf_size = sizeof(reorder_buf);
+	cfg.range_conns = CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL_CONNS_MAX + 1;
+	err = downloader_transport_http_set_config(&dl, &cfg);
+	TEST_ASSERT_EQUAL(-EINVAL, err);
+
+	/* No room for data after the response header */
+	cfg.range_conns = PAR_CONNS;
+	cfg.reorder_buf_size = PAR_CONNS * CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL_HDR_SIZE;
+	err = downloader_transport_http_set_config(&dl, &cfg);
+	TEST_ASSERT_EQUAL(-EINVAL, err);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+#endif
+}
+
+void test_downloader_get_http_range_conns(void)
+{
+#if !defined(CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL)
+	TEST_IGNORE_MESSAGE("CONFIG_DOWNLOADER_TRANSPORT_HTTP_PARALLEL not set");
+#else
+	int err;
+	struct downloader_transport_http_cfg cfg = {
+		.sock_recv_timeo_ms = 60000,
+		.range_conns = PAR_CONNS,
+		.reorder_buf = reorder_buf,
+		.reorder_buf_size = sizeof(reorder_buf),
+	};
+
+	http_server_reset();
+
+	err = downloader_init(&dl, &dl_cfg_par);
+	TEST_ASSERT_EQUAL(0, err);
+
+	err = downloader_transport_http_set_config(&dl, &cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ipv6_fail_ipv4_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv4;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_http_par;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_http_par;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_http_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_http_server;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_http_server;
+
+	err = downloader_get(&dl, &dl_host_cfg_range_override, HTTP_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	/* Every range is requested once, and delivered in order */
+	TEST_ASSERT_EQUAL(PAR_FILE_SIZE / PAR_RANGE, par_range_requests);
+	TEST_ASSERT_EQUAL(PAR_CONNS, par_in_flight_max);
+	TEST_ASSERT_EQUAL(PAR_CONNS, z_impl_zsock_socket_fake.call_count);
+	TEST_ASSERT_EQUAL(PAR_FILE_SIZE, par_received_len);
+	TEST_ASSERT_EQUAL_MEMORY(par_file, par_received, PAR_FILE_SIZE);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+#endif
+}
+
 void setUp(void)
 {
 	RESET_FAKE(z_impl_zsock_setsockopt);
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/printk.h>
+#include <net/icalendar_parser.h>
+
+#include "host_clock.h"
+
+/* Size of the generated calendars. */
+#define CALENDAR_SIZE		(4 * 1024 * 1024)
+/* Largest fragment passed to the parser, like a downloader fragment. */
+#define FRAGMENT_SIZE_MAX	2048
+/* RFC 5545 content lines are folded after 75 octets. */
+#define FOLD_LEN		75
+
+static struct icalendar_parser ical;
+
+static struct {
+	char buf[FRAGMENT_SIZE_MAX];
+	size_t len;
+	size_t target_len;
+	uint32_t rand_state;
+	/* Total bytes of the calendar and bytes consumed by the parser. */
+	size_t total;
+	size_t parsed;
+	uint64_t parse_ns;
+	/* The parser has stopped, so the download is stopped. */
+	bool stopped;
+} download;
+
+static struct {
+	size_t count;
+	size_t errors;
+	/* Index of the last event, taken from its summary. */
+	long last_index;
+	bool in_order;
+} result;
+
+static size_t fragment_len_next(void)
+{
+	/* Fragment sizes vary like TCP segments received by the downloader. */
+	download.rand_state = download.rand_state * 1103515245 + 12345;
+
+	return 1 + ((download.rand_state >> 16) % FRAGMENT_SIZE_MAX);
+}
+
+static void fragment_parse(void)
+{
+	uint64_t start = host_clock_ns();
+	size_t parsed;
+
+	parsed = ical_parser_parse(&ical, download.buf, download.len);
+	download.parse_ns += host_clock_ns() - start;
+	download.parsed += parsed;
+	download.stopped = (parsed < download.len);
+	download.len = 0;
+	download.target_len = fragment_len_next();
+}
+
+/* Pass the calendar text to the parser in fragments of varying size. */
+static void download_write(const char *data, size_t len)
+{
+	while (len > 0 && !download.stopped) {
+		size_t n = MIN(len, download.target_len - download.len);
+
+		memcpy(download.buf + download.len, data, n);
+		download.len += n;
+		download.total += n;
+		data += n;
+		len -= n;
+
+		if (download.len == download.target_len) {
+			fragment_parse();
+		}
+	}
+}
+
+static void contentline_write(const char *line)
+{
+	size_t len = strlen(line);
+
+	/* Folded lines continue with a line break and a single space. */
+	while (len > FOLD_LEN) {
+		download_write(line, FOLD_LEN);
+		download_write("\r\n ", 3);
+		line += FOLD_LEN;
+		len -= FOLD_LEN;
+	}
+
+	download_write(line, len);
+	download_write("\r\n", 2);
+}
+
+static void event_write(size_t index)
+{
+	char line[320];
+
+	contentline_write("BEGIN:VEVENT");
+	snprintf(line, sizeof(line), "UID:%zu-benchmark@nordicsemi.com", index);
+	contentline_write(line);
+	contentline_write("DTSTAMP:20260101T000000Z");
+	snprintf(line, sizeof(line), "DTSTART;TZID=Europe/Oslo:2026%02zu%02zuT%02zu0000",
+		 1 + (index / 28) % 12, 1 + index % 28, 8 + index % 9);
+	contentline_write(line);
+	snprintf(line, sizeof(line), "DTEND;TZID=Europe/Oslo:2026%02zu%02zuT%02zu3000",
+		 1 + (index / 28) % 12, 1 + index % 28, 8 + index % 9);
+	contentline_write(line);
+	snprintf(line, sizeof(line), "SUMMARY:Event %zu", index);
+	contentline_write(line);
+	contentline_write("LOCATION:Trondheim\\, Norway");
+	snprintf(line, sizeof(line), "DESCRIPTION:Agenda for event %zu. This description is "
+		 "long enough to be folded over several content lines\\, like the descriptions "
+		 "in shared calendars usually are\\, with a list of participants and a link to "
+		 "the meeting room booking and the minutes of the previous meeting.", index);
+	contentline_write(line);
+	contentline_write("BEGIN:VALARM");
+	contentline_write("ACTION:DISPLAY");
+	contentline_write("SUMMARY:Reminder");
+	contentline_write("TRIGGER:-PT10M");
+	contentline_write("END:VALARM");
+	contentline_write("END:VEVENT");
+}
+
+static size_t calendar_write(size_t size)
+{
+	size_t index = 0;
+
+	contentline_write("BEGIN:VCALENDAR");
+	contentline_write("VERSION:2.0");
+	contentline_write("PRODID:-//Nordic Semiconductor//iCalendar benchmark//EN");
+
+	while (download.total < size && !download.stopped) {
+		event_write(index++);
+	}
+
+	contentline_write("END:VCALENDAR");
+
+	if (download.len > 0) {
+		fragment_parse();
+	}
+
+	return index;
+}
+
+static int benchmark_callback(const struct ical_parser_evt *event)
+{
+	long index;
+
+	if (event->error != ICAL_ERROR_NONE) {
+		result.errors++;
+	}
+
+	index = strtol(event->ical_com.summary + strlen("Event "), NULL, 10);
+	if (index != result.last_index + 1) {
+		result.in_order = false;
+	}
+
+	result.last_index = index;
+	result.count++;
+
+	return 0;
+}
+
+static void benchmark_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(&download, 0, sizeof(download));
+	download.rand_state = 1;
+	download.target_len = fragment_len_next();
+
+	memset(&result, 0, sizeof(result));
+	result.last_index = -1;
+	result.in_order = true;
+
+	zassert_ok(ical_parser_init(&ical, benchmark_callback));
+}
+
+ZTEST(icalendar_parser_benchmark, test_parse_large_calendar)
+{
+	size_t events;
+	uint64_t ns;
+
+	events = calendar_write(CALENDAR_SIZE);
+	ns = MAX(download.parse_ns, 1);
+
+	printk("%zu bytes, %zu events parsed in %llu ms with %zu bytes of parser state\n",
+	       download.total, result.count, ns / 1000000, sizeof(ical));
+	printk("  %llu kB/s, %llu ns per event\n",
+	       (uint64_t)download.total * 1000000 / ns, ns / MAX(result.count, 1));
+
+	zassert_equal(download.parsed, download.total);
+	zassert_equal(result.count, events);
+	zassert_equal(result.errors, 0);
+	zassert_true(result.in_order);
+}
+
+/* Only the first events are needed, so the download is stopped with the parser. */
+ZTEST(icalendar_parser_benchmark, test_parse_first_events)
+{
+	const size_t max_events = 10;
+
+	ical_parser_max_events_set(&ical, max_events);
+
+	calendar_write(CALENDAR_SIZE);
+
+	printk("Stopped after %zu events, %zu of %zu bytes parsed in %llu us\n",
+	       result.count, download.parsed, download.total, download.parse_ns / 1000);
+
+	zassert_equal(result.count, max_events);
+	zassert_true(download.total < CALENDAR_SIZE / 100);
+	zassert_true(result.in_order);
+}
+
+ZTEST_SUITE(icalendar_parser_benchmark, NULL, NULL, benchmark_before, NULL, NULL);
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <net/icalendar_parser.h>
+
+#define MAX_EVENTS 16
+
+static struct icalendar_parser ical;
+static struct ical_parser_evt events[MAX_EVENTS];
+static size_t event_count;
+/* Number of events after which the callback stops parsing, or 0. */
+static size_t stop_after;
+
+static const char calendar[] =
+	"BEGIN:VCALENDAR\r\n"
+	"VERSION:2.0\r\n"
+	"PRODID:-//Nordic Semiconductor//iCalendar test//EN\r\n"
+	"BEGIN:VTIMEZONE\r\n"
+	"TZID:Europe/Oslo\r\n"
+	"BEGIN:STANDARD\r\n"
+	"DTSTART:19701025T030000\r\n"
+	"TZOFFSETFROM:+0200\r\n"
+	"TZOFFSETTO:+0100\r\n"
+	"END:STANDARD\r\n"
+	"END:VTIMEZONE\r\n"
+	"BEGIN:VEVENT\r\n"
+	"UID:1@nordicsemi.com\r\n"
+	"DTSTART;TZID=Europe/Oslo:20260512T090000\r\n"
+	"DTEND;TZID=Europe/Oslo:20260512T100000\r\n"
+	"SUMMARY:Sprint planning\r\n"
+	"LOCATION:Room 4\r\n"
+	"DESCRIPTION:Plan the next sprint. The description of this event is long en\r\n"
+	" ough to be folded over several lines\\, as required by RFC 5545 for conte\r\n"
+	"\tnt lines longer than 75 octets.\r\n"
+	"BEGIN:VALARM\r\n"
+	"ACTION:DISPLAY\r\n"
+	"SUMMARY:Alarm summary\r\n"
+	"TRIGGER:-PT15M\r\n"
+	"END:VALARM\r\n"
+	"END:VEVENT\r\n"
+	"BEGIN:X-NORDIC-NOTE\r\n"
+	"SUMMARY:Not an event\r\n"
+	"END:X-NORDIC-NOTE\r\n"
+	"BEGIN:VTODO\r\n"
+	"SUMMARY:Write report\r\n"
+	"END:VTODO\r\n"
+	"BEGIN:VEVENT\r\n"
+	"DTSTART;TZID=\"Europe/Oslo:quoted\":20260513T120000\r\n"
+	"dtend:20260513T130000Z\r\n"
+	"Summary:Lunch\r\n"
+	"END:VEVENT\r\n"
+	"END:VCALENDAR\r\n";
+
+static const char description[] =
+	"Plan the next sprint. The description of this event is long enough to be folded "
+	"over several lines\\, as required by RFC 5545 for content lines longer than 75 octets.";
+
+static int parser_callback(const struct ical_parser_evt *event)
+{
+	zassert_true(event_count < MAX_EVENTS);
+
+	events[event_count++] = *event;
+
+	return (stop_after > 0 && event_count >= stop_after) ? 1 : 0;
+}
+
+static size_t parse_in_fragments(const char *data, size_t len, size_t fragment_len)
+{
+	size_t parsed = 0;
+
+	while (parsed < len) {
+		size_t fragment = MIN(fragment_len, len - parsed);
+		size_t ret = ical_parser_parse(&ical, data + parsed, fragment);
+
+		parsed += ret;
+		if (ret < fragment) {
+			break;
+		}
+	}
+
+	return parsed;
+}
+
+static void verify_calendar_events(void)
+{
+	zassert_equal(event_count, 4);
+
+	zassert_equal(events[0].id, ICAL_EVT_VTIMEZONE);
+	zassert_equal(events[0].error, ICAL_ERROR_COM_NOT_SUPPORTED);
+
+	zassert_equal(events[1].id, ICAL_EVT_VEVENT);
+	zassert_equal(events[1].error, ICAL_ERROR_NONE);
+	zassert_str_equal(events[1].ical_com.summary, "Sprint planning");
+	zassert_str_equal(events[1].ical_com.location, "Room 4");
+	zassert_str_equal(events[1].ical_com.description, description);
+	zassert_str_equal(events[1].ical_com.dtstart, "20260512T090000");
+	zassert_str_equal(events[1].ical_com.dtend, "20260512T100000");
+
+	zassert_equal(events[2].id, ICAL_EVT_VTODO);
+	zassert_equal(events[2].error, ICAL_ERROR_COM_NOT_SUPPORTED);
+
+	zassert_equal(events[3].id, ICAL_EVT_VEVENT);
+	zassert_equal(events[3].error, ICAL_ERROR_NONE);
+	zassert_str_equal(events[3].ical_com.summary, "Lunch");
+	zassert_str_equal(events[3].ical_com.location, "");
+	zassert_str_equal(events[3].ical_com.dtstart, "20260513T120000");
+	zassert_str_equal(events[3].ical_com.dtend, "20260513T130000Z");
+}
+
+static void parse_one_event(const char *vevent)
+{
+	static char buf[512];
+
+	snprintf(buf, sizeof(buf), "BEGIN:VCALENDAR\r\nBEGIN:VEVENT\r\n%sEND:VEVENT\r\n"
+		 "END:VCALENDAR\r\n", vevent);
+
+	zassert_equal(ical_parser_parse(&ical, buf, strlen(buf)), strlen(buf));
+	zassert_equal(event_count, 1);
+	zassert_equal(events[0].id, ICAL_EVT_VEVENT);
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(events, 0, sizeof(events));
+	event_count = 0;
+	stop_after = 0;
+
+	zassert_ok(ical_parser_init(&ical, parser_callback));
+}
+
+ZTEST(icalendar_parser, test_init_invalid)
+{
+	zassert_equal(ical_parser_init(NULL, parser_callback), -EINVAL);
+	zassert_equal(ical_parser_init(&ical, NULL), -EINVAL);
+}
+
+ZTEST(icalendar_parser, test_parse_calendar)
+{
+	size_t len = sizeof(calendar) - 1;
+
+	zassert_equal(ical_parser_parse(&ical, calendar, len), len);
+	verify_calendar_events();
+}
+
+/* The calendar is split at every possible position, including inside line breaks
+ * and between a line break and the whitespace of a folded line.
+ */
+ZTEST(icalendar_parser, test_parse_split_anywhere)
+{
+	size_t len = sizeof(calendar) - 1;
+
+	for (size_t split = 1; split < len; split++) {
+		test_before(NULL);
+
+		zassert_equal(ical_parser_parse(&ical, calendar, split), split);
+		zassert_equal(ical_parser_parse(&ical, calendar + split, len - split), len - split);
+		verify_calendar_events();
+	}
+}
+
+ZTEST(icalendar_parser, test_parse_fragments)
+{
+	size_t len = sizeof(calendar) - 1;
+
+	for (size_t fragment_len = 1; fragment_len <= 64; fragment_len++) {
+		test_before(NULL);
+
+		zassert_equal(parse_in_fragments(calendar, len, fragment_len), len);
+		verify_calendar_events();
+	}
+}
+
+ZTEST(icalendar_parser, test_parse_lf_line_breaks)
+{
+	static char buf[sizeof(calendar)];
+	size_t len = 0;
+
+	for (const char *c = calendar; *c != '\0'; c++) {
+		if (*c != '\r') {
+			buf[len++] = *c;
+		}
+	}
+
+	zassert_equal(ical_parser_parse(&ical, buf, len), len);
+	verify_calendar_events();
+}
+
+/* Components before the beginning of the calendar object are ignored. */
+ZTEST(icalendar_parser, test_parse_before_calendar)
+{
+	static const char data[] =
+		"BEGIN:VEVENT\r\n"
+		"SUMMARY:Outside\r\n"
+		"END:VEVENT\r\n";
+
+	zassert_equal(ical_parser_parse(&ical, data, strlen(data)), strlen(data));
+	zassert_equal(ical_parser_parse(&ical, calendar, strlen(calendar)), strlen(calendar));
+	verify_calendar_events();
+}
+
+ZTEST(icalendar_parser, test_summary_overflow)
+{
+	parse_one_event("SUMMARY:This summary is longer than the sixty-four characters of the "
+			"summary buffer\r\n"
+			"LOCATION:Room 4\r\n");
+
+	zassert_equal(events[0].error, ICAL_ERROR_SUMMARY);
+}
+
+ZTEST(icalendar_parser, test_location_param)
+{
+	parse_one_event("LOCATION;LANGUAGE=en:Room 4\r\n");
+
+	zassert_equal(events[0].error, ICAL_ERROR_LOCATION);
+}
+
+ZTEST(icalendar_parser, test_dtstart_no_value)
+{
+	parse_one_event("DTSTART;VALUE=DATE\r\n");
+
+	zassert_equal(events[0].error, ICAL_ERROR_DTSTART);
+}
+
+/* A content line longer than the line buffer is reported as an error for the property,
+ * and parsing continues with the next content line.
+ */
+ZTEST(icalendar_parser, test_line_overflow)
+{
+	static char vevent[CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE + 64];
+	size_t len;
+
+	len = snprintf(vevent, sizeof(vevent), "DESCRIPTION:");
+	while (len < CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE + 8) {
+		vevent[len++] = 'x';
+	}
+	strcpy(&vevent[len], "\r\nSUMMARY:After\r\n");
+
+	zassert_equal(ical_parser_parse(&ical, "BEGIN:VCALENDAR\r\nBEGIN:VEVENT\r\n", 31), 31);
+	zassert_equal(ical_parser_parse(&ical, vevent, strlen(vevent)), strlen(vevent));
+	zassert_equal(ical_parser_parse(&ical, "END:VEVENT\r\n\r\n", 14), 14);
+
+	zassert_equal(event_count, 1);
+	zassert_equal(events[0].error, ICAL_ERROR_DESCRIPTION);
+}
+
+ZTEST(icalendar_parser, test_max_events)
+{
+	size_t len = sizeof(calendar) - 1;
+	size_t parsed;
+
+	ical_parser_max_events_set(&ical, 2);
+
+	parsed = ical_parser_parse(&ical, calendar, len);
+	zassert_true(parsed < len);
+	zassert_equal(event_count, 2);
+	zassert_equal(events[1].id, ICAL_EVT_VEVENT);
+
+	/* The rest of the data stream is not parsed. */
+	zassert_equal(ical_parser_parse(&ical, calendar + parsed, len - parsed), 0);
+	zassert_equal(event_count, 2);
+}
+
+ZTEST(icalendar_parser, test_callback_stops_parsing)
+{
+	size_t len = sizeof(calendar) - 1;
+
+	stop_after = 3;
+
+	zassert_true(parse_in_fragments(calendar, len, 16) < len);
+	zassert_equal(event_count, 3);
+	zassert_equal(events[2].id, ICAL_EVT_VTODO);
+}
+
+ZTEST_SUITE(icalendar_parser, NULL, NULL, test_before, NULL, NULL);
@@ -50,6 +50,7 @@ extern void mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 extern void mqtt_helper_poll_loop(void);
 extern void on_publish(const struct mqtt_evt *mqtt_evt);
 extern char payload_buf[];
+extern uint16_t publish_window[];
 
 /* Fake addrinfo entries returned from the mocked zsock_getaddrinfo(). */
 static struct net_sockaddr_in test_sockaddr_in = {
@@ -70,6 +71,36 @@ static K_SEM_DEFINE(puback_sem, 0, 1);
 static K_SEM_DEFINE(suback_sem, 0, 1);
 static K_SEM_DEFINE(publish_sem, 0, 1);
 static K_SEM_DEFINE(error_msg_size_sem, 0, 1);
+static K_SEM_DEFINE(error_msg_incomplete_sem, 0, 1);
+
+/* Size of the payload sent by the broker stand-in, spanning several payload buffers. */
+#define TEST_STREAM_PAYLOAD_LEN	(3 * CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN + 100)
+#define TEST_STREAM_FRAGMENTS	4
+
+/* Stand-in for the MQTT broker. The mocked MQTT library hands out the payload of the message
+ * being delivered when the payload is read, and the broker records the messages published by
+ * the client and the PUBACKs it receives.
+ */
+static struct {
+	uint8_t payload[TEST_STREAM_PAYLOAD_LEN];
+	size_t payload_len;
+	size_t read_offset;
+	/* Offset in the payload where the connection is lost, or SIZE_MAX. */
+	size_t fail_offset;
+	uint16_t pubacks_received[8];
+	size_t puback_count;
+	uint16_t published[8];
+	size_t publish_count;
+} broker;
+
+/* Payload reassembled from the fragments passed to the application. */
+static struct {
+	uint8_t payload[TEST_STREAM_PAYLOAD_LEN];
+	size_t fragment_count;
+	size_t received;
+	/* Offset of the fragment that is rejected by the application, or SIZE_MAX. */
+	size_t reject_offset;
+} app;
 
 void setUp(void)
 {
@@ -96,6 +127,42 @@ static int mqtt_readall_publish_payload_stub(struct mqtt_client *client, uint8_t
 	return 0;
 }
 
+static int broker_readall_stub(struct mqtt_client *client, uint8_t *buffer,
+			       size_t length, int num_calls)
+{
+	TEST_ASSERT_TRUE(broker.read_offset + length <= broker.payload_len);
+
+	if (broker.fail_offset < broker.read_offset + length) {
+		broker.read_offset = broker.payload_len;
+		return -ENOTCONN;
+	}
+
+	memcpy(buffer, &broker.payload[broker.read_offset], length);
+	broker.read_offset += length;
+
+	return 0;
+}
+
+static int broker_puback_stub(struct mqtt_client *client, const struct mqtt_puback_param *param,
+			      int num_calls)
+{
+	TEST_ASSERT_TRUE(broker.puback_count < ARRAY_SIZE(broker.pubacks_received));
+
+	broker.pubacks_received[broker.puback_count++] = param->message_id;
+
+	return 0;
+}
+
+static int broker_publish_stub(struct mqtt_client *client, const struct mqtt_publish_param *param,
+			       int num_calls)
+{
+	TEST_ASSERT_TRUE(broker.publish_count < ARRAY_SIZE(broker.published));
+
+	broker.published[broker.publish_count++] = param->message_id;
+
+	return 0;
+}
+
 static int poll_stub_pollin(struct zsock_pollfd *fds, int nfds, int timeout, int num_calls)
 {
 	fds[0].revents = fds[0].events & ZSOCK_POLLIN;
@@ -153,6 +220,47 @@ static void send_publish_event(int message_id)
 	mqtt_evt_handler(&mqtt_client, &evt);
 }
 
+static void broker_send_publish(size_t payload_len, enum mqtt_qos qos)
+{
+	struct mqtt_evt evt = {
+		.type = MQTT_EVT_PUBLISH,
+		.result = 0,
+		.param.publish.message_id = TEST_MESSAGE_ID,
+		.param.publish.message = {
+			.topic = {
+				.topic = {
+					.utf8 = TEST_TOPIC_1,
+					.size = TEST_TOPIC_1_LEN,
+				},
+				.qos = qos,
+			},
+			.payload = {
+				.len = payload_len,
+			},
+		}
+	};
+
+	broker.payload_len = payload_len;
+	broker.read_offset = 0;
+
+	for (size_t i = 0; i < payload_len; i++) {
+		broker.payload[i] = (uint8_t)((i * 31) % 251);
+	}
+
+	mqtt_evt_handler(&mqtt_client, &evt);
+}
+
+static void broker_send_puback(uint16_t message_id)
+{
+	struct mqtt_evt evt = {
+		.type = MQTT_EVT_PUBACK,
+		.result = 0,
+		.param.puback.message_id = message_id,
+	};
+
+	mqtt_evt_handler(&mqtt_client, &evt);
+}
+
 static void send_mqtt_event(enum mqtt_evt_type type, int optional_data)
 {
 	struct mqtt_evt evt = {
@@ -238,6 +346,88 @@ static void cb_on_error(enum mqtt_helper_error error)
 	}
 }
 
+static void cb_on_error_streaming(enum mqtt_helper_error error)
+{
+	if (error == MQTT_HELPER_ERROR_MSG_INCOMPLETE) {
+		k_sem_give(&error_msg_incomplete_sem);
+	}
+}
+
+static int cb_on_publish_fragment(struct mqtt_helper_buf topic, struct mqtt_helper_buf fragment,
+				  size_t offset, size_t total_len)
+{
+	TEST_ASSERT_EQUAL(TEST_TOPIC_1_LEN, topic.size);
+	TEST_ASSERT_EQUAL_MEMORY(TEST_TOPIC_1, topic.ptr, TEST_TOPIC_1_LEN);
+	TEST_ASSERT_EQUAL(broker.payload_len, total_len);
+	TEST_ASSERT_EQUAL(app.received, offset);
+	TEST_ASSERT_TRUE(fragment.size <= CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN);
+
+	/* Backpressure: nothing beyond this fragment has been read from the broker yet,
+	 * and the message is not acknowledged before the whole payload is accepted.
+	 */
+	TEST_ASSERT_EQUAL(offset + fragment.size, broker.read_offset);
+	TEST_ASSERT_EQUAL(0, broker.puback_count);
+
+	app.fragment_count++;
+
+	if (offset == app.reject_offset) {
+		return -ENOMEM;
+	}
+
+	memcpy(&app.payload[offset], fragment.ptr, fragment.size);
+	app.received += fragment.size;
+
+	return 0;
+}
+
+static void streaming_init(void)
+{
+	struct mqtt_helper_cfg cfg = {
+		.cb = {
+			.on_publish = cb_on_publish,
+			.on_publish_fragment = cb_on_publish_fragment,
+			.on_error = cb_on_error_streaming,
+		},
+	};
+
+	memset(&broker, 0, sizeof(broker));
+	memset(&app, 0, sizeof(app));
+	broker.fail_offset = SIZE_MAX;
+	app.reject_offset = SIZE_MAX;
+
+	__cmock_mqtt_client_init_Expect(&mqtt_client);
+	__cmock_mqtt_readall_publish_payload_Stub(broker_readall_stub);
+	__cmock_mqtt_publish_qos1_ack_Stub(broker_puback_stub);
+	__cmock_mqtt_publish_Stub(broker_publish_stub);
+
+	TEST_ASSERT_EQUAL(0, mqtt_helper_init(&cfg));
+
+	mqtt_state = MQTT_STATE_CONNECTED;
+}
+
+static int publish_qos(uint16_t message_id, enum mqtt_qos qos, bool dup)
+{
+	struct mqtt_publish_param pub_param = {
+		.message = {
+			.payload = {
+				.data = TEST_PAYLOAD,
+				.len = TEST_PAYLOAD_LEN,
+			},
+			.topic = {
+				.topic = {
+					.utf8 = TEST_TOPIC_1,
+					.size = TEST_TOPIC_1_LEN,
+				},
+				.qos = qos,
+			},
+		},
+		.message_id = message_id,
+		.dup_flag = dup,
+	};
+
+	return mqtt_helper_publish(&pub_param);
+}
+
 /* Tests */
 
 void test_mqtt_helper_init_when_unitialized(void)
@@ -631,6 +821,128 @@ void test_mqtt_helper_poll_loop_pollerr(void)
 	mqtt_helper_poll_loop();
 }
 
+/* The broker sends a payload several times larger than the payload buffer. The test verifies
+ * that the payload is passed to the application in order, one buffer at a time, and that the
+ * message is acknowledged after the last fragment.
+ */
+void test_on_publish_streamed_in_fragments(void)
+{
+	streaming_init();
+
+	broker_send_publish(TEST_STREAM_PAYLOAD_LEN, MQTT_QOS_1_AT_LEAST_ONCE);
+
+	TEST_ASSERT_EQUAL(TEST_STREAM_FRAGMENTS, app.fragment_count);
+	TEST_ASSERT_EQUAL(TEST_STREAM_PAYLOAD_LEN, app.received);
+	TEST_ASSERT_EQUAL_MEMORY(broker.payload, app.payload, TEST_STREAM_PAYLOAD_LEN);
+	TEST_ASSERT_EQUAL(1, broker.puback_count);
+	TEST_ASSERT_EQUAL(TEST_MESSAGE_ID, broker.pubacks_received[0]);
+}
+
+void test_on_publish_streamed_qos0_not_acknowledged(void)
+{
+	streaming_init();
+
+	broker_send_publish(TEST_STREAM_PAYLOAD_LEN, MQTT_QOS_0_AT_MOST_ONCE);
+
+	TEST_ASSERT_EQUAL(TEST_STREAM_PAYLOAD_LEN, app.received);
+	TEST_ASSERT_EQUAL(0, broker.puback_count);
+}
+
+void test_on_publish_streamed_empty_payload(void)
+{
+	streaming_init();
+
+	broker_send_publish(0, MQTT_QOS_1_AT_LEAST_ONCE);
+
+	TEST_ASSERT_EQUAL(1, app.fragment_count);
+	TEST_ASSERT_EQUAL(0, app.received);
+	TEST_ASSERT_EQUAL(1, broker.puback_count);
+}
+
+/* The application rejects the second fragment. The rest of the payload must still be read
+ * from the broker, but not passed to the application, and the message must not be acknowledged.
+ */
+void test_on_publish_streamed_rejected(void)
+{
+	streaming_init();
+	app.reject_offset = CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN;
+
+	broker_send_publish(TEST_STREAM_PAYLOAD_LEN, MQTT_QOS_1_AT_LEAST_ONCE);
+
+	TEST_ASSERT_EQUAL(2, app.fragment_count);
+	TEST_ASSERT_EQUAL(TEST_STREAM_PAYLOAD_LEN, broker.read_offset);
+	TEST_ASSERT_EQUAL(0, broker.puback_count);
+}
+
+/* The connection is lost in the middle of the payload. */
+void test_on_publish_streamed_connection_lost(void)
+{
+	streaming_init();
+	broker.fail_offset = CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN + 10;
+
+	broker_send_publish(TEST_STREAM_PAYLOAD_LEN, MQTT_QOS_1_AT_LEAST_ONCE);
+
+	TEST_ASSERT_EQUAL(0, k_sem_take(&error_msg_incomplete_sem, K_SECONDS(1)));
+	TEST_ASSERT_EQUAL(1, app.fragment_count);
+	TEST_ASSERT_EQUAL(0, broker.puback_count);
+}
+
+/* Payloads larger than the payload buffer are accepted when streaming. */
+void test_on_publish_streamed_larger_than_buffer(void)
+{
+	streaming_init();
+
+	broker_send_publish(CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN + 1, MQTT_QOS_1_AT_LEAST_ONCE);
+
+	TEST_ASSERT_NOT_EQUAL(0, k_sem_take(&error_msg_size_sem, K_NO_WAIT));
+	TEST_ASSERT_EQUAL(2, app.fragment_count);
+	TEST_ASSERT_EQUAL(1, broker.puback_count);
+}
+
+/* The test fills the window of unacknowledged QoS 1 messages and verifies that publishing is
+ * refused until the broker acknowledges one of them.
+ */
+void test_mqtt_helper_publish_window(void)
+{
+	streaming_init();
+
+	for (uint16_t id = 1; id <= CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE; id++) {
+		TEST_ASSERT_EQUAL(0, publish_qos(id, MQTT_QOS_1_AT_LEAST_ONCE, false));
+	}
+
+	TEST_ASSERT_EQUAL(-EAGAIN, publish_qos(10, MQTT_QOS_1_AT_LEAST_ONCE, false));
+	TEST_ASSERT_EQUAL(CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE, broker.publish_count);
+
+	/* QoS 0 messages and retransmissions do not need a free slot. */
+	TEST_ASSERT_EQUAL(0, publish_qos(11, MQTT_QOS_0_AT_MOST_ONCE, false));
+	TEST_ASSERT_EQUAL(0, publish_qos(2, MQTT_QOS_1_AT_LEAST_ONCE, true));
+
+	broker_send_puback(2);
+
+	TEST_ASSERT_EQUAL(0, publish_qos(10, MQTT_QOS_1_AT_LEAST_ONCE, false));
+	TEST_ASSERT_EQUAL(-EAGAIN, publish_qos(12, MQTT_QOS_1_AT_LEAST_ONCE, false));
+	TEST_ASSERT_EQUAL(CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE + 3, broker.publish_count);
+}
+
+void test_mqtt_helper_publish_window_cleared_on_disconnect(void)
+{
+	streaming_init();
+
+	for (uint16_t id = 1; id <= CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE; id++) {
+		TEST_ASSERT_EQUAL(0, publish_qos(id, MQTT_QOS_1_AT_LEAST_ONCE, false));
+	}
+
+	send_mqtt_event(MQTT_EVT_DISCONNECT, 0);
+
+	for (size_t i = 0; i < CONFIG_MQTT_HELPER_PUBLISH_WINDOW_SIZE; i++) {
+		TEST_ASSERT_EQUAL(0, publish_window[i]);
+	}
+
+	mqtt_state = MQTT_STATE_CONNECTED;
+
+	TEST_ASSERT_EQUAL(0, publish_qos(1, MQTT_QOS_1_AT_LEAST_ONCE, false));
+}
+
 void test_mqtt_helper_msg_id_get_returns_valid_ids(void)
 {
 	for (int i = 1; i == UINT16_MAX; i++) {
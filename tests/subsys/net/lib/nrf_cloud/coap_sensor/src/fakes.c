@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Fakes for the functions of nrf_cloud_coap.c that the tests do not use. The
+ * transport functions used to send sensor data are faked in main.c.
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/coap.h>
+#include <date_time.h>
+#include "nrf_cloud_coap_transport.h"
+
+int date_time_now(int64_t *unix_time_ms)
+{
+	*unix_time_ms = 0;
+
+	return -ENODATA;
+}
+
+int nrf_cloud_coap_get(const char *resource, const char *query,
+		       const uint8_t *buf, size_t len,
+		       enum coap_content_format fmt_out,
+		       enum coap_content_format fmt_in, bool reliable,
+		       coap_client_response_cb_t cb, void *user)
+{
+	return -ENOTSUP;
+}
+
+int nrf_cloud_coap_fetch(const char *resource, const char *query,
+			 const uint8_t *buf, size_t len,
+			 enum coap_content_format fmt_out,
+			 enum coap_content_format fmt_in, bool reliable,
+			 coap_client_response_cb_t cb, void *user)
+{
+	return -ENOTSUP;
+}
+
+int nrf_cloud_coap_patch(const char *resource, const char *query,
+			 const uint8_t *buf, size_t len,
+			 enum coap_content_format fmt, bool reliable,
+			 coap_client_response_cb_t cb, void *user)
+{
+	return -ENOTSUP;
+}
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/coap.h>
+#include <cJSON.h>
+#include <net/nrf_cloud_coap.h>
+#include "nrf_cloud_coap_transport.h"
+
+#define D2C_RSC		"msg/d2c"
+#define D2C_BULK_RSC	"msg/d2c/bulk"
+#define APP_ID		"TEMP"
+#define TS		1700000000000LL
+#define MAX_REQUESTS	8
+#define PAYLOAD_SIZE	1024
+/* Lets the system workqueue send the queued samples */
+#define FLUSH_WAIT	K_MSEC(10)
+/* Longer than the delay before the samples are sent again after -EAGAIN */
+#define RETRY_WAIT	K_MSEC(200)
+
+/* Request sent with nrf_cloud_coap_request_async() */
+struct sent_request {
+	char resource[32];
+	enum coap_content_format fmt;
+	bool reliable;
+	uint8_t payload[PAYLOAD_SIZE];
+	size_t len;
+	nrf_cloud_coap_done_cb_t done;
+	void *user;
+};
+
+static struct sent_request requests[MAX_REQUESTS];
+static size_t requests_sent;
+static size_t requests_done;
+/* Calls to nrf_cloud_coap_request_async(), including the ones that failed */
+static unsigned int async_calls;
+/* Number of calls to nrf_cloud_coap_request_async() to fail with -EAGAIN */
+static unsigned int async_busy;
+
+/* Requests sent with nrf_cloud_coap_post(), which does not return until completed */
+static unsigned int posts;
+static char post_resource[32];
+static bool post_reliable;
+
+bool nrf_cloud_coap_is_connected(void)
+{
+	return true;
+}
+
+int nrf_cloud_coap_request_async(const struct nrf_cloud_coap_request *req,
+				 nrf_cloud_coap_done_cb_t done, void *done_user)
+{
+	struct sent_request *sent;
+
+	async_calls++;
+
+	if (async_busy) {
+		async_busy--;
+		return -EAGAIN;
+	}
+
+	if ((requests_sent == ARRAY_SIZE(requests)) || (req->len > PAYLOAD_SIZE)) {
+		return -ENOBUFS;
+	}
+
+	sent = &requests[requests_sent++];
+	strncpy(sent->resource, req->resource, sizeof(sent->resource) - 1);
+	sent->fmt = req->fmt_out;
+	sent->reliable = req->reliable;
+	memcpy(sent->payload, req->buf, req->len);
+	sent->len = req->len;
+	sent->done = done;
+	sent->user = done_user;
+
+	return 0;
+}
+
+int nrf_cloud_coap_post(const char *resource, const char *query,
+			const uint8_t *buf, size_t len,
+			enum coap_content_format fmt, bool reliable,
+			coap_client_response_cb_t cb, void *user)
+{
+	const struct coap_client_response_data data = {
+		.result_code = COAP_RESPONSE_CODE_CREATED,
+		.last_block = true,
+	};
+
+	posts++;
+	strncpy(post_resource, resource, sizeof(post_resource) - 1);
+	post_reliable = reliable;
+
+	if (cb) {
+		cb(&data, user);
+	}
+
+	return 0;
+}
+
+static void sample_send(unsigned int i, bool confirmable)
+{
+	zassert_ok(nrf_cloud_coap_sensor_send(APP_ID, 20.0 + i, TS + i, confirmable),
+		   "Sample %u not sent", i);
+}
+
+/* Completes the oldest request in flight, which can send the samples queued meanwhile */
+static void request_complete(int result)
+{
+	struct sent_request *req = &requests[requests_done++];
+
+	req->done(result, req->user);
+	k_sleep(FLUSH_WAIT);
+}
+
+/* Checks a bulk message with the samples first to first + count - 1 */
+static void bulk_check(const struct sent_request *req, unsigned int first, unsigned int count)
+{
+	char json[PAYLOAD_SIZE + 1];
+	cJSON *bulk;
+
+	zassert_str_equal(req->resource, D2C_BULK_RSC);
+	zassert_equal(req->fmt, COAP_CONTENT_FORMAT_APP_JSON);
+	zassert_false(req->reliable);
+
+	memcpy(json, req->payload, req->len);
+	json[req->len] = '\0';
+
+	bulk = cJSON_Parse(json);
+	zassert_true(cJSON_IsArray(bulk), "Not a bulk message: %s", json);
+	zassert_equal(cJSON_GetArraySize(bulk), count, "Wrong sample count: %s", json);
+
+	for (unsigned int i = 0; i < count; i++) {
+		cJSON *msg = cJSON_GetArrayItem(bulk, i);
+		cJSON *app_id = cJSON_GetObjectItem(msg, "appId");
+		cJSON *data = cJSON_GetObjectItem(msg, "data");
+		cJSON *ts = cJSON_GetObjectItem(msg, "ts");
+
+		zassert_true(cJSON_IsString(app_id) && cJSON_IsNumber(data) && cJSON_IsNumber(ts),
+			     "Malformed sample %u: %s", i, json);
+		zassert_str_equal(app_id->valuestring, APP_ID);
+		zassert_equal(data->valuedouble, 20.0 + first + i);
+		zassert_equal((int64_t)ts->valuedouble, TS + first + i);
+	}
+
+	cJSON_Delete(bulk);
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(requests, 0, sizeof(requests));
+	requests_sent = 0;
+	requests_done = 0;
+	async_calls = 0;
+	async_busy = 0;
+	posts = 0;
+	memset(post_resource, 0, sizeof(post_resource));
+	post_reliable = false;
+}
+
+static void test_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Leave the queue empty for the next test */
+	async_busy = 0;
+	while (requests_done < requests_sent) {
+		request_complete(COAP_RESPONSE_CODE_CHANGED);
+	}
+}
+
+ZTEST(nrf_cloud_coap_sensor, test_sensor_send_confirmable)
+{
+	sample_send(0, true);
+
+	zassert_equal(posts, 1);
+	zassert_str_equal(post_resource, D2C_RSC);
+	zassert_true(post_reliable);
+
+	k_sleep(FLUSH_WAIT);
+	zassert_equal(async_calls, 0, "Confirmable sample queued");
+}
+
+#if defined(CONFIG_NRF_CLOUD_COAP_SENSOR_COALESCE)
+
+ZTEST(nrf_cloud_coap_sensor, test_sensor_send_non_confirmable)
+{
+	sample_send(0, false);
+	zassert_equal(posts, 0, "Sample not queued");
+
+	k_sleep(FLUSH_WAIT);
+
+	/* A single sample is sent in a CBOR message */
+	zassert_equal(requests_sent, 1);
+	zassert_str_equal(requests[0].resource, D2C_RSC);
+	zassert_equal(requests[0].fmt, COAP_CONTENT_FORMAT_APP_CBOR);
+	zassert_false(requests[0].reliable);
+
+	request_complete(COAP_RESPONSE_CODE_CHANGED);
+	zassert_equal(requests_sent, 1, "Message sent with an empty queue");
+}
+
+ZTEST(nrf_cloud_coap_sensor, test_sensor_coalesce_in_flight)
+{
+	sample_send(0, false);
+	k_sleep(FLUSH_WAIT);
+	zassert_equal(requests_sent, 1);
+
+	/* Queued while the first message is in flight */
+	for (unsigned int i = 1; i <= 3; i++) {
+		sample_send(i, false);
+	}
+
+	k_sleep(FLUSH_WAIT);
+	zassert_equal(requests_sent, 1, "Message sent while another one is in flight");
+
+	request_complete(COAP_RESPONSE_CODE_CHANGED);
+
+	zassert_equal(requests_sent, 2);
+	bulk_check(&requests[1], 1, 3);
+	zassert_equal(posts, 0);
+}
+
+ZTEST(nrf_cloud_coap_sensor, test_sensor_coalesce_retry)
+{
+	/* All requests of the transport are outstanding */
+	async_busy = 1;
+
+	sample_send(0, false);
+	k_sleep(FLUSH_WAIT);
+	zassert_equal(async_calls, 1);
+	zassert_equal(requests_sent, 0);
+
+	/* Queued until the retry */
+	sample_send(1, false);
+	k_sleep(FLUSH_WAIT);
+	zassert_equal(async_calls, 1, "Retried before the delay");
+
+	k_sleep(RETRY_WAIT);
+
+	zassert_equal(async_calls, 2);
+	zassert_equal(requests_sent, 1);
+	bulk_check(&requests[0], 0, 2);
+	zassert_equal(posts, 0);
+}
+
+ZTEST(nrf_cloud_coap_sensor, test_sensor_coalesce_queue_full)
+{
+	const unsigned int max = CONFIG_NRF_CLOUD_COAP_SENSOR_COALESCE_MAX;
+
+	sample_send(0, false);
+	k_sleep(FLUSH_WAIT);
+	zassert_equal(requests_sent, 1);
+
+	for (unsigned int i = 1; i <= max; i++) {
+		sample_send(i, false);
+	}
+	zassert_equal(posts, 0);
+
+	/* The queue is full, so the sample is sent directly */
+	sample_send(max + 1, false);
+	zassert_equal(posts, 1);
+	zassert_str_equal(post_resource, D2C_RSC);
+	zassert_false(post_reliable);
+
+	request_complete(COAP_RESPONSE_CODE_CHANGED);
+
+	zassert_equal(requests_sent, 2);
+	bulk_check(&requests[1], 1, max);
+}
+
+#else
+
+ZTEST(nrf_cloud_coap_sensor, test_sensor_send_non_confirmable)
+{
+	sample_send(0, false);
+
+	zassert_equal(posts, 1);
+	zassert_str_equal(post_resource, D2C_RSC);
+	zassert_false(post_reliable);
+
+	k_sleep(FLUSH_WAIT);
+	zassert_equal(async_calls, 0, "Sample queued");
+}
+
+ZTEST(nrf_cloud_coap_sensor, test_sensor_coalesce_in_flight)
+{
+	ztest_test_skip();
+}
+
+ZTEST(nrf_cloud_coap_sensor, test_sensor_coalesce_retry)
+{
+	ztest_test_skip();
+}
+
+ZTEST(nrf_cloud_coap_sensor, test_sensor_coalesce_queue_full)
+{
+	ztest_test_skip();
+}
+
+#endif /* CONFIG_NRF_CLOUD_COAP_SENSOR_COALESCE */
+
+ZTEST_SUITE(nrf_cloud_coap_sensor, NULL, NULL, test_before, test_after, NULL);
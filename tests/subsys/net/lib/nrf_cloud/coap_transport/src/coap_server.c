@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/coap.h>
+#include <zephyr/net/coap_client.h>
+#include "coap_server.h"
+
+#define MAX_RULES 4
+#define SERVER_STACK_SIZE 2048
+#define SERVER_PRIORITY 5
+
+struct rule {
+	const char *prefix;
+	uint32_t delay_ms;
+	uint8_t code;
+};
+
+struct exchange {
+	struct coap_client_request *req;
+	int64_t due;
+	uint8_t code;
+	bool active;
+};
+
+static struct rule rules[MAX_RULES];
+static size_t rule_count;
+static struct exchange exchanges[CONFIG_COAP_CLIENT_MAX_REQUESTS];
+static size_t active;
+static size_t active_max;
+
+static K_MUTEX_DEFINE(server_mut);
+static K_SEM_DEFINE(server_sem, 0, 1);
+
+static const struct rule *rule_find(const char *path)
+{
+	for (size_t i = 0; i < rule_count; i++) {
+		if (strncmp(path, rules[i].prefix, strlen(rules[i].prefix)) == 0) {
+			return &rules[i];
+		}
+	}
+
+	return NULL;
+}
+
+void coap_server_rule_set(const char *prefix, uint32_t delay_ms, uint8_t code)
+{
+	k_mutex_lock(&server_mut, K_FOREVER);
+	__ASSERT_NO_MSG(rule_count < MAX_RULES);
+	rules[rule_count++] = (struct rule) {
+		.prefix = prefix,
+		.delay_ms = delay_ms,
+		.code = code,
+	};
+	k_mutex_unlock(&server_mut);
+}
+
+void coap_server_reset(void)
+{
+	k_mutex_lock(&server_mut, K_FOREVER);
+	rule_count = 0;
+	active_max = active;
+	k_mutex_unlock(&server_mut);
+
+	coap_server_rule_set("auth/jwt", 0, COAP_RESPONSE_CODE_CREATED);
+}
+
+size_t coap_server_active(void)
+{
+	return active;
+}
+
+size_t coap_server_active_max(void)
+{
+	return active_max;
+}
+
+int coap_client_init(struct coap_client *client, const char *info)
+{
+	return 0;
+}
+
+int coap_client_req(struct coap_client *client, int sock, const struct sockaddr *addr,
+		    struct coap_client_request *req, struct coap_transmission_parameters *params)
+{
+	const struct rule *rule;
+	int err = -EAGAIN;
+
+	k_mutex_lock(&server_mut, K_FOREVER);
+
+	rule = rule_find(req->path);
+
+	if (rule && rule->code && (rule->delay_ms == COAP_SERVER_INLINE)) {
+		struct coap_client_response_data data = {
+			.result_code = rule->code,
+			.last_block = true,
+		};
+
+		k_mutex_unlock(&server_mut);
+
+		req->cb(&data, req->user_data);
+		return 0;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(exchanges); i++) {
+		if (!exchanges[i].active) {
+			exchanges[i] = (struct exchange) {
+				.req = req,
+				.due = k_uptime_get() + (rule ? rule->delay_ms : 0),
+				.code = rule ? rule->code : COAP_RESPONSE_CODE_NOT_FOUND,
+				.active = true,
+			};
+			active++;
+			active_max = MAX(active, active_max);
+			err = 0;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&server_mut);
+
+	k_sem_give(&server_sem);
+
+	return err;
+}
+
+void coap_client_cancel_request(struct coap_client *client, struct coap_client_request *req)
+{
+	k_mutex_lock(&server_mut, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(exchanges); i++) {
+		if (exchanges[i].active && exchanges[i].req == req) {
+			exchanges[i].active = false;
+			active--;
+		}
+	}
+
+	k_mutex_unlock(&server_mut);
+}
+
+void coap_client_cancel_requests(struct coap_client *client)
+{
+	k_mutex_lock(&server_mut, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(exchanges); i++) {
+		exchanges[i].active = false;
+	}
+	active = 0;
+
+	k_mutex_unlock(&server_mut);
+}
+
+static void server_thread_fn(void)
+{
+	struct exchange *next;
+	struct coap_client_request *req;
+	k_timeout_t wait;
+	int64_t now;
+
+	while (true) {
+		struct coap_client_response_data data = {
+			.last_block = true,
+		};
+
+		k_mutex_lock(&server_mut, K_FOREVER);
+
+		next = NULL;
+		for (size_t i = 0; i < ARRAY_SIZE(exchanges); i++) {
+			if (exchanges[i].active && exchanges[i].code &&
+			    (!next || exchanges[i].due < next->due)) {
+				next = &exchanges[i];
+			}
+		}
+
+		now = k_uptime_get();
+		if (next && next->due <= now) {
+			req = next->req;
+			data.result_code = next->code;
+			next->active = false;
+			active--;
+			k_mutex_unlock(&server_mut);
+
+			req->cb(&data, req->user_data);
+			continue;
+		}
+
+		wait = next ? K_MSEC(next->due - now) : K_FOREVER;
+		k_mutex_unlock(&server_mut);
+
+		(void)k_sem_take(&server_sem, wait);
+	}
+}
+
+K_THREAD_DEFINE(coap_server, SERVER_STACK_SIZE, server_thread_fn, NULL, NULL, NULL,
+		SERVER_PRIORITY, 0, 0);
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef COAP_SERVER_H_
+#define COAP_SERVER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Stand-in for the Zephyr CoAP client and the nRF Cloud CoAP server. Requests are answered
+ * from a separate thread, like the responses received by the CoAP client thread.
+ */
+
+/* Delay of a response sent from coap_client_req(), before the request call returns */
+#define COAP_SERVER_INLINE UINT32_MAX
+
+/* Respond to the requests whose path starts with @p prefix after @p delay_ms,
+ * or never when @p code is 0.
+ */
+void coap_server_rule_set(const char *prefix, uint32_t delay_ms, uint8_t code);
+
+/* Remove the rules, except for the one answering the authentication request */
+void coap_server_reset(void);
+
+/* Number of requests waiting for a response */
+size_t coap_server_active(void);
+
+/* Highest number of requests that waited for a response at the same time */
+size_t coap_server_active_max(void);
+
+#endif /* COAP_SERVER_H_ */
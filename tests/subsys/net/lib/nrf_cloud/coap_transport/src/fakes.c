@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Fakes for the nRF Cloud functions used by nrf_cloud_coap_transport.c to connect
+ * and authenticate. The DTLS socket is never opened; requests go to the stand-in
+ * CoAP server in coap_server.c.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_coap.h>
+#include "nrf_cloud_codec_internal.h"
+#include "nrf_cloud_dns.h"
+#include "nrf_cloud_mem.h"
+#include "nrfc_dtls.h"
+
+#define FAKE_SOCKET 3
+
+int nrf_cloud_print_details(void)
+{
+	return 0;
+}
+
+int nrf_cloud_codec_init(struct nrf_cloud_os_mem_hooks *hooks)
+{
+	return 0;
+}
+
+int nrf_cloud_connect_host(const char *host_name, uint16_t port, struct zsock_addrinfo *hints,
+			   nrf_cloud_connect_host_cb connect_cb)
+{
+	return FAKE_SOCKET;
+}
+
+int nrf_cloud_jwt_generate(uint32_t time_valid_s, char * const jwt_buf, size_t jwt_buf_sz)
+{
+	strncpy(jwt_buf, "header.payload.signature", jwt_buf_sz);
+
+	return 0;
+}
+
+void *nrf_cloud_malloc(size_t size)
+{
+	return k_malloc(size);
+}
+
+void nrf_cloud_free(void *memory)
+{
+	k_free(memory);
+}
+
+int nrfc_dtls_setup(int sock)
+{
+	return 0;
+}
+
+bool nrfc_dtls_cid_is_active(int sock)
+{
+	return false;
+}
+
+int nrfc_dtls_session_save(int sock)
+{
+	return -EINVAL;
+}
+
+int nrfc_dtls_session_load(int sock)
+{
+	return -EINVAL;
+}
+
+bool nrfc_keepopen_is_supported(void)
+{
+	return false;
+}
+
+void nrf_cloud_device_control_get(struct nrf_cloud_ctrl_data *const ctrl)
+{
+}
+
+int nrf_cloud_shadow_control_response_encode(struct nrf_cloud_ctrl_data const *const data,
+					     bool accept, struct nrf_cloud_data *const output)
+{
+	output->ptr = NULL;
+	output->len = 0;
+
+	return 0;
+}
+
+int nrf_cloud_coap_shadow_state_update(const char * const shadow_json)
+{
+	return 0;
+}
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <limits.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/coap.h>
+#include <net/nrf_cloud_coap.h>
+#include "nrf_cloud_coap_transport.h"
+#include "coap_server.h"
+
+#define SLOW_RSC	"loc/ground-fix"
+#define FAST_RSC	"msg/d2c"
+#define IDLE_RSC	"fota/exec/current"
+#define SLOW_MS		1000
+#define FAST_MS		10
+#define DONE_TIMEOUT	K_SECONDS(5)
+#define SLOW_STACK_SIZE	2048
+/* Longer than the wait for the response to a NON request */
+#define NON_WAIT_MS	4000
+
+struct request_done {
+	struct k_sem sem;
+	int result;
+};
+
+static const uint8_t payload[] = {0xa1, 0x61, 0x61, 0x01};
+
+static K_THREAD_STACK_DEFINE(slow_stack, SLOW_STACK_SIZE);
+static struct k_thread slow_thread;
+static int slow_err;
+
+static void request_done_cb(int result, void *user)
+{
+	struct request_done *done = user;
+
+	done->result = result;
+	k_sem_give(&done->sem);
+}
+
+static int request_send(const char *resource, bool reliable, struct request_done *done)
+{
+	const struct nrf_cloud_coap_request req = {
+		.method = COAP_METHOD_POST,
+		.resource = resource,
+		.buf = payload,
+		.len = sizeof(payload),
+		.fmt_out = COAP_CONTENT_FORMAT_APP_CBOR,
+		.reliable = reliable,
+	};
+
+	k_sem_init(&done->sem, 0, 1);
+	done->result = INT_MIN;
+
+	return nrf_cloud_coap_request_async(&req, request_done_cb, done);
+}
+
+static void request_wait(struct request_done *done, int expected)
+{
+	zassert_ok(k_sem_take(&done->sem, DONE_TIMEOUT), "Request not completed");
+	zassert_equal(done->result, expected, "Unexpected result %d", done->result);
+}
+
+static void slow_fetch(void *p1, void *p2, void *p3)
+{
+	slow_err = nrf_cloud_coap_fetch(SLOW_RSC, NULL, payload, sizeof(payload),
+					COAP_CONTENT_FORMAT_APP_CBOR, COAP_CONTENT_FORMAT_APP_CBOR,
+					true, NULL, NULL);
+}
+
+static void *suite_setup(void)
+{
+	zassert_ok(nrf_cloud_coap_init(), "Init failed");
+
+	return NULL;
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	coap_server_reset();
+	zassert_ok(nrf_cloud_coap_connect(NULL), "Connect failed");
+	zassert_true(nrf_cloud_coap_is_connected(), "Not connected");
+
+	coap_server_rule_set(SLOW_RSC, SLOW_MS, COAP_RESPONSE_CODE_CONTENT);
+}
+
+static void test_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	(void)nrf_cloud_coap_disconnect();
+}
+
+ZTEST(nrf_cloud_coap_transport, test_requests_pipelined)
+{
+	struct request_done done[CONFIG_NRF_CLOUD_COAP_MAX_PENDING_REQUESTS];
+	int64_t start = k_uptime_get();
+
+	for (size_t i = 0; i < ARRAY_SIZE(done); i++) {
+		zassert_ok(request_send(SLOW_RSC, true, &done[i]), "Request %zu not sent", i);
+	}
+
+	zassert_equal(coap_server_active(), ARRAY_SIZE(done), "Requests not outstanding");
+
+	for (size_t i = 0; i < ARRAY_SIZE(done); i++) {
+		request_wait(&done[i], 0);
+	}
+
+	zassert_true(k_uptime_get() - start < 2 * SLOW_MS, "Requests were serialized");
+	zassert_equal(coap_server_active_max(), ARRAY_SIZE(done));
+}
+
+ZTEST(nrf_cloud_coap_transport, test_credits_exhausted)
+{
+	struct request_done done[CONFIG_NRF_CLOUD_COAP_MAX_PENDING_REQUESTS];
+	struct request_done extra;
+
+	for (size_t i = 0; i < ARRAY_SIZE(done); i++) {
+		zassert_ok(request_send(SLOW_RSC, true, &done[i]), "Request %zu not sent", i);
+	}
+
+	/* The CoAP client has room for one more request, the credits do not */
+	zassert_equal(request_send(SLOW_RSC, true, &extra), -EAGAIN, "Credit not enforced");
+
+	request_wait(&done[0], 0);
+
+	zassert_ok(request_send(SLOW_RSC, true, &extra), "Credit not returned");
+
+	for (size_t i = 1; i < ARRAY_SIZE(done); i++) {
+		request_wait(&done[i], 0);
+	}
+	request_wait(&extra, 0);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_slow_request_does_not_block)
+{
+	int64_t start;
+	int err;
+
+	coap_server_rule_set(FAST_RSC, FAST_MS, COAP_RESPONSE_CODE_CHANGED);
+
+	k_thread_create(&slow_thread, slow_stack, K_THREAD_STACK_SIZEOF(slow_stack),
+			slow_fetch, NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(FAST_MS));
+	zassert_equal(coap_server_active(), 1, "Slow request not sent");
+
+	start = k_uptime_get();
+	err = nrf_cloud_coap_post(FAST_RSC, NULL, payload, sizeof(payload),
+				  COAP_CONTENT_FORMAT_APP_CBOR, true, NULL, NULL);
+	zassert_ok(err, "Fast request failed: %d", err);
+	zassert_true(k_uptime_get() - start < SLOW_MS / 2, "Fast request waited for slow one");
+
+	zassert_ok(k_thread_join(&slow_thread, DONE_TIMEOUT), "Slow request not completed");
+	zassert_ok(slow_err, "Slow request failed: %d", slow_err);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_non_timeout_returns_credit)
+{
+	struct request_done done[CONFIG_NRF_CLOUD_COAP_MAX_PENDING_REQUESTS];
+	struct request_done extra;
+
+	/* The server never responds to these */
+	coap_server_rule_set(FAST_RSC, 0, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(done); i++) {
+		zassert_ok(request_send(FAST_RSC, false, &done[i]), "Request %zu not sent", i);
+	}
+	zassert_equal(request_send(FAST_RSC, false, &extra), -EAGAIN, "Credit not enforced");
+
+	for (size_t i = 0; i < ARRAY_SIZE(done); i++) {
+		request_wait(&done[i], 0);
+	}
+	zassert_equal(coap_server_active(), 0, "Timed out requests not cancelled");
+
+	zassert_ok(request_send(FAST_RSC, false, &extra), "Credit not returned");
+	request_wait(&extra, 0);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_non_error_result)
+{
+	int err;
+
+	coap_server_rule_set(FAST_RSC, FAST_MS, COAP_RESPONSE_CODE_BAD_REQUEST);
+
+	err = nrf_cloud_coap_post(FAST_RSC, NULL, payload, sizeof(payload),
+				  COAP_CONTENT_FORMAT_APP_CBOR, false, NULL, NULL);
+	zassert_equal(err, COAP_RESPONSE_CODE_BAD_REQUEST, "Bad result ignored: %d", err);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_non_response_before_send_returns)
+{
+	struct request_done done;
+	struct request_done idle;
+
+	coap_server_rule_set(FAST_RSC, COAP_SERVER_INLINE, COAP_RESPONSE_CODE_CHANGED);
+	/* The server never responds to these */
+	coap_server_rule_set(IDLE_RSC, 0, 0);
+
+	zassert_ok(request_send(FAST_RSC, false, &done), "Request not sent");
+	request_wait(&done, 0);
+
+	/* The next transfer reuses the context, and must not be completed by the NON timeout
+	 * of the previous one.
+	 */
+	zassert_ok(request_send(IDLE_RSC, true, &idle), "Request not sent");
+	k_sleep(K_MSEC(NON_WAIT_MS));
+	zassert_equal(k_sem_take(&idle.sem, K_NO_WAIT), -EBUSY, "Completed by stale timeout");
+	zassert_equal(coap_server_active(), 1, "Request cancelled by stale timeout");
+
+	(void)nrf_cloud_coap_disconnect();
+	request_wait(&idle, -ECANCELED);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_disconnect_cancels)
+{
+	struct request_done done;
+
+	zassert_ok(request_send(SLOW_RSC, true, &done), "Request not sent");
+
+	(void)nrf_cloud_coap_disconnect();
+
+	request_wait(&done, -ECANCELED);
+}
+
+ZTEST_SUITE(nrf_cloud_coap_transport, NULL, suite_setup, test_before, test_after, NULL);
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Fakes required to link the nRF Cloud codecs in the benchmark.
+ *
+ * The memory wrappers of nrf_cloud_mem.c are pointed at a counting allocator
+ * by nrf_cloud_os_mem_hooks_init(), which also hands it to cJSON. The A-GNSS
+ * types of a request come from the modem in the library, so they are fixed
+ * here as in the codec/cbor test.
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <zephyr/sys/util.h>
+#include <cJSON.h>
+#include <net/nrf_cloud.h>
+#include <nrf_modem_gnss.h>
+#include <nrf_cloud_codec_internal.h>
+#include "heap_stats.h"
+
+/* -------------------------------------------------------------------------
+ * Counting allocator
+ * -------------------------------------------------------------------------
+ */
+
+struct heap_stats heap_stats;
+
+/* The size of each allocation is stored in front of it. */
+union alloc_header {
+	size_t size;
+	max_align_t align;
+};
+
+void heap_stats_reset(void)
+{
+	heap_stats.max_allocated = heap_stats.allocated;
+	heap_stats.allocs = 0;
+}
+
+void *heap_stats_malloc(size_t size)
+{
+	union alloc_header *header = malloc(sizeof(*header) + size);
+
+	if (!header) {
+		return NULL;
+	}
+
+	header->size = size;
+	heap_stats.allocated += size;
+	heap_stats.max_allocated = MAX(heap_stats.max_allocated, heap_stats.allocated);
+	heap_stats.allocs++;
+
+	return header + 1;
+}
+
+void *heap_stats_calloc(size_t count, size_t size)
+{
+	void *ptr;
+
+	if (size && count > SIZE_MAX / size) {
+		return NULL;
+	}
+
+	ptr = heap_stats_malloc(count * size);
+	if (ptr) {
+		memset(ptr, 0, count * size);
+	}
+
+	return ptr;
+}
+
+void heap_stats_free(void *ptr)
+{
+	union alloc_header *header;
+
+	if (!ptr) {
+		return;
+	}
+
+	header = (union alloc_header *)ptr - 1;
+	heap_stats.allocated -= header->size;
+	free(header);
+}
+
+/* -------------------------------------------------------------------------
+ * A-GNSS types (nrf_cloud_agnss.c)
+ * -------------------------------------------------------------------------
+ */
+
+/* Fixed A-GNSS types, as in the codec/cbor test. */
+int nrf_cloud_agnss_type_array_get(const struct nrf_modem_gnss_agnss_data_frame *const request,
+				   enum nrf_cloud_agnss_type *array, const size_t array_size)
+{
+	ARG_UNUSED(request);
+
+	if (!array || array_size < 2) {
+		return -EINVAL;
+	}
+
+	array[0] = NRF_CLOUD_AGNSS_GPS_UTC_PARAMETERS;
+	array[1] = NRF_CLOUD_AGNSS_GPS_EPHEMERIDES;
+
+	return 2;
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef HEAP_STATS_H_
+#define HEAP_STATS_H_
+
+#include <stddef.h>
+
+/* Heap use of the codecs, counted by the allocator in fakes.c. */
+struct heap_stats {
+	/* Bytes currently allocated. */
+	size_t allocated;
+	/* Largest number of bytes allocated since the last reset. */
+	size_t max_allocated;
+	/* Number of allocations since the last reset. */
+	size_t allocs;
+};
+
+extern struct heap_stats heap_stats;
+
+void heap_stats_reset(void);
+
+void *heap_stats_malloc(size_t size);
+
+void *heap_stats_calloc(size_t count, size_t size);
+
+void heap_stats_free(void *ptr);
+
+#endif /* HEAP_STATS_H_ */
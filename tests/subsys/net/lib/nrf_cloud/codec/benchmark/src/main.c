@@ -0,0 +1,567 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Throughput and heap use of the nRF Cloud encoders and decoders on the host.
+ *
+ * Each test encodes or decodes CONFIG_NRF_CLOUD_CODEC_BENCHMARK_ROUNDS messages
+ * of one message type and prints the number of messages per second, the peak
+ * heap use and the number of allocations per message. The values in the
+ * messages change every round, so that the results are not those of a single
+ * cached message.
+ *
+ * The CoAP CBOR codec (coap_codec.h) covers the messages used by the location
+ * library over CoAP: ground fix, A-GNSS and P-GPS. The JSON codec
+ * (nrf_cloud_codec.h and nrf_cloud_codec_internal.h) covers the same requests
+ * over MQTT, and device messages sent and received over MQTT.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/printk.h>
+#include <cJSON.h>
+/* nrf_cloud_codec.h must be included before coap_codec.h, see the codec/cbor test. */
+#include <net/nrf_cloud_codec.h>
+#include <net/nrf_cloud_os.h>
+#include <net/nrf_cloud_location.h>
+#include <net/nrf_cloud_pgps.h>
+#include <net/nrf_cloud_coap.h>
+#include <nrf_modem_gnss.h>
+#include <zephyr/net/coap.h>
+#include "coap_codec.h"
+#include "nrf_cloud_codec_internal.h"
+#include "heap_stats.h"
+#include "host_clock.h"
+
+#define ROUNDS		CONFIG_NRF_CLOUD_CODEC_BENCHMARK_ROUNDS
+#define NCELLS_COUNT	5
+#define WIFI_AP_COUNT	10
+
+/* Encodes or decodes one message, with values that depend on the round. */
+typedef int (*message_fn_t)(uint32_t round);
+
+static uint8_t buf[LOCATION_GET_CBOR_MAX_SIZE];
+static size_t buf_len;
+
+static void benchmark_run(const char *type, message_fn_t message_fn)
+{
+	size_t allocated = heap_stats.allocated;
+	uint64_t start;
+	uint64_t ns;
+
+	heap_stats_reset();
+
+	start = host_clock_ns();
+	for (uint32_t round = 0; round < ROUNDS; round++) {
+		zassert_ok(message_fn(round), "%s failed in round %u", type, round);
+	}
+	ns = MAX(host_clock_ns() - start, 1);
+
+	printk("%-22s %9llu msg/s %6llu ns/msg %6zu B peak heap %4zu allocs/msg\n",
+	       type, (uint64_t)ROUNDS * 1000000000ULL / ns, ns / ROUNDS,
+	       heap_stats.max_allocated - allocated, heap_stats.allocs / ROUNDS);
+
+	/* Every message is freed. */
+	zassert_equal(heap_stats.allocated, allocated, "%s leaked %zu bytes", type,
+		      heap_stats.allocated - allocated);
+}
+
+static void *benchmark_setup(void)
+{
+	/* The codecs and cJSON allocate through the counting allocator. */
+	struct nrf_cloud_os_mem_hooks hooks = {
+		.malloc_fn = heap_stats_malloc,
+		.calloc_fn = heap_stats_calloc,
+		.free_fn = heap_stats_free,
+	};
+
+	nrf_cloud_os_mem_hooks_init(&hooks);
+
+	return NULL;
+}
+
+/* Serving cell, the five neighbor cells that fit in a CoAP request and Wi-Fi access points,
+ * as sent by the location library.
+ */
+static struct lte_lc_ncell ncells[NCELLS_COUNT];
+static struct wifi_scan_result aps[WIFI_AP_COUNT];
+
+static void location_data_fill(uint32_t round, struct lte_lc_cells_info *cell_info,
+			       struct wifi_scan_info *wifi_info)
+{
+	*cell_info = (struct lte_lc_cells_info) {
+		.current_cell = {
+			.mcc = 242,
+			.mnc = 1,
+			.id = 0x12345 + round % 1000,
+			.tac = 0x1234,
+			.earfcn = 6400,
+			.timing_advance = round % 100,
+			.rsrp = 50 - round % 10,
+			.rsrq = 20,
+		},
+		.ncells_count = NCELLS_COUNT,
+		.neighbor_cells = ncells,
+	};
+	*wifi_info = (struct wifi_scan_info) {
+		.ap_info = aps,
+		.cnt = WIFI_AP_COUNT,
+	};
+
+	for (size_t i = 0; i < NCELLS_COUNT; i++) {
+		ncells[i] = (struct lte_lc_ncell) {
+			.earfcn = 6400,
+			.phys_cell_id = (round + i) % 504,
+			.rsrp = 40 - i,
+			.rsrq = 15,
+			.time_diff = 10 * i,
+		};
+	}
+
+	for (size_t i = 0; i < WIFI_AP_COUNT; i++) {
+		aps[i] = (struct wifi_scan_result) {
+			.mac = {0x12, 0x34, 0x56, 0x78, round & 0xff, i},
+			.mac_length = 6,
+			.rssi = -50 - i,
+			.channel = 1 + i,
+		};
+	}
+}
+
+ZTEST_SUITE(nrf_cloud_codec_benchmark, NULL, benchmark_setup, NULL, NULL, NULL);
+
+/* =========================================================================
+ * CoAP CBOR encoders
+ * =========================================================================
+ */
+
+static int cbor_sensor_encode(uint32_t round)
+{
+	buf_len = SENSOR_SEND_CBOR_MAX_SIZE;
+
+	return coap_codec_sensor_encode(NRF_CLOUD_JSON_APPID_VAL_TEMP, 20.0 + (round % 100) / 10.0,
+					1700000000000LL + round, buf, &buf_len,
+					COAP_CONTENT_FORMAT_APP_CBOR);
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_cbor_sensor_encode)
+{
+	benchmark_run("CBOR sensor", cbor_sensor_encode);
+}
+
+static int cbor_message_encode(uint32_t round)
+{
+	char str[32];
+	struct nrf_cloud_obj_coap_cbor msg = {
+		.app_id = "ALERT",
+		.type = NRF_CLOUD_DATA_TYPE_STR,
+		.str_val = str,
+		.ts = 1700000000000LL + round,
+	};
+
+	snprintf(str, sizeof(str), "Button %u pressed", round % 4);
+	buf_len = MESSAGE_SEND_CBOR_MAX_SIZE;
+
+	return coap_codec_message_encode(&msg, buf, &buf_len, COAP_CONTENT_FORMAT_APP_CBOR);
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_cbor_message_encode)
+{
+	benchmark_run("CBOR message", cbor_message_encode);
+}
+
+static int cbor_pvt_encode(uint32_t round)
+{
+	struct nrf_cloud_gnss_pvt pvt = {
+		.lat = 63.43 + round * 1e-7,
+		.lon = 10.39 - round * 1e-7,
+		.accuracy = 5.0f + (round % 10),
+		.alt = 100.0f,
+		.speed = 1.5f,
+		.heading = round % 360,
+		.has_alt = 1,
+		.has_speed = 1,
+		.has_heading = 1,
+	};
+
+	buf_len = MESSAGE_SEND_CBOR_MAX_SIZE;
+
+	return coap_codec_pvt_encode(NRF_CLOUD_JSON_APPID_VAL_GNSS, &pvt, 1700000000000LL + round,
+				     buf, &buf_len, COAP_CONTENT_FORMAT_APP_CBOR);
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_cbor_pvt_encode)
+{
+	benchmark_run("CBOR PVT", cbor_pvt_encode);
+}
+
+static int cbor_ground_fix_req_encode(uint32_t round)
+{
+	struct lte_lc_cells_info cell_info;
+	struct wifi_scan_info wifi_info;
+
+	location_data_fill(round, &cell_info, &wifi_info);
+	buf_len = LOCATION_GET_CBOR_MAX_SIZE;
+
+	return coap_codec_ground_fix_req_encode(&cell_info, &wifi_info, buf, &buf_len,
+						COAP_CONTENT_FORMAT_APP_CBOR);
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_cbor_ground_fix_req_encode)
+{
+	benchmark_run("CBOR ground fix req", cbor_ground_fix_req_encode);
+}
+
+static int cbor_agnss_encode(uint32_t round)
+{
+	struct nrf_modem_gnss_agnss_data_frame agnss_data = {0};
+	struct lte_lc_cells_info net_info = {
+		.current_cell = {
+			.id = 1000 + round % 1000,
+			.mcc = 242,
+			.mnc = 1,
+			.tac = 0x1234,
+			.rsrp = 50,
+		},
+	};
+	struct nrf_cloud_coap_agnss_request request = {
+		.type = NRF_CLOUD_COAP_AGNSS_REQ_CUSTOM,
+		.agnss_req = &agnss_data,
+		.net_info = &net_info,
+		.filtered = true,
+		.mask_angle = 10,
+	};
+
+	buf_len = AGNSS_GET_CBOR_MAX_SIZE;
+
+	return coap_codec_agnss_encode(&request, buf, &buf_len, COAP_CONTENT_FORMAT_APP_CBOR);
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_cbor_agnss_encode)
+{
+	benchmark_run("CBOR A-GNSS req", cbor_agnss_encode);
+}
+
+static int cbor_pgps_encode(uint32_t round)
+{
+	struct gps_pgps_request pgps_req = {
+		.prediction_count = 42,
+		.prediction_period_min = 240,
+		.gps_day = 3000 + round % 100,
+		.gps_time_of_day = round % 86400,
+	};
+	struct nrf_cloud_coap_pgps_request request = {
+		.pgps_req = &pgps_req,
+	};
+
+	buf_len = PGPS_URL_GET_CBOR_MAX_SIZE;
+
+	return coap_codec_pgps_encode(&request, buf, &buf_len, COAP_CONTENT_FORMAT_APP_CBOR);
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_cbor_pgps_encode)
+{
+	benchmark_run("CBOR P-GPS req", cbor_pgps_encode);
+}
+
+/* =========================================================================
+ * CoAP CBOR decoders
+ * =========================================================================
+ */
+
+/* { 1: 45.524098, 2: -122.688408, 3: 300, 4: "MCELL" }, see the codec/cbor test. */
+static const uint8_t ground_fix_resp[] = {
+	0xA4,
+	0x01, 0xFB, 0x40, 0x46, 0xC3, 0x15, 0xA4, 0xAC, 0xF3, 0x13,
+	0x02, 0xFB, 0xC0, 0x5E, 0xAC, 0x0E, 0xE0, 0x6D, 0x93, 0x81,
+	0x03, 0x19, 0x01, 0x2C,
+	0x04, 0x65, 0x4D, 0x43, 0x45, 0x4C, 0x4C,
+};
+
+static int cbor_ground_fix_resp_decode(uint32_t round)
+{
+	struct nrf_cloud_location_result result = {0};
+	int err;
+
+	ARG_UNUSED(round);
+
+	err = coap_codec_ground_fix_resp_decode(&result, ground_fix_resp, sizeof(ground_fix_resp),
+						COAP_CONTENT_FORMAT_APP_CBOR);
+
+	return (err || result.type == LOCATION_TYPE_MULTI_CELL) ? err : -EBADMSG;
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_cbor_ground_fix_resp_decode)
+{
+	benchmark_run("CBOR ground fix resp", cbor_ground_fix_resp_decode);
+}
+
+/* { 1: "pgnss.nrfcloud.com", 2: "public/15131-0_15135-72000.bin" } */
+static const uint8_t pgps_resp[] = {
+	0xA2,
+	0x01, 0x72,
+	0x70, 0x67, 0x6E, 0x73, 0x73, 0x2E, 0x6E, 0x72, 0x66, 0x63, 0x6C, 0x6F, 0x75, 0x64,
+	0x2E, 0x63, 0x6F, 0x6D,
+	0x02, 0x78, 0x1E,
+	0x70, 0x75, 0x62, 0x6C, 0x69, 0x63, 0x2F, 0x31, 0x35, 0x31, 0x33, 0x31, 0x2D, 0x30,
+	0x5F, 0x31, 0x35, 0x31, 0x33, 0x35, 0x2D, 0x37, 0x32, 0x30, 0x30, 0x30, 0x2E, 0x62,
+	0x69, 0x6E,
+};
+
+static int cbor_pgps_resp_decode(uint32_t round)
+{
+	char host[32];
+	char path[32];
+	struct nrf_cloud_pgps_result result = {
+		.host = host,
+		.host_sz = sizeof(host),
+		.path = path,
+		.path_sz = sizeof(path),
+	};
+
+	ARG_UNUSED(round);
+
+	return coap_codec_pgps_resp_decode(&result, pgps_resp, sizeof(pgps_resp),
+					   COAP_CONTENT_FORMAT_APP_CBOR);
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_cbor_pgps_resp_decode)
+{
+	benchmark_run("CBOR P-GPS resp", cbor_pgps_resp_decode);
+}
+
+/* =========================================================================
+ * JSON encoders
+ * =========================================================================
+ */
+
+static int json_encode_free(struct nrf_cloud_obj *obj)
+{
+	int err;
+
+	err = nrf_cloud_obj_cloud_encode(obj);
+	if (!err) {
+		(void)nrf_cloud_obj_cloud_encoded_free(obj);
+	}
+
+	(void)nrf_cloud_obj_free(obj);
+
+	return err;
+}
+
+static int json_sensor_encode(uint32_t round)
+{
+	NRF_CLOUD_OBJ_JSON_DEFINE(obj);
+	int err;
+
+	err = nrf_cloud_obj_msg_init(&obj, NRF_CLOUD_JSON_APPID_VAL_TEMP,
+				     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (err) {
+		return err;
+	}
+
+	err = nrf_cloud_obj_num_add(&obj, NRF_CLOUD_JSON_DATA_KEY, 20.0 + (round % 100) / 10.0,
+				    false);
+	if (!err) {
+		err = nrf_cloud_obj_ts_add(&obj, 1700000000000LL + round);
+	}
+
+	if (err) {
+		(void)nrf_cloud_obj_free(&obj);
+		return err;
+	}
+
+	return json_encode_free(&obj);
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_json_sensor_encode)
+{
+	benchmark_run("JSON sensor", json_sensor_encode);
+}
+
+/* Message with a data object of several members, like a device status update. */
+static int json_status_encode(uint32_t round)
+{
+	static const char *const services[] = { "AGNSS", "PGPS", "FOTA", "GROUND_FIX" };
+	const uint32_t bands[] = { 1, 2, 3, 4, 5, 8, 12, 13, 20, 25 };
+	NRF_CLOUD_OBJ_JSON_DEFINE(obj);
+	int err;
+
+	err = nrf_cloud_obj_msg_init(&obj, "STATUS", NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (err) {
+		return err;
+	}
+
+	err = nrf_cloud_obj_str_add(&obj, "fwVersion", "2.9.0", true);
+	err = err ? err : nrf_cloud_obj_num_add(&obj, "batteryVoltage", 3600 + round % 600, true);
+	err = err ? err : nrf_cloud_obj_bool_add(&obj, "charging", round & 1, true);
+	err = err ? err : nrf_cloud_obj_int_array_add(&obj, "bands", bands, ARRAY_SIZE(bands),
+						      true);
+	err = err ? err : nrf_cloud_obj_str_array_add(&obj, "services", services,
+						      ARRAY_SIZE(services), true);
+	err = err ? err : nrf_cloud_obj_ts_add(&obj, 1700000000000LL + round);
+
+	if (err) {
+		(void)nrf_cloud_obj_free(&obj);
+		return err;
+	}
+
+	return json_encode_free(&obj);
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_json_status_encode)
+{
+	benchmark_run("JSON status", json_status_encode);
+}
+
+/* Location request, as sent by nrf_cloud_location_request() for the location library. */
+static int json_location_req_encode(uint32_t round)
+{
+	struct lte_lc_cells_info cell_info;
+	struct wifi_scan_info wifi_info;
+	NRF_CLOUD_OBJ_JSON_DEFINE(obj);
+	int err;
+
+	location_data_fill(round, &cell_info, &wifi_info);
+
+	err = nrf_cloud_obj_location_request_create(&obj, &cell_info, &wifi_info, NULL);
+	if (err) {
+		return err;
+	}
+
+	return json_encode_free(&obj);
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_json_location_req_encode)
+{
+	benchmark_run("JSON location req", json_location_req_encode);
+}
+
+/* A-GNSS request, as sent by nrf_cloud_agnss_request(). */
+static int json_agnss_req_encode(uint32_t round)
+{
+	struct nrf_modem_gnss_agnss_data_frame agnss_data = {0};
+	cJSON *agnss_req_obj;
+	char *msg;
+	int err;
+
+	ARG_UNUSED(round);
+
+	agnss_req_obj = cJSON_CreateObject();
+	if (!agnss_req_obj) {
+		return -ENOMEM;
+	}
+
+	err = nrf_cloud_agnss_req_json_encode(&agnss_data, agnss_req_obj);
+	if (!err) {
+		msg = cJSON_PrintUnformatted(agnss_req_obj);
+		if (msg) {
+			cJSON_free(msg);
+		} else {
+			err = -ENOMEM;
+		}
+	}
+
+	cJSON_Delete(agnss_req_obj);
+
+	return err;
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_json_agnss_req_encode)
+{
+	benchmark_run("JSON A-GNSS req", json_agnss_req_encode);
+}
+
+/* P-GPS request, as sent by nrf_cloud_pgps_request(). */
+static int json_pgps_req_encode(uint32_t round)
+{
+	struct gps_pgps_request pgps_req = {
+		.prediction_count = 42,
+		.prediction_period_min = 240,
+		.gps_day = 3000 + round % 100,
+		.gps_time_of_day = round % 86400,
+	};
+	NRF_CLOUD_OBJ_JSON_DEFINE(obj);
+	int err;
+
+	err = nrf_cloud_obj_pgps_request_create(&obj, &pgps_req);
+	if (err) {
+		return err;
+	}
+
+	return json_encode_free(&obj);
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_json_pgps_req_encode)
+{
+	benchmark_run("JSON P-GPS req", json_pgps_req_encode);
+}
+
+/* =========================================================================
+ * JSON decoders
+ * =========================================================================
+ */
+
+/* Cloud-to-device message, with the data object handed to the application. */
+static int json_c2d_decode(uint32_t round)
+{
+	char msg[128];
+	struct nrf_cloud_data input = {
+		.ptr = msg,
+	};
+	NRF_CLOUD_OBJ_JSON_DEFINE(obj);
+	NRF_CLOUD_OBJ_JSON_DEFINE(data_obj);
+	double interval;
+	int err;
+
+	input.len = snprintf(msg, sizeof(msg),
+			     "{\"appId\":\"CONFIG\",\"messageType\":\"CMD\","
+			     "\"data\":{\"interval\":%u,\"led\":true},\"ts\":%llu}",
+			     60 + round % 60, 1700000000000ULL + round);
+
+	err = nrf_cloud_obj_input_decode(&obj, &input);
+	if (err) {
+		return err;
+	}
+
+	err = nrf_cloud_obj_msg_check(&obj, "CONFIG", "CMD");
+	err = err ? err : nrf_cloud_obj_object_detach(&obj, NRF_CLOUD_JSON_DATA_KEY, &data_obj);
+	err = err ? err : nrf_cloud_obj_num_get(&data_obj, "interval", &interval);
+
+	(void)nrf_cloud_obj_free(&data_obj);
+	(void)nrf_cloud_obj_free(&obj);
+
+	return err;
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_json_c2d_decode)
+{
+	benchmark_run("JSON C2D message", json_c2d_decode);
+}
+
+/* Location response, as decoded by nrf_cloud_location_process() over MQTT. */
+static int json_location_resp_decode(uint32_t round)
+{
+	struct nrf_cloud_location_result result = {0};
+	char msg[160];
+	int err;
+
+	snprintf(msg, sizeof(msg),
+		 "{\"appId\":\"GROUND_FIX\",\"messageType\":\"DATA\","
+		 "\"data\":{\"lat\":45.5240%02u,\"lon\":-122.688408,\"uncertainty\":%u,"
+		 "\"fulfilledWith\":\"MCELL\"},\"ts\":%llu}",
+		 round % 100, 300 + round % 100, 1700000000000ULL + round);
+
+	err = nrf_cloud_location_response_decode(msg, &result);
+
+	return (err || result.type == LOCATION_TYPE_MULTI_CELL) ? err : -EBADMSG;
+}
+
+ZTEST(nrf_cloud_codec_benchmark, test_json_location_resp_decode)
+{
+	benchmark_run("JSON location resp", json_location_resp_decode);
+}
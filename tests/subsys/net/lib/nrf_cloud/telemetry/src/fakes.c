@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Fakes required to link nrf_cloud_codec.c, which builds the bulk messages of the
+ * telemetry queue. See the codec/json test for why nrf_cloud_codec_internal.c and
+ * nrf_cloud_mem.c are not compiled.
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <cJSON.h>
+#include <nrf_cloud_codec_internal.h>
+#include <nrf_cloud_mem.h>
+
+/* The decoding helpers are not used by the telemetry queue */
+
+int get_string_from_obj(const cJSON *const obj, const char *const key, char **string_out)
+{
+	return -ENOTSUP;
+}
+
+int get_num_from_obj(const cJSON *const obj, const char *const key, double *num_out)
+{
+	return -ENOTSUP;
+}
+
+int get_bool_from_obj(const cJSON *const obj, const char *const key, bool *bool_out)
+{
+	return -ENOTSUP;
+}
+
+/* Memory wrapper fakes (mirrors of nrf_cloud_mem.c) */
+
+void *nrf_cloud_calloc(size_t count, size_t size)
+{
+	return calloc(count, size);
+}
+
+void *nrf_cloud_malloc(size_t size)
+{
+	return malloc(size);
+}
+
+void nrf_cloud_free(void *ptr)
+{
+	free(ptr);
+}
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/storage/flash_map.h>
+#include <cJSON.h>
+#include <net/nrf_cloud_codec.h>
+#include <net/nrf_cloud_telemetry.h>
+
+#define TELEMETRY_PARTITION_ID	PARTITION_ID(nrf_cloud_telemetry)
+#define SERVER_MAX_SAMPLES	2048
+#define SERVER_MAX_MESSAGES	256
+#define PAYLOAD_SIZE		CONFIG_NRF_CLOUD_TELEMETRY_PAYLOAD_SIZE
+#define FLUSH_COUNT		CONFIG_NRF_CLOUD_TELEMETRY_FLUSH_COUNT
+#define TS_BASE			1700000000000LL
+#define BULK_RSC		"d2c/bulk"
+
+/* Samples received by the stand-in for the nRF Cloud CoAP server */
+static struct {
+	struct k_mutex lock;
+	bool online;
+	char resource[16];
+	uint32_t messages;
+	size_t message_len[SERVER_MAX_MESSAGES];
+	uint32_t samples;
+	double value[SERVER_MAX_SAMPLES];
+	int64_t ts[SERVER_MAX_SAMPLES];
+	char app_id[SERVER_MAX_SAMPLES][8];
+} server;
+
+/* Device message of the bulk message, with exactly the app ID, message type, data and
+ * timestamp keys.
+ */
+static bool sample_decode(const cJSON *msg, uint32_t idx)
+{
+	const cJSON *app_id = cJSON_GetObjectItem(msg, "appId");
+	const cJSON *msg_type = cJSON_GetObjectItem(msg, "messageType");
+	const cJSON *data = cJSON_GetObjectItem(msg, "data");
+	const cJSON *ts = cJSON_GetObjectItem(msg, "ts");
+
+	if (!cJSON_IsObject(msg) || (cJSON_GetArraySize(msg) != 4) || !cJSON_IsString(app_id) ||
+	    !cJSON_IsString(msg_type) || (strcmp(msg_type->valuestring, "DATA") != 0) ||
+	    !cJSON_IsNumber(data) || !cJSON_IsNumber(ts)) {
+		return false;
+	}
+
+	if (idx < SERVER_MAX_SAMPLES) {
+		server.value[idx] = data->valuedouble;
+		server.ts[idx] = (int64_t)ts->valuedouble;
+		snprintf(server.app_id[idx], sizeof(server.app_id[idx]), "%s",
+			 app_id->valuestring);
+	}
+
+	return true;
+}
+
+int nrf_cloud_coap_obj_send(struct nrf_cloud_obj *const obj, bool confirmable)
+{
+	/* Resource selection of nrf_cloud_coap_obj_send() */
+	const char *resource = nrf_cloud_obj_bulk_check(obj) ? BULK_RSC : "d2c";
+	const cJSON *msg;
+	cJSON *array;
+	uint32_t count = 0;
+	bool res = true;
+	int err;
+
+	zassert_true(confirmable, "Telemetry must be sent confirmable");
+	zassert_equal(obj->type, NRF_CLOUD_OBJ_TYPE_JSON, "Bulk message not JSON");
+
+	k_mutex_lock(&server.lock, K_FOREVER);
+
+	if (!server.online) {
+		err = -EACCES;
+		goto unlock;
+	}
+
+	/* The payload, as encoded by nrf_cloud_coap_obj_send() */
+	err = nrf_cloud_obj_cloud_encode(obj);
+	zassert_ok(err, "Bulk message not encoded: %d", err);
+
+	array = cJSON_Parse(obj->encoded_data.ptr);
+	zassert_true(cJSON_IsArray(array), "Bulk message not a JSON array");
+
+	cJSON_ArrayForEach(msg, array) {
+		res = res && sample_decode(msg, server.samples + count);
+		count++;
+	}
+	cJSON_Delete(array);
+
+	zassert_true(res, "Bulk message not decoded");
+	zassert_true(obj->encoded_data.len <= PAYLOAD_SIZE, "Bulk message too large: %zu",
+		     obj->encoded_data.len);
+
+	snprintf(server.resource, sizeof(server.resource), "%s", resource);
+	if (server.messages < SERVER_MAX_MESSAGES) {
+		server.message_len[server.messages] = obj->encoded_data.len;
+	}
+	server.messages++;
+	server.samples += count;
+
+	(void)nrf_cloud_obj_cloud_encoded_free(obj);
+
+unlock:
+	k_mutex_unlock(&server.lock);
+
+	return err;
+}
+
+static void server_online_set(bool online)
+{
+	k_mutex_lock(&server.lock, K_FOREVER);
+	server.online = online;
+	k_mutex_unlock(&server.lock);
+}
+
+static uint32_t server_samples_wait(uint32_t count, k_timeout_t timeout)
+{
+	int64_t end = k_uptime_get() + k_ticks_to_ms_ceil64(timeout.ticks);
+
+	while ((server.samples < count) && (k_uptime_get() < end)) {
+		k_sleep(K_MSEC(10));
+	}
+
+	return server.samples;
+}
+
+static void samples_add(uint32_t first, uint32_t count, const char *app_id)
+{
+	for (uint32_t i = first; i < first + count; i++) {
+		zassert_ok(nrf_cloud_telemetry_add(app_id, i, TS_BASE + i),
+			   "Failed to add sample %u", i);
+	}
+}
+
+/* The server received the samples first to first + count - 1, in order */
+static void samples_verify(uint32_t idx, uint32_t first, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++) {
+		zassert_equal(server.value[idx + i], first + i, "Sample %u: unexpected value %f",
+			      idx + i, server.value[idx + i]);
+		zassert_equal(server.ts[idx + i], TS_BASE + first + i,
+			      "Sample %u: unexpected timestamp", idx + i);
+	}
+}
+
+static void test_before(void *fixture)
+{
+	const struct flash_area *fa;
+
+	ARG_UNUSED(fixture);
+
+	memset(&server, 0, sizeof(server));
+	k_mutex_init(&server.lock);
+	server.online = true;
+
+	zassert_ok(flash_area_open(TELEMETRY_PARTITION_ID, &fa), "Failed to open partition");
+	zassert_ok(flash_area_erase(fa, 0, fa->fa_size), "Failed to erase partition");
+	flash_area_close(fa);
+
+	zassert_ok(nrf_cloud_telemetry_init(), "Failed to initialize the queue");
+}
+
+ZTEST(nrf_cloud_telemetry, test_flush_merges_samples)
+{
+	struct nrf_cloud_telemetry_stats stats;
+
+	samples_add(0, 10, "TEMP");
+
+	zassert_ok(nrf_cloud_telemetry_flush(), "Flush failed");
+	zassert_equal(server.messages, 1, "Samples sent in %u messages", server.messages);
+	zassert_str_equal(server.resource, BULK_RSC, "Sent to %s", server.resource);
+	zassert_equal(server.samples, 10, "%u samples received", server.samples);
+	zassert_str_equal(server.app_id[0], "TEMP", "Unexpected app ID");
+	samples_verify(0, 0, 10);
+
+	nrf_cloud_telemetry_stats_get(&stats);
+	zassert_equal(stats.pending, 0, "%u samples pending", stats.pending);
+	zassert_equal(stats.sent, 10, "%u samples sent", stats.sent);
+	zassert_equal(stats.messages, 1, "%u messages sent", stats.messages);
+
+	/* Nothing is sent again */
+	zassert_ok(nrf_cloud_telemetry_flush(), "Flush failed");
+	zassert_equal(server.messages, 1, "Samples sent again");
+}
+
+ZTEST(nrf_cloud_telemetry, test_count_triggers_flush)
+{
+	samples_add(0, FLUSH_COUNT, "TEMP");
+
+	/* Sent right away, well before the flush interval */
+	zassert_equal(server_samples_wait(FLUSH_COUNT, K_MSEC(500)), FLUSH_COUNT,
+		      "Count threshold did not flush");
+	zassert_equal(server.messages, 1, "Samples sent in %u messages", server.messages);
+	samples_verify(0, 0, FLUSH_COUNT);
+}
+
+ZTEST(nrf_cloud_telemetry, test_interval_triggers_flush)
+{
+	samples_add(0, 3, "HUMID");
+
+	k_sleep(K_MSEC(200));
+	zassert_equal(server.samples, 0, "Flushed before the interval");
+
+	zassert_equal(server_samples_wait(3, K_SECONDS(2)), 3, "Interval did not flush");
+	zassert_equal(server.messages, 1, "Samples sent in %u messages", server.messages);
+	zassert_str_equal(server.app_id[2], "HUMID", "Unexpected app ID");
+}
+
+ZTEST(nrf_cloud_telemetry, test_payload_split)
+{
+	const uint32_t count = 100;
+	struct nrf_cloud_telemetry_stats stats;
+
+	server_online_set(false);
+	samples_add(0, count, "AIR_QUAL");
+	server_online_set(true);
+
+	zassert_ok(nrf_cloud_telemetry_flush(), "Flush failed");
+	zassert_equal(server.samples, count, "%u samples received", server.samples);
+	samples_verify(0, 0, count);
+
+	/* Every message but the last one is filled. The messages are filled up to the
+	 * largest encoded size of the samples, which short numbers do not reach.
+	 */
+	zassert_true(server.messages > 1, "Samples not split");
+	for (uint32_t i = 0; i + 1 < server.messages; i++) {
+		zassert_true(server.message_len[i] > PAYLOAD_SIZE / 2,
+			     "Message %u only %zu bytes", i, server.message_len[i]);
+	}
+
+	nrf_cloud_telemetry_stats_get(&stats);
+	zassert_equal(stats.messages, server.messages, "Message count mismatch");
+}
+
+ZTEST(nrf_cloud_telemetry, test_replay_after_reset)
+{
+	struct nrf_cloud_telemetry_stats stats;
+
+	server_online_set(false);
+	samples_add(0, 5, "TEMP");
+	zassert_equal(nrf_cloud_telemetry_flush(), -EACCES, "Flush did not fail");
+
+	/* Reset: the queue is reloaded from flash */
+	zassert_ok(nrf_cloud_telemetry_init(), "Failed to initialize the queue");
+	nrf_cloud_telemetry_stats_get(&stats);
+	zassert_equal(stats.pending, 5, "%u samples pending after reset", stats.pending);
+
+	server_online_set(true);
+	samples_add(5, 2, "TEMP");
+	zassert_ok(nrf_cloud_telemetry_flush(), "Flush failed");
+	zassert_equal(server.samples, 7, "%u samples received", server.samples);
+	zassert_equal(server.messages, 1, "Samples sent in %u messages", server.messages);
+	samples_verify(0, 0, 7);
+
+	/* Sent samples are not sent again after a reset */
+	zassert_ok(nrf_cloud_telemetry_init(), "Failed to initialize the queue");
+	nrf_cloud_telemetry_stats_get(&stats);
+	zassert_equal(stats.pending, 0, "%u samples pending after reset", stats.pending);
+
+	samples_add(7, 1, "TEMP");
+	zassert_ok(nrf_cloud_telemetry_flush(), "Flush failed");
+	zassert_equal(server.samples, 8, "%u samples received", server.samples);
+	samples_verify(7, 7, 1);
+}
+
+ZTEST(nrf_cloud_telemetry, test_retry_after_connection_loss)
+{
+	server_online_set(false);
+	samples_add(0, FLUSH_COUNT, "TEMP");
+
+	k_sleep(K_MSEC(200));
+	zassert_equal(server.samples, 0, "Samples received while offline");
+
+	/* Replayed by the retry, without a call to flush */
+	server_online_set(true);
+	zassert_equal(server_samples_wait(FLUSH_COUNT, K_SECONDS(3)), FLUSH_COUNT,
+		      "Samples not replayed");
+	samples_verify(0, 0, FLUSH_COUNT);
+}
+
+ZTEST(nrf_cloud_telemetry, test_full_queue_drops_oldest)
+{
+	const uint32_t count = 1500;
+	struct nrf_cloud_telemetry_stats stats;
+	uint32_t first;
+
+	server_online_set(false);
+	samples_add(0, count, "TEMP");
+
+	nrf_cloud_telemetry_stats_get(&stats);
+	zassert_true(stats.dropped > 0, "Queue did not fill up");
+	zassert_equal(stats.pending + stats.dropped, count, "%u pending, %u dropped",
+		      stats.pending, stats.dropped);
+
+	server_online_set(true);
+	zassert_ok(nrf_cloud_telemetry_flush(), "Flush failed");
+
+	/* The newest samples are kept */
+	zassert_equal(server.samples, count - stats.dropped, "%u samples received",
+		      server.samples);
+	first = count - server.samples;
+	samples_verify(0, first, server.samples);
+}
+
+ZTEST(nrf_cloud_telemetry, test_flash_wear)
+{
+	const uint32_t count = 1000;
+	const struct flash_area *fa;
+	struct nrf_cloud_telemetry_stats stats;
+	size_t sector_size;
+
+	zassert_ok(flash_area_open(TELEMETRY_PARTITION_ID, &fa), "Failed to open partition");
+	sector_size = fa->fa_size / CONFIG_NRF_CLOUD_TELEMETRY_FLASH_SECTORS;
+	flash_area_close(fa);
+
+	for (uint32_t i = 0; i < count; i += FLUSH_COUNT) {
+		samples_add(i, MIN(FLUSH_COUNT, count - i), "TEMP");
+		zassert_ok(nrf_cloud_telemetry_flush(), "Flush failed");
+	}
+
+	nrf_cloud_telemetry_stats_get(&stats);
+	zassert_equal(stats.sent, count, "%u samples sent", stats.sent);
+	zassert_equal(stats.dropped, 0, "%u samples dropped", stats.dropped);
+	samples_verify(0, 0, count);
+
+	/* Sectors are erased when they are filled, not on every flush. The records take
+	 * less than twice their size in flash, including the flash circular buffer headers.
+	 */
+	zassert_true(stats.sectors_erased <= 2 * stats.bytes_written / sector_size + 1,
+		     "%u sectors erased for %u bytes", stats.sectors_erased, stats.bytes_written);
+
+	printk("%u samples in %u messages (%u per flush), %u bytes written to flash "
+	       "(%u per sample), %u sectors erased\n",
+	       count, stats.messages, count / stats.messages, stats.bytes_written,
+	       stats.bytes_written / count, stats.sectors_erased);
+}
+
+ZTEST(nrf_cloud_telemetry, test_invalid_app_id)
+{
+	zassert_equal(nrf_cloud_telemetry_add(NULL, 1, TS_BASE), -EINVAL, "NULL app ID");
+	zassert_equal(nrf_cloud_telemetry_add("", 1, TS_BASE), -EINVAL, "Empty app ID");
+	zassert_equal(nrf_cloud_telemetry_add("APP_ID_LONGER_THAN_THIRTY_TWO_CHARS", 1, TS_BASE),
+		      -EINVAL, "Long app ID");
+}
+
+ZTEST_SUITE(nrf_cloud_telemetry, NULL, NULL, test_before, NULL, NULL);
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <nrf_compress/implementation.h>
+
+/* Input valid lzma2 compressed data whereby the output is larger than the dictionary size */
+static const uint8_t compressed_input[] = {
+#include "dummy_data_input_large.inc"
+};
+
+#define DECOMPRESSED_SIZE	134061
+#define DICT_SIZE		(128 * 1024)
+
+/* Time to receive one chunk of compressed data, for example over a 1 Mbps link. */
+#define RECV_LATENCY_US(len)	((len) * 8)
+
+/* Time to program the dictionary storage, for example an external SPI flash with 256 byte
+ * pages and 700 us page program time.
+ */
+#define WRITE_LATENCY_US(len)	(((len) / 256 + 1) * 700)
+
+static uint8_t dictionary[DICT_SIZE];
+static uint32_t dict_write_cnt;
+
+static int open_dictionary(size_t dict_size, size_t *buff_size)
+{
+	*buff_size = DICT_SIZE;
+
+	return dict_size > DICT_SIZE ? -ENOMEM : 0;
+}
+
+static int close_dictionary(void)
+{
+	return 0;
+}
+
+static size_t write_dictionary(size_t pos, const uint8_t *data, size_t len)
+{
+	memcpy(dictionary + pos, data, len);
+	dict_write_cnt++;
+
+	/* The thread does not use the CPU while the storage is busy. */
+	k_sleep(K_USEC(WRITE_LATENCY_US(len)));
+
+	return len;
+}
+
+static size_t read_dictionary(size_t pos, uint8_t *data, size_t len)
+{
+	memcpy(data, dictionary + pos, len);
+
+	return len;
+}
+
+static lzma_codec lzma_inst = {
+	.dict_if = {
+		.open = open_dictionary,
+		.close = close_dictionary,
+		.write = write_dictionary,
+		.read = read_dictionary,
+	},
+};
+
+ZTEST(nrf_compress_lzma_benchmark, test_download_decompress_throughput)
+{
+	struct nrf_compress_implementation *implementation;
+	size_t total_output_size = 0;
+	size_t pos = 0;
+	size_t chunk_size;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	int64_t start;
+	int64_t duration_ms;
+	bool last_part;
+	int rc;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+	zassert_not_null(implementation, "Expected implementation to not be NULL");
+
+	rc = implementation->init(&lzma_inst, DECOMPRESSED_SIZE);
+	zassert_ok(rc, "Expected init to be successful");
+
+	dict_write_cnt = 0;
+	start = k_uptime_get();
+
+	while (pos < sizeof(compressed_input)) {
+		chunk_size = MIN(implementation->decompress_bytes_needed(&lzma_inst),
+				 sizeof(compressed_input) - pos);
+		last_part = (pos + chunk_size) == sizeof(compressed_input);
+
+		/* The next chunk is received while the dictionary is written. */
+		k_sleep(K_USEC(RECV_LATENCY_US(chunk_size)));
+
+		rc = implementation->decompress(&lzma_inst, &compressed_input[pos], chunk_size,
+						last_part, &offset, &output, &output_size);
+		zassert_ok(rc, "Expected data decompress to be successful");
+
+		total_output_size += output_size;
+		pos += offset;
+	}
+
+	duration_ms = MAX(k_uptime_get() - start, 1);
+
+	rc = implementation->deinit(&lzma_inst);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	zassert_equal(total_output_size, DECOMPRESSED_SIZE,
+		      "Expected decompressed data size to match");
+
+	printk("%s dictionary: %zu compressed bytes in %lld ms, %lld kbps decompressed, "
+	       "%u dictionary writes\n",
+	       IS_ENABLED(CONFIG_NRF_COMPRESS_DICTIONARY_WRITE_BEHIND) ? "Write-behind" :
+									 "Synchronous",
+	       sizeof(compressed_input), duration_ms,
+	       ((int64_t)DECOMPRESSED_SIZE * 8) / duration_ms, dict_write_cnt);
+}
+
+ZTEST_SUITE(nrf_compress_lzma_benchmark, NULL, NULL, NULL, NULL, NULL);